@@ -0,0 +1,737 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_mux.c
+ *
+ * Reference multi-session server and benchmark (Linux only). Opens a large
+ * number of pseudo terminals, lets a set of writer threads replay terminal
+ * output into the slave side of each PTY, and parses everything that arrives
+ * on the master side with one vtparse instance per session. The master file
+ * descriptors are multiplexed by a single epoll instance that is served by a
+ * fixed pool of reader threads. Input buffers are taken from a slab allocator
+ * for the duration of a read and returned afterwards.
+ *
+ * Reports the aggregate throughput as well as the per-read and per-session
+ * parse latency.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <pty.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <vtparse/vtparse.h>
+
+/* Size of a single input buffer handed out by the slab allocator */
+#define MUX_BUF_SIZE 4096U
+
+/* Number of buffers allocated at once whenever the slab runs empty */
+#define MUX_SLAB_BLOCK_SIZE 64U
+
+/* Maximum number of epoll events processed per epoll_wait() call */
+#define MUX_MAX_EPOLL_EVENTS 64
+
+/* Number of bytes written into a PTY by a writer thread at once */
+#define MUX_WRITE_CHUNK 1024U
+
+/* Number of log2-spaced latency histogram buckets */
+#define MUX_HIST_BUCKETS 40
+
+/******************************************************************************
+ * Slab allocator                                                             *
+ ******************************************************************************/
+
+typedef union mux_buf {
+	union mux_buf *next;
+	unsigned char data[MUX_BUF_SIZE];
+} mux_buf_t;
+
+typedef struct mux_slab_block {
+	struct mux_slab_block *next;
+	mux_buf_t bufs[MUX_SLAB_BLOCK_SIZE];
+} mux_slab_block_t;
+
+typedef struct {
+	pthread_mutex_t lock;
+	mux_buf_t *free_list;
+	mux_slab_block_t *blocks;
+} mux_slab_t;
+
+static void mux_slab_init(mux_slab_t *slab) {
+	pthread_mutex_init(&slab->lock, NULL);
+	slab->free_list = NULL;
+	slab->blocks = NULL;
+}
+
+static void mux_slab_destroy(mux_slab_t *slab) {
+	mux_slab_block_t *block, *next;
+	for (block = slab->blocks; block; block = next) {
+		next = block->next;
+		free(block);
+	}
+	pthread_mutex_destroy(&slab->lock);
+}
+
+static mux_buf_t *mux_slab_alloc(mux_slab_t *slab) {
+	unsigned int i;
+	mux_buf_t *buf;
+	mux_slab_block_t *block;
+
+	pthread_mutex_lock(&slab->lock);
+	if (!slab->free_list) {
+		/* Allocate a new block and thread its buffers onto the free list */
+		block = malloc(sizeof(mux_slab_block_t));
+		if (!block) {
+			pthread_mutex_unlock(&slab->lock);
+			return NULL;
+		}
+		block->next = slab->blocks;
+		slab->blocks = block;
+		for (i = 0; i < MUX_SLAB_BLOCK_SIZE; i++) {
+			block->bufs[i].next = slab->free_list;
+			slab->free_list = &block->bufs[i];
+		}
+	}
+	buf = slab->free_list;
+	slab->free_list = buf->next;
+	pthread_mutex_unlock(&slab->lock);
+	return buf;
+}
+
+static void mux_slab_free(mux_slab_t *slab, mux_buf_t *buf) {
+	pthread_mutex_lock(&slab->lock);
+	buf->next = slab->free_list;
+	slab->free_list = buf;
+	pthread_mutex_unlock(&slab->lock);
+}
+
+/******************************************************************************
+ * Sessions and the multiplexer state                                         *
+ ******************************************************************************/
+
+typedef struct {
+	int master, slave;
+	vtparse_t parser;
+
+	/* Statistics, only accessed by the reader thread currently owning the
+	   session (guaranteed by EPOLLONESHOT) */
+	unsigned long long bytes, reads, events, parse_ns, max_parse_ns;
+
+	/* Writer state, only accessed by the writer thread owning the session */
+	unsigned int write_offs;
+	unsigned long long write_left;
+} mux_session_t;
+
+typedef struct {
+	mux_session_t *sessions;
+	unsigned int n_sessions;
+	int epfd, stopfd;
+	mux_slab_t slab;
+
+	/* Number of sessions that have not seen EOF yet */
+	pthread_mutex_t lock;
+	unsigned int n_active;
+
+	/* Data replayed into the PTYs */
+	unsigned char const *src;
+	unsigned int src_len;
+	unsigned long long bytes_per_session;
+} mux_t;
+
+typedef struct {
+	mux_t *mux;
+	unsigned int idx, stride;
+	pthread_t thread;
+	unsigned long long hist[MUX_HIST_BUCKETS];
+	int error;
+} mux_worker_t;
+
+static unsigned long long nanotime(void) {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return (unsigned long long)tp.tv_sec * 1000ULL * 1000ULL * 1000ULL +
+	       (unsigned long long)tp.tv_nsec;
+}
+
+static unsigned int mux_hist_bucket(unsigned long long ns) {
+	unsigned int bucket = 0;
+	while (ns > 1U && bucket + 1U < MUX_HIST_BUCKETS) {
+		ns >>= 1U;
+		bucket++;
+	}
+	return bucket;
+}
+
+/******************************************************************************
+ * Reader threads                                                             *
+ ******************************************************************************/
+
+/**
+ * Feeds the given buffer through the session's parser. This is the event loop
+ * from vtparse_example.c; instead of printing the events, we only count
+ * them.
+ */
+static void mux_session_parse(mux_session_t *session, unsigned char const *buf,
+                              unsigned int buf_len) {
+	unsigned int buf_pos = 0;
+	unsigned long long events = 0;
+	vtparse_t *parser = &session->parser;
+
+	while (1) {
+		buf_pos += vtparse_parse(parser, buf + buf_pos, buf_len - buf_pos);
+		if (!vtparse_has_event(parser)) {
+			break;
+		}
+		events++;
+	}
+	session->events += events;
+}
+
+/**
+ * Wakes up all reader threads and makes them return.
+ */
+static void mux_stop(mux_t *mux) {
+	unsigned long long one = 1;
+	if (write(mux->stopfd, &one, sizeof(one)) != sizeof(one)) {
+		perror("write");
+	}
+}
+
+static void mux_session_done(mux_t *mux, mux_session_t *session) {
+	unsigned int n_active;
+
+	epoll_ctl(mux->epfd, EPOLL_CTL_DEL, session->master, NULL);
+	close(session->master);
+	session->master = -1;
+
+	pthread_mutex_lock(&mux->lock);
+	n_active = --mux->n_active;
+	pthread_mutex_unlock(&mux->lock);
+
+	/* Wake up all reader threads once the last session is done */
+	if (n_active == 0U) {
+		mux_stop(mux);
+	}
+}
+
+static int mux_session_read(mux_worker_t *reader, mux_session_t *session) {
+	mux_t *mux = reader->mux;
+	mux_buf_t *buf;
+	ssize_t n;
+	unsigned long long t0, dt;
+	struct epoll_event ev;
+
+	if (!(buf = mux_slab_alloc(&mux->slab))) {
+		return -1;
+	}
+	n = read(session->master, buf->data, MUX_BUF_SIZE);
+	if (n > 0) {
+		t0 = nanotime();
+		mux_session_parse(session, buf->data, (unsigned int)n);
+		dt = nanotime() - t0;
+
+		session->bytes += (unsigned long long)n;
+		session->reads++;
+		session->parse_ns += dt;
+		if (dt > session->max_parse_ns) {
+			session->max_parse_ns = dt;
+		}
+		reader->hist[mux_hist_bucket(dt)]++;
+	}
+	mux_slab_free(&mux->slab, buf);
+
+	/* Reading from the master returns EIO once the slave has been closed and
+	   all data has been drained */
+	if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+		mux_session_done(mux, session);
+		return 0;
+	}
+
+	/* Re-arm the session; another reader thread may pick it up */
+	ev.events = EPOLLIN | EPOLLONESHOT;
+	ev.data.ptr = session;
+	return epoll_ctl(mux->epfd, EPOLL_CTL_MOD, session->master, &ev);
+}
+
+static void *mux_reader_main(void *arg) {
+	mux_worker_t *reader = arg;
+	struct epoll_event events[MUX_MAX_EPOLL_EVENTS];
+	int i, n;
+
+	while (1) {
+		n = epoll_wait(reader->mux->epfd, events, MUX_MAX_EPOLL_EVENTS, -1);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			perror("epoll_wait");
+			reader->error = 1;
+			return NULL;
+		}
+		for (i = 0; i < n; i++) {
+			/* The stop eventfd is registered with a NULL pointer */
+			if (!events[i].data.ptr) {
+				return NULL;
+			}
+			if (mux_session_read(reader, events[i].data.ptr) != 0) {
+				perror("mux_session_read");
+				reader->error = 1;
+				return NULL;
+			}
+		}
+	}
+}
+
+/******************************************************************************
+ * Writer threads                                                             *
+ ******************************************************************************/
+
+static void *mux_writer_main(void *arg) {
+	mux_worker_t *writer = arg;
+	mux_t *mux = writer->mux;
+	mux_session_t *session;
+	unsigned int i, n_open, len;
+	ssize_t n;
+
+	/* Round-robin over all sessions owned by this writer and write one chunk
+	   at a time until the requested number of bytes has been written */
+	do {
+		n_open = 0;
+		for (i = writer->idx; i < mux->n_sessions; i += writer->stride) {
+			session = &mux->sessions[i];
+			if (session->slave < 0) {
+				continue;
+			}
+			len = mux->src_len - session->write_offs;
+			if (len > MUX_WRITE_CHUNK) {
+				len = MUX_WRITE_CHUNK;
+			}
+			if (len > session->write_left) {
+				len = (unsigned int)session->write_left;
+			}
+			n = write(session->slave, mux->src + session->write_offs, len);
+			if (n < 0 && errno != EINTR) {
+				perror("write");
+				writer->error = 1;
+				session->write_left = 0;
+			} else if (n > 0) {
+				session->write_offs =
+				    (session->write_offs + (unsigned int)n) % mux->src_len;
+				session->write_left -= (unsigned long long)n;
+			}
+			if (session->write_left == 0U) {
+				close(session->slave);
+				session->slave = -1;
+			} else {
+				n_open++;
+			}
+		}
+	} while (n_open > 0U);
+	return NULL;
+}
+
+/******************************************************************************
+ * Setup and reporting                                                        *
+ ******************************************************************************/
+
+/**
+ * Generates terminal output resembling a colourful shell session: text with
+ * SGR colour changes (including 24-bit colours), cursor movement and line
+ * breaks.
+ */
+static unsigned char *mux_synthesize(unsigned int len) {
+	static const char *words[] = {"the",  "quick", "brown", "fox",   "jumps",
+	                              "over", "lazy",  "dog",   "vtparse", "pty"};
+	unsigned char *buf = malloc(len);
+	unsigned int pos = 0, seed = 12345U, r;
+	char tmp[64];
+	int n;
+
+	if (!buf) {
+		return NULL;
+	}
+	while (pos < len) {
+		seed = seed * 1103515245U + 12345U;
+		r = (seed >> 16U) & 0x7FFFU;
+		switch (r % 8U) {
+			case 0:
+				n = sprintf(tmp, "\033[38;2;%u;%u;%um", r % 256U, (r >> 3U) % 256U,
+				            (r >> 5U) % 256U);
+				break;
+			case 1:
+				n = sprintf(tmp, "\033[%um", 30U + r % 8U);
+				break;
+			case 2:
+				n = sprintf(tmp, "\033[%u;%uH", 1U + r % 24U, 1U + r % 80U);
+				break;
+			case 3:
+				n = sprintf(tmp, "\r\n");
+				break;
+			default:
+				n = sprintf(tmp, "%s ", words[r % 10U]);
+				break;
+		}
+		if (pos + (unsigned int)n > len) {
+			n = (int)(len - pos);
+		}
+		memcpy(buf + pos, tmp, (size_t)n);
+		pos += (unsigned int)n;
+	}
+	return buf;
+}
+
+static unsigned char *mux_read_files(int argc, char *argv[], unsigned int *len) {
+	unsigned char *buf = NULL, *new_buf;
+	size_t n;
+	int i;
+	FILE *f;
+
+	*len = 0;
+	for (i = 0; i < argc; i++) {
+		if (!(f = fopen(argv[i], "rb"))) {
+			perror(argv[i]);
+			free(buf);
+			return NULL;
+		}
+		do {
+			if (!(new_buf = realloc(buf, *len + 65536U))) {
+				fclose(f);
+				free(buf);
+				return NULL;
+			}
+			buf = new_buf;
+			n = fread(buf + *len, 1, 65536U, f);
+			*len += (unsigned int)n;
+		} while (n > 0);
+		fclose(f);
+	}
+	return buf;
+}
+
+static int mux_open_session(mux_t *mux, mux_session_t *session,
+                            unsigned int idx) {
+	struct termios tio;
+	struct epoll_event ev;
+
+	memset(session, 0, sizeof(*session));
+	session->master = session->slave = -1;
+	if (openpty(&session->master, &session->slave, NULL, NULL, NULL) != 0) {
+		perror("openpty");
+		return -1;
+	}
+
+	/* Pass all bytes through unmodified (e.g. no "\n" to "\r\n" translation) */
+	if (tcgetattr(session->slave, &tio) == 0) {
+		cfmakeraw(&tio);
+		tcsetattr(session->slave, TCSANOW, &tio);
+	}
+	fcntl(session->master, F_SETFL,
+	      fcntl(session->master, F_GETFL) | O_NONBLOCK);
+
+	vtparse_init(&session->parser);
+
+	/* Start each session at a different position in the source data */
+	session->write_offs = (idx * 4099U) % mux->src_len;
+	session->write_left = mux->bytes_per_session;
+
+	ev.events = EPOLLIN | EPOLLONESHOT;
+	ev.data.ptr = session;
+	if (epoll_ctl(mux->epfd, EPOLL_CTL_ADD, session->master, &ev) != 0) {
+		perror("epoll_ctl");
+		return -1;
+	}
+	return 0;
+}
+
+static unsigned long long mux_hist_percentile(unsigned long long const *hist,
+                                              double p) {
+	unsigned long long total = 0, sum = 0;
+	unsigned int i;
+	for (i = 0; i < MUX_HIST_BUCKETS; i++) {
+		total += hist[i];
+	}
+	for (i = 0; i < MUX_HIST_BUCKETS; i++) {
+		sum += hist[i];
+		if (sum > 0U && (double)sum >= p * (double)total) {
+			return 2ULL << i; /* Upper bound of the bucket */
+		}
+	}
+	return 0;
+}
+
+static int mux_cmp_ull(const void *a, const void *b) {
+	unsigned long long x = *(unsigned long long const *)a,
+	                   y = *(unsigned long long const *)b;
+	return (x > y) - (x < y);
+}
+
+static void mux_report(mux_t *mux, mux_worker_t *readers,
+                       unsigned int n_readers, unsigned long long wall_ns) {
+	unsigned long long hist[MUX_HIST_BUCKETS];
+	unsigned long long bytes = 0, events = 0, parse_ns = 0, max_ns = 0;
+	unsigned long long *means;
+	unsigned int i, j;
+	mux_session_t *session;
+
+	memset(hist, 0, sizeof(hist));
+	for (i = 0; i < n_readers; i++) {
+		for (j = 0; j < MUX_HIST_BUCKETS; j++) {
+			hist[j] += readers[i].hist[j];
+		}
+	}
+
+	means = calloc(mux->n_sessions, sizeof(unsigned long long));
+	for (i = 0; i < mux->n_sessions; i++) {
+		session = &mux->sessions[i];
+		bytes += session->bytes;
+		events += session->events;
+		parse_ns += session->parse_ns;
+		if (session->max_parse_ns > max_ns) {
+			max_ns = session->max_parse_ns;
+		}
+		if (means && session->reads > 0U) {
+			means[i] = session->parse_ns / session->reads;
+		}
+	}
+
+	fprintf(stdout,
+	        "Parsed %llu bytes (%llu events) from %u sessions in %llums\n",
+	        bytes, events, mux->n_sessions, wall_ns / 1000000ULL);
+	if (wall_ns > 0U && parse_ns > 0U) {
+		fprintf(stdout,
+		        "Aggregate throughput: %.1f MiB/s (parser only: %.1f MiB/s, "
+		        "%lldps per byte)\n",
+		        (double)bytes / (1024.0 * 1024.0) / ((double)wall_ns * 1e-9),
+		        (double)bytes / (1024.0 * 1024.0) / ((double)parse_ns * 1e-9),
+		        bytes ? (long long)((parse_ns * 1000ULL) / bytes) : 0LL);
+	}
+	fprintf(stdout,
+	        "Parse latency per read: p50 <= %lluns, p99 <= %lluns, "
+	        "p99.9 <= %lluns, max %lluns\n",
+	        mux_hist_percentile(hist, 0.5), mux_hist_percentile(hist, 0.99),
+	        mux_hist_percentile(hist, 0.999), max_ns);
+	if (means) {
+		qsort(means, mux->n_sessions, sizeof(unsigned long long), mux_cmp_ull);
+		fprintf(stdout,
+		        "Mean parse latency per session: min %lluns, median %lluns, "
+		        "max %lluns\n",
+		        means[0], means[mux->n_sessions / 2U],
+		        means[mux->n_sessions - 1U]);
+		free(means);
+	}
+}
+
+static void mux_usage(const char *name) {
+	fprintf(stderr,
+	        "Usage: %s [-s SESSIONS] [-r READERS] [-w WRITERS] [-n BYTES] "
+	        "[INPUT FILE 1 ... INPUT FILE N]\n"
+	        "  -s  Number of PTY sessions (default 256)\n"
+	        "  -r  Number of reader threads (default 4)\n"
+	        "  -w  Number of writer threads (default 4)\n"
+	        "  -n  Number of bytes written per session (default 1048576)\n"
+	        "Replays the input files into each session, or synthetic terminal\n"
+	        "output if no input file is given.\n",
+	        name);
+}
+
+int main(int argc, char *argv[]) {
+	mux_t mux;
+	mux_worker_t *readers = NULL, *writers = NULL;
+	unsigned int n_readers = 4, n_writers = 4, i;
+	unsigned int n_started_readers = 0, n_started_writers = 0;
+	unsigned long long t0, t1;
+	unsigned char *src;
+	struct rlimit rlim;
+	struct epoll_event ev;
+	int opt, err, res = 1;
+
+	memset(&mux, 0, sizeof(mux));
+	mux.n_sessions = 256;
+	mux.bytes_per_session = 1024ULL * 1024ULL;
+	while ((opt = getopt(argc, argv, "s:r:w:n:h")) != -1) {
+		switch (opt) {
+			case 's':
+				mux.n_sessions = (unsigned int)strtoul(optarg, NULL, 10);
+				break;
+			case 'r':
+				n_readers = (unsigned int)strtoul(optarg, NULL, 10);
+				break;
+			case 'w':
+				n_writers = (unsigned int)strtoul(optarg, NULL, 10);
+				break;
+			case 'n':
+				mux.bytes_per_session = strtoull(optarg, NULL, 10);
+				break;
+			default:
+				mux_usage(argv[0]);
+				return 1;
+		}
+	}
+	if (mux.n_sessions == 0U || n_readers == 0U || n_writers == 0U) {
+		mux_usage(argv[0]);
+		return 1;
+	}
+
+	/* Load or generate the data that is replayed into the PTYs */
+	if (optind < argc) {
+		src = mux_read_files(argc - optind, argv + optind, &mux.src_len);
+	} else {
+		mux.src_len = 1024U * 1024U;
+		src = mux_synthesize(mux.src_len);
+	}
+	if (!src || mux.src_len == 0U) {
+		fprintf(stderr, "Error while loading the input data!\n");
+		free(src);
+		return 1;
+	}
+	mux.src = src;
+
+	/* Each session requires two file descriptors */
+	if (getrlimit(RLIMIT_NOFILE, &rlim) == 0) {
+		rlim.rlim_cur = rlim.rlim_max;
+		setrlimit(RLIMIT_NOFILE, &rlim);
+	}
+
+	mux_slab_init(&mux.slab);
+	pthread_mutex_init(&mux.lock, NULL);
+	mux.epfd = epoll_create1(0);
+	mux.stopfd = eventfd(0, 0);
+	mux.sessions = calloc(mux.n_sessions, sizeof(mux_session_t));
+	readers = calloc(n_readers, sizeof(mux_worker_t));
+	writers = calloc(n_writers, sizeof(mux_worker_t));
+	if (mux.epfd < 0 || mux.stopfd < 0 || !mux.sessions || !readers ||
+	    !writers) {
+		perror("setup");
+		goto cleanup;
+	}
+
+	/* Register the stop eventfd (level-triggered, wakes up all readers) */
+	ev.events = EPOLLIN;
+	ev.data.ptr = NULL;
+	epoll_ctl(mux.epfd, EPOLL_CTL_ADD, mux.stopfd, &ev);
+
+	for (i = 0; i < mux.n_sessions; i++) {
+		if (mux_open_session(&mux, &mux.sessions[i], i) != 0) {
+			fprintf(stderr, "Could only open %u of %u sessions\n", i,
+			        mux.n_sessions);
+			mux.n_sessions = i + 1U;
+			goto cleanup;
+		}
+	}
+	mux.n_active = mux.n_sessions;
+
+	fprintf(stdout,
+	        "Multiplexing %u sessions with %u reader and %u writer threads "
+	        "(%llu bytes per session)\n",
+	        mux.n_sessions, n_readers, n_writers, mux.bytes_per_session);
+
+	/* Start the reader threads. If one cannot be created, no data has been
+	   written yet; stop the readers that are already running. */
+	t0 = nanotime();
+	for (n_started_readers = 0; n_started_readers < n_readers;
+	     n_started_readers++) {
+		readers[n_started_readers].mux = &mux;
+		if ((err = pthread_create(&readers[n_started_readers].thread, NULL,
+		                          mux_reader_main,
+		                          &readers[n_started_readers])) != 0) {
+			fprintf(stderr, "Error while creating reader thread: %s\n",
+			        strerror(err));
+			mux_stop(&mux);
+			break;
+		}
+	}
+
+	/* Start the writer threads. If one cannot be created, close the slave side
+	   of the sessions owned by the writers that are not running. The readers
+	   then see EOF on these sessions and return once the running writers are
+	   done, instead of waiting for data that is never written. */
+	for (n_started_writers = 0; n_started_readers == n_readers &&
+	                            n_started_writers < n_writers;
+	     n_started_writers++) {
+		writers[n_started_writers].mux = &mux;
+		writers[n_started_writers].idx = n_started_writers;
+		writers[n_started_writers].stride = n_writers;
+		if ((err = pthread_create(&writers[n_started_writers].thread, NULL,
+		                          mux_writer_main,
+		                          &writers[n_started_writers])) != 0) {
+			fprintf(stderr, "Error while creating writer thread: %s\n",
+			        strerror(err));
+			for (i = 0; i < mux.n_sessions; i++) {
+				if (i % n_writers >= n_started_writers) {
+					close(mux.sessions[i].slave);
+					mux.sessions[i].slave = -1;
+				}
+			}
+			break;
+		}
+	}
+
+	res = (n_started_readers < n_readers) || (n_started_writers < n_writers);
+	for (i = 0; i < n_started_writers; i++) {
+		pthread_join(writers[i].thread, NULL);
+		res |= writers[i].error;
+	}
+	for (i = 0; i < n_started_readers; i++) {
+		pthread_join(readers[i].thread, NULL);
+		res |= readers[i].error;
+	}
+	t1 = nanotime();
+
+	if (n_started_readers == n_readers && n_started_writers == n_writers) {
+		mux_report(&mux, readers, n_readers, t1 - t0);
+	}
+
+cleanup:
+	for (i = 0; mux.sessions && i < mux.n_sessions; i++) {
+		if (mux.sessions[i].master >= 0) {
+			close(mux.sessions[i].master);
+		}
+		if (mux.sessions[i].slave >= 0) {
+			close(mux.sessions[i].slave);
+		}
+	}
+	if (mux.epfd >= 0) {
+		close(mux.epfd);
+	}
+	if (mux.stopfd >= 0) {
+		close(mux.stopfd);
+	}
+	pthread_mutex_destroy(&mux.lock);
+	mux_slab_destroy(&mux.slab);
+	free(mux.sessions);
+	free(readers);
+	free(writers);
+	free(src);
+	return res;
+}
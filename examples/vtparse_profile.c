@@ -0,0 +1,155 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_profile.c
+ *
+ * Records the transition frequency profile of a corpus of terminal output,
+ * i.e. how often each byte is read in each state of the state machine. The
+ * profile is written to stdout in the format read by
+ * tables/vtparse_gen_hot_transitions.rb, which generates the transitions that
+ * vtparse_parse() performs without going through the action cycles. A summary
+ * of the most frequent transitions is written to stderr. Usage:
+ *
+ *     ./vtparse_profile <INPUT FILE 1> ... <INPUT FILE N> > profile.txt
+ *
+ * Use "-" to read from stdin.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vtparse/vtparse.h>
+#include <vtparse/vtparse_dialect.h>
+
+#define N_STATES VTPARSE_NUM_STATES
+#define N_SUMMARY 20
+
+static unsigned long long counts[N_STATES][256];
+
+/* Copy of the built-in tables; the tables themselves are internal to the
+   library */
+static vtparse_dialect_t builtin;
+
+/**
+ * Runs the bytes in the given file through the state transition table,
+ * starting in the given state, and returns the final state. The sequence of
+ * states only depends on the table; the parser options and event mask do not
+ * influence it.
+ */
+static int profile_file(FILE *f, int state, unsigned long long *total) {
+	unsigned char buf[65536];
+	size_t i, n;
+	vtparse_state_change_t change;
+
+	while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+		for (i = 0; i < n; i++) {
+			counts[state - 1][buf[i]]++;
+			change = builtin.state_table[state - 1][buf[i]];
+			if (change >> 4) {
+				state = change >> 4;
+			}
+		}
+		*total += n;
+	}
+	return state;
+}
+
+/**
+ * Writes a short description of the transition for the summary to str.
+ */
+static void describe(char *str, int state, int ch) {
+	const vtparse_state_change_t change = builtin.state_table[state - 1][ch];
+	const char *action = (change & 0x0F) ? vtparse_action_str(change & 0x0F)
+	                                      : "-";
+	if (change >> 4) {
+		sprintf(str, "%s -> %s", action, vtparse_state_str(change >> 4));
+	} else {
+		sprintf(str, "%s", action);
+	}
+}
+
+int main(int argc, char *argv[]) {
+	unsigned long long total = 0, best, covered = 0;
+	unsigned int s, c, k, best_s = 0, best_c = 0;
+	int i, state = VTPARSE_STATE_GROUND;
+	char str[64];
+	FILE *f;
+
+	if (argc < 2) {
+		fprintf(stderr,
+		        "Usage ./vtparse_profile <INPUT FILE 1> ... <INPUT FILE N> "
+		        "> PROFILE\n");
+		return 1;
+	}
+
+	/* Files are profiled as if they were concatenated */
+	vtparse_dialect_init(&builtin);
+	for (i = 1; i < argc; i++) {
+		f = (strcmp(argv[i], "-") == 0) ? stdin : fopen(argv[i], "rb");
+		if (!f) {
+			fprintf(stderr, "Error while opening \"%s\"!\n", argv[i]);
+			return 1;
+		}
+		state = profile_file(f, state, &total);
+		if (f != stdin) {
+			fclose(f);
+		}
+	}
+
+	/* Write the profile; one line per transition that was taken */
+	printf("# vtparse transition profile of %llu bytes\n", total);
+	printf("# <state> <byte> <count>\n");
+	for (s = 0; s < N_STATES; s++) {
+		for (c = 0; c < 256U; c++) {
+			if (counts[s][c]) {
+				printf("%s 0x%02x %llu\n", vtparse_state_str((int)s + 1), c,
+				       counts[s][c]);
+			}
+		}
+	}
+
+	/* Summarize the most frequent transitions; destroys the counts */
+	fprintf(stderr, "%llu bytes, most frequent transitions:\n", total);
+	for (k = 0; k < N_SUMMARY && total > 0; k++) {
+		best = 0;
+		for (s = 0; s < N_STATES; s++) {
+			for (c = 0; c < 256U; c++) {
+				if (counts[s][c] > best) {
+					best = counts[s][c];
+					best_s = s;
+					best_c = c;
+				}
+			}
+		}
+		if (best == 0) {
+			break;
+		}
+		covered += best;
+		describe(str, (int)best_s + 1, (int)best_c);
+		fprintf(stderr, "  %6.2f%% %6.2f%%  %-20s 0x%02x  %s\n",
+		        100.0 * (double)best / (double)total,
+		        100.0 * (double)covered / (double)total,
+		        vtparse_state_str((int)best_s + 1), best_c, str);
+		counts[best_s][best_c] = 0;
+	}
+	return 0;
+}
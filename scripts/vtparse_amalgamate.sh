@@ -0,0 +1,103 @@
+#!/bin/sh
+
+#  VTParse -- An implementation of Paul Williams' DEC compatible state machine
+#
+#  Copyright (C) 2018  Andreas Stöckel
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU Affero General Public License as
+#  published by the Free Software Foundation, either version 3 of the
+#  License, or (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU Affero General Public License for more details.
+#
+#  You should have received a copy of the GNU Affero General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#
+# Generates the single-include header vtparse/vtparse_amalgamated.h from
+# scripts/vtparse_amalgamated.h.in by recursively inlining every
+# "#include <vtparse/...>" directive. Each file is inlined upon its first
+# inclusion only, just like the include guards would do. With --check, the
+# checked-in header is compared with the generated one instead; if a C++
+# compiler command is given, the checked-in header is additionally compiled
+# as C++.
+#
+# Usage: vtparse_amalgamate.sh [--check] <SOURCE DIR> [<CXX> [<ARGS>...]]
+#
+
+set -e
+
+CHECK=0
+if [ "$1" = "--check" ]; then
+	CHECK=1
+	shift
+fi
+if [ $# -lt 1 ] || { [ $# -gt 1 ] && [ $CHECK -eq 0 ]; }; then
+	echo "Usage: $0 [--check] <SOURCE DIR> [<CXX> [<ARGS>...]]" >&2
+	exit 1
+fi
+
+SRC_DIR="$1"
+shift
+TEMPLATE="$SRC_DIR/scripts/vtparse_amalgamated.h.in"
+HEADER="$SRC_DIR/vtparse/vtparse_amalgamated.h"
+
+# Writes the amalgamated header to stdout
+amalgamate() {
+	awk -v src_dir="$SRC_DIR" '
+		function inline(path,    line, name, n) {
+			while ((n = getline line < path) > 0) {
+				if (match(line, /^#include <vtparse\/[A-Za-z0-9_]+\.[ch]>/)) {
+					name = substr(line, 11, RLENGTH - 11)
+					if (!(name in seen)) {
+						seen[name] = 1
+						print "/* --- " name " --- */"
+						print ""
+						inline(src_dir "/" name)
+						print "/* --- end of " name " --- */"
+					}
+					continue
+				}
+				# Drop the declarations of the tables. In the amalgamation the
+				# tables are static and defined before their first use; C++
+				# rejects static const declarations without an initializer.
+				if (line ~ /^VTPARSE_TABLE_DECL /) {
+					continue
+				}
+				print line
+			}
+			if (n < 0) {
+				print "Error while reading " path > "/dev/stderr"
+				exit 1
+			}
+			close(path)
+		}
+		BEGIN {
+			inline(src_dir "/scripts/vtparse_amalgamated.h.in")
+		}'
+}
+
+if [ $CHECK -eq 1 ]; then
+	if ! amalgamate | cmp -s - "$HEADER"; then
+		echo "$HEADER is out of date; run $0 $SRC_DIR" >&2
+		exit 1
+	fi
+	if [ $# -gt 0 ]; then
+		printf '%s\n' \
+			'#include <vtparse/vtparse_amalgamated.h>' \
+			'int main() {' \
+			'	vtparse_t parser;' \
+			'	vtparse_init(&parser);' \
+			'	return (int)vtparse_parse(&parser, (const unsigned char *)"", 0U);' \
+			'}' |
+			"$@" -x c++ -Wall -Werror -I"$SRC_DIR" -c -o /dev/null -
+	fi
+else
+	amalgamate > "$HEADER.tmp"
+	mv "$HEADER.tmp" "$HEADER"
+	echo "Wrote $HEADER"
+fi
@@ -0,0 +1,63 @@
+#!/bin/sh
+
+#  VTParse -- An implementation of Paul Williams' DEC compatible state machine
+#
+#  Copyright (C) 2018  Andreas Stöckel
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU Affero General Public License as
+#  published by the Free Software Foundation, either version 3 of the
+#  License, or (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU Affero General Public License for more details.
+#
+#  You should have received a copy of the GNU Affero General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#
+# Verifies that a shared vtparse library exports exactly the public functions
+# listed in the given symbol list, i.e. that neither the generated tables nor
+# any internal function is part of its ABI.
+#
+# Usage: vtparse_check_exports.sh <NM> <SHARED LIBRARY> <SYMBOL LIST>
+#
+
+set -e
+
+if [ $# -ne 3 ]; then
+	echo "Usage: $0 <NM> <SHARED LIBRARY> <SYMBOL LIST>" >&2
+	exit 1
+fi
+
+NM="$1"
+LIB="$2"
+LIST="$3"
+
+SYMBOLS=$("$NM" -D --defined-only "$LIB" | awk 'NF == 3 { print $3 }')
+if [ -z "$SYMBOLS" ]; then
+	echo "No exported symbols found in $LIB" >&2
+	exit 1
+fi
+
+# Symbols exported but not listed, and listed but not exported
+UNEXPECTED=$(echo "$SYMBOLS" | awk -v list="$LIST" '
+	BEGIN { while ((getline line < list) > 0) if (line !~ /^#/) public[line] = 1 }
+	!($0 in public) { print }')
+MISSING=$(echo "$SYMBOLS" | awk -v list="$LIST" '
+	{ exported[$0] = 1 }
+	END { while ((getline line < list) > 0) if (line !~ /^#/ && !(line in exported)) print line }')
+if [ -n "$UNEXPECTED" ]; then
+	echo "Unexpected symbols exported by $LIB:" >&2
+	echo "$UNEXPECTED" >&2
+fi
+if [ -n "$MISSING" ]; then
+	echo "Public symbols missing from $LIB:" >&2
+	echo "$MISSING" >&2
+fi
+if [ -n "$UNEXPECTED" ] || [ -n "$MISSING" ]; then
+	exit 1
+fi
+echo "$(echo "$SYMBOLS" | wc -l) symbols exported by $LIB"
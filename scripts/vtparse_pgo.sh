@@ -0,0 +1,86 @@
+#!/bin/sh
+
+#  VTParse -- An implementation of Paul Williams' DEC compatible state machine
+#
+#  Copyright (C) 2018  Andreas Stöckel
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU Affero General Public License as
+#  published by the Free Software Foundation, either version 3 of the
+#  License, or (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU Affero General Public License for more details.
+#
+#  You should have received a copy of the GNU Affero General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#
+# Profile-guided optimization of vtparse. Builds a release LTO reference,
+# builds an instrumented LTO binary, trains it on the given benchmark corpus,
+# rebuilds vtparse with -fprofile-use and reports the measured gain.
+#
+# Usage: vtparse_pgo.sh <SOURCE DIR> <WORK DIR> <CORPUS FILE 1> ... <CORPUS FILE N>
+#
+
+set -e
+
+if [ $# -lt 3 ]; then
+	echo "Usage: $0 <SOURCE DIR> <WORK DIR> <CORPUS FILE 1> ... <CORPUS FILE N>" >&2
+	exit 1
+fi
+
+SRC_DIR="$1"
+WORK_DIR="$2"
+shift 2
+
+# Creates or reconfigures the build directory $1 with the remaining options
+configure() {
+	DIR="$1"
+	shift
+	if [ -d "$DIR/meson-private" ]; then
+		meson configure "$DIR" "$@"
+	else
+		meson setup "$DIR" "$SRC_DIR" "$@"
+	fi
+}
+
+# Runs the benchmark $1 on the corpus and prints the picoseconds per byte
+benchmark() {
+	"$@" 2>/dev/null | sed -n 's/.*Parsing all files.*(\([0-9]*\)ps per byte).*/\1/p'
+}
+
+# Prints the relative gain of $2 over $1 in percent
+gain() {
+	awk "BEGIN { printf \"%.1f\", ($1 - $2) * 100.0 / $1 }"
+}
+
+mkdir -p "$WORK_DIR"
+
+echo "----> Building LTO reference"
+configure "$WORK_DIR/lto" -Dbuildtype=release -Db_lto=true -Db_pgo=off
+ninja -C "$WORK_DIR/lto"
+
+echo "----> Building instrumented LTO binary"
+configure "$WORK_DIR/pgo" -Dbuildtype=release -Db_lto=true -Db_pgo=generate
+ninja -C "$WORK_DIR/pgo"
+
+echo "----> Collecting profiles"
+find "$WORK_DIR/pgo" -name '*.gcda' -delete
+"$WORK_DIR/pgo/test_vtparse_performance" "$@" >/dev/null 2>&1
+"$WORK_DIR/pgo/test_vtparse_performance_amalgamated" "$@" >/dev/null 2>&1
+
+echo "----> Rebuilding with -fprofile-use"
+configure "$WORK_DIR/pgo" -Db_pgo=use
+ninja -C "$WORK_DIR/pgo"
+
+echo "----> Measuring"
+for EXE in test_vtparse_performance test_vtparse_performance_amalgamated; do
+	T_LTO=$(benchmark "$WORK_DIR/lto/$EXE" "$@")
+	T_PGO=$(benchmark "$WORK_DIR/pgo/$EXE" "$@")
+	echo "      $EXE: LTO ${T_LTO}ps per byte, LTO+PGO ${T_PGO}ps per byte" \
+	     "($(gain "$T_LTO" "$T_PGO")% faster)"
+done
+echo "[OK!] Done."
@@ -8,6 +8,94 @@ class String
     end
 end
 
+# Actions that produce data and are consumed in runs by the parser
+$data_actions = [:print, :put, :osc_put]
+
+# Maximum number of byte ranges in a run class
+$max_run_ranges = 4
+
+# Computes the set of bytes that continue a data run in the given state as a
+# list of inclusive byte ranges. Returns the data action and the ranges.
+def run_class(state)
+    action = nil
+    ranges = []
+    $state_tables[state].each_with_index { |state_change, i|
+        next unless state_change
+        if state_change.find_all { |s| s.kind_of?(StateTransition) }.length > 0
+            next
+        end
+        (a,) = state_change.find_all { |s| s.kind_of?(Symbol) }
+        next unless $data_actions.include?(a)
+        action ||= a
+        raise "State #{state} has more than one data action" if a != action
+        if ranges.length > 0 and ranges[-1][1] == i - 1
+            ranges[-1][1] = i
+        else
+            ranges << [i, i]
+        end
+    }
+    ranges = [] if ranges.length > $max_run_ranges
+    [action, ranges]
+end
+
+# Actions that only update the collected parameters and intermediate
+# characters; transitions consisting of these never return to the user
+$internal_actions = [:clear, :collect, :ignore, :param]
+
+# Returns the actions performed when reading the given byte in the given
+# state (exit, transition and entry action) and the next state, or nil if the
+# transition may return to the user or produces data
+def internal_step(state, byte)
+    transition = $state_tables[state][byte] || []
+    (action,) = transition.find_all { |s| s.kind_of?(Symbol) }
+    (target,) = transition.find_all { |s| s.kind_of?(StateTransition) }
+    target = target.to_state if target
+    actions = [action]
+    actions = [$states[state][:on_exit], action, $states[target][:on_entry]] if target
+    actions = actions.compact
+    return nil unless actions.all? { |a| $internal_actions.include?(a) }
+    [actions - [:ignore], target]
+end
+
+# Bytes with the same transitions in all states form an equivalence class
+class_of = {}
+$byte_classes = (0..255).map { |b|
+    class_of[$states_in_order.map { |state| $state_tables[state][b] }] ||= class_of.length
+}
+$num_classes = class_of.length
+$class_bytes = (0...$num_classes).map { |c| $byte_classes.index(c) }
+
+# Stride-2 table: for each state and pair of byte classes, the index of the
+# entry in STRIDE2_OPS performing both transitions, or zero if one of the
+# transitions may return to the user. An entry consists of the state after
+# the second byte, the number of operations and the operations; each is an
+# action (low nibble) applied to the first or second byte (bit 4), bit 5
+# marks that a state was entered after the byte.
+$stride2_ops = [nil]
+$stride2_table = $states_in_order.map { |state|
+    $class_bytes.map { |b1|
+        $class_bytes.map { |b2|
+            step1 = internal_step(state, b1)
+            next 0 unless step1
+            state1 = step1[1] || state
+            step2 = internal_step(state1, b2)
+            next 0 unless step2
+            ops = []
+            [step1, step2].each_with_index { |(actions, target), i|
+                actions.each { |a| ops << (($actions_in_order.index(a) + 1) | (i << 4)) }
+                if target
+                    ops << (i << 4) if ops.empty? or (ops[-1] >> 4) & 1 != i
+                    ops[-1] |= 0x20
+                end
+            }
+            entry = [$states_in_order.index(step2[1] || state1) + 1, ops.length] + ops
+            $stride2_ops.index(entry) || ($stride2_ops << entry).length - 1
+        }
+    }
+}
+raise "Too many stride-2 entries" if $stride2_ops.length > 256
+$max_stride2_ops = $stride2_ops.compact.map { |entry| entry[1] }.max
+
 tar_hfile = "vtparse_table.h"
 tar_cfile = "vtparse_table.c"
 
@@ -20,6 +108,8 @@ File.open(tar_hfile, "w") { |f|
     f.puts "#ifndef VTPARSE_VTPARSE_TABLE_H"
     f.puts "#define VTPARSE_VTPARSE_TABLE_H"
     f.puts
+    f.puts "#include <vtparse/vtparse_table_decl.h>"
+    f.puts
     f.puts "#ifdef __cplusplus"
     f.puts "extern \"C\" {"
     f.puts "#endif"
@@ -43,11 +133,36 @@ File.open(tar_hfile, "w") { |f|
     f.puts
     f.puts "typedef unsigned char vtparse_state_change_t;"
     f.puts
-    f.puts "extern vtparse_state_change_t STATE_TABLE[#{$states_in_order.length}][256];"
-    f.puts "extern vtparse_action_t ENTRY_ACTIONS[#{$states_in_order.length}];"
-    f.puts "extern vtparse_action_t EXIT_ACTIONS[#{$states_in_order.length}];"
-    f.puts "extern char *ACTION_NAMES[#{$actions_in_order.length+1}];"
-    f.puts "extern char *STATE_NAMES[#{$states_in_order.length+1}];"
+    f.puts "/* Number of states; the states are numbered starting at one */"
+    f.puts "#define VTPARSE_NUM_STATES #{$states_in_order.length}"
+    f.puts
+    f.puts "/* Bytes continuing a run of the data action in a given state, as inclusive"
+    f.puts "   ranges. num_ranges is zero if the state has no data action or the set"
+    f.puts "   of bytes consists of too many ranges. */"
+    f.puts "#define VTPARSE_MAX_RUN_RANGES #{$max_run_ranges}"
+    f.puts "typedef struct vtparse_run_class {"
+    f.puts "   unsigned char action;"
+    f.puts "   unsigned char num_ranges;"
+    f.puts "   unsigned char lo[VTPARSE_MAX_RUN_RANGES];"
+    f.puts "   unsigned char hi[VTPARSE_MAX_RUN_RANGES];"
+    f.puts "} vtparse_run_class_t;"
+    f.puts
+    f.puts "/* Byte equivalence classes and the stride-2 transition table consuming two"
+    f.puts "   bytes per lookup, see vtparse_gen_c_tables.rb. STRIDE2_OPS holds the state"
+    f.puts "   after both bytes, the number of operations and the operations. */"
+    f.puts "#define VTPARSE_NUM_CLASSES #{$num_classes}"
+    f.puts "#define VTPARSE_MAX_STRIDE2_OPS #{$max_stride2_ops}"
+    f.puts
+    f.puts "/* ENTRY_ACTIONS and EXIT_ACTIONS hold one vtparse_action_t per byte */"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const vtparse_state_change_t STATE_TABLE[#{$states_in_order.length}][256];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char ENTRY_ACTIONS[#{$states_in_order.length}];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char EXIT_ACTIONS[#{$states_in_order.length}];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const vtparse_run_class_t RUN_CLASSES[#{$states_in_order.length}];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char BYTE_CLASSES[256];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_TABLE[#{$states_in_order.length}][VTPARSE_NUM_CLASSES][VTPARSE_NUM_CLASSES];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_OPS[#{$stride2_ops.length}][VTPARSE_MAX_STRIDE2_OPS + 2];"
+    f.puts "VTPARSE_TABLE_DECL const char *const ACTION_NAMES[#{$actions_in_order.length+1}];"
+    f.puts "VTPARSE_TABLE_DECL const char *const STATE_NAMES[#{$states_in_order.length+1}];"
     f.puts
     f.puts "#ifdef __cplusplus"
     f.puts "}"
@@ -67,21 +182,21 @@ File.open(tar_cfile, "w") { |f|
     f.puts
     f.puts '#include <vtparse/vtparse_table.h>'
     f.puts
-    f.puts "char *ACTION_NAMES[] = {"
+    f.puts "VTPARSE_TABLE_DEF const char *const ACTION_NAMES[] = {"
     f.puts "   \"<no action>\","
     $actions_in_order.each { |action|
         f.puts "   \"#{action.to_s.upcase}\","
     }
     f.puts "};"
     f.puts
-    f.puts "char *STATE_NAMES[] = {"
+    f.puts "VTPARSE_TABLE_DEF const char *const STATE_NAMES[] = {"
     f.puts "   \"<no state>\","
     $states_in_order.each { |state|
         f.puts "   \"#{state.to_s}\","
     }
     f.puts "};"
     f.puts
-    f.puts "vtparse_state_change_t STATE_TABLE[#{$states_in_order.length}][256] = {"
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const vtparse_state_change_t STATE_TABLE[#{$states_in_order.length}][256] = {"
     $states_in_order.each_with_index { |state, i|
         f.puts "  {  /* VTPARSE_STATE_#{state.to_s.upcase} = #{i} */"
         $state_tables[state].each_with_index { |state_change, i|
@@ -100,7 +215,7 @@ File.open(tar_cfile, "w") { |f|
 
     f.puts "};"
     f.puts
-    f.puts "vtparse_action_t ENTRY_ACTIONS[] = {"
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char ENTRY_ACTIONS[] = {"
     $states_in_order.each { |state|
         actions = $states[state]
         if actions[:on_entry]
@@ -111,7 +226,7 @@ File.open(tar_cfile, "w") { |f|
     }
     f.puts "};"
     f.puts
-    f.puts "vtparse_action_t EXIT_ACTIONS[] = {"
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char EXIT_ACTIONS[] = {"
     $states_in_order.each { |state|
         actions = $states[state]
         if actions[:on_exit]
@@ -122,9 +237,41 @@ File.open(tar_cfile, "w") { |f|
     }
     f.puts "};"
     f.puts
-    f.puts "#ifdef __cplusplus"
-    f.puts "}"
-    f.puts "#endif"
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const vtparse_run_class_t RUN_CLASSES[] = {"
+    $states_in_order.each { |state|
+        (action, ranges) = run_class(state)
+        if not action or ranges.length == 0
+            f.puts "   {0, 0, {0}, {0}}, /* #{state} */"
+        else
+            lo = ranges.map { |r| "0x%02x" % r[0] }.join(", ")
+            hi = ranges.map { |r| "0x%02x" % r[1] }.join(", ")
+            f.puts "   {VTPARSE_ACTION_#{action.to_s.upcase}, #{ranges.length}, {#{lo}}, {#{hi}}}, /* #{state} */"
+        end
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char BYTE_CLASSES[] = {"
+    $byte_classes.each_slice(16).with_index { |row, i|
+        f.puts "/*#{"%02x" % (i * 16)}*/ #{row.map { |c| "%2d," % c }.join(" ")}"
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_TABLE[#{$states_in_order.length}][VTPARSE_NUM_CLASSES][VTPARSE_NUM_CLASSES] = {"
+    $states_in_order.each_with_index { |state, i|
+        f.puts "  {  /* VTPARSE_STATE_#{state.to_s.upcase} = #{i} */"
+        $stride2_table[i].each_with_index { |row, c|
+            f.puts "    {#{row.map { |e| "%2d" % e }.join(",")}}, /* #{c} */"
+        }
+        f.puts "  },"
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_OPS[#{$stride2_ops.length}][VTPARSE_MAX_STRIDE2_OPS + 2] = {"
+    $stride2_ops.each { |entry|
+        entry ||= [0, 0]
+        f.puts "   {#{entry.map { |o| "0x%02x" % o }.join(", ")}},"
+    }
+    f.puts "};"
 }
 
 puts "Wrote #{tar_cfile}"
@@ -0,0 +1,163 @@
+#!/usr/bin/env ruby
+
+# Generates the lookup tables for grapheme cluster segmentation (Unicode
+# Standard Annex #29) from the Unicode Character Database. Usage (from the
+# vtparse directory):
+#
+#     ruby ../tables/vtparse_gen_grapheme_tables.rb <UCD DIRECTORY>
+#
+# where the UCD directory contains GraphemeBreakProperty.txt and
+# emoji-data.txt (possibly in the "auxiliary" and "emoji" subdirectories).
+
+require_relative 'vtparse_ucd'
+
+# Number of code points per block of the second stage; the classes of a block
+# are packed into 128 bytes. Smaller blocks compress worse, since the first
+# stage grows faster than the number of distinct blocks shrinks.
+$block_bits = 8
+$block_size = 1 << $block_bits
+$num_code_points = 0x110000
+
+# Grapheme break classes in the order of their numeric value. Extended
+# pictographic characters are all of class "Other" and get a class of their
+# own. The "sot" class marks the start of the text.
+$classes = [:other, :cr, :lf, :control, :extend, :zwj, :regional_indicator,
+            :prepend, :spacing_mark, :l, :v, :t, :lv, :lvt,
+            :extended_pictographic, :sot]
+
+# Pairs of classes without a boundary in between (rules GB3 to GB9b). The
+# rules GB11 to GB13 depend on more than the preceding character and are
+# implemented in vtparse_grapheme.c.
+$no_break = [
+    [[:cr], [:lf]],                                           # GB3
+    [[:l], [:l, :v, :lv, :lvt]],                              # GB6
+    [[:lv, :v], [:v, :t]],                                    # GB7
+    [[:lvt, :t], [:t]],                                       # GB8
+    [$classes - [:cr, :lf, :control, :sot], [:extend, :zwj]], # GB9
+    [$classes - [:cr, :lf, :control, :sot], [:spacing_mark]], # GB9a
+    [[:prepend], $classes - [:cr, :lf, :control, :sot]],      # GB9b
+]
+
+ucd_dir = ARGV[0] or raise "Usage: #{$0} <UCD DIRECTORY>"
+
+$props = Array.new($num_code_points, $classes.index(:other))
+
+each_ucd_range(ucd_file(ucd_dir, "GraphemeBreakProperty.txt", "auxiliary")) { |range, value|
+    cls = value.gsub(/([a-z])([A-Z])/, '\1_\2').downcase.to_sym
+    raise "Unknown grapheme break class #{value}" unless $classes.include?(cls)
+    range.each { |cp| $props[cp] = $classes.index(cls) }
+}
+
+each_ucd_range(ucd_file(ucd_dir, "emoji-data.txt", "emoji")) { |range, value|
+    next unless value == "Extended_Pictographic"
+    range.each { |cp|
+        if $props[cp] != $classes.index(:other)
+            raise "Extended pictographic U+#{"%04X" % cp} is not of class Other"
+        end
+        $props[cp] = $classes.index(:extended_pictographic)
+    }
+}
+
+# Pack the classes with four bits per code point and deduplicate the blocks
+blocks = []
+block_index = {}
+stage1 = []
+$props.each_slice($block_size) { |slice|
+    bytes = slice.each_slice(2).map { |c| c[0] | (c[1] << 4) }
+    unless block_index[bytes]
+        block_index[bytes] = blocks.length
+        blocks << bytes
+    end
+    stage1 << block_index[bytes]
+}
+raise "Too many distinct blocks" if blocks.length > 256
+
+# One bit mask of following classes without a boundary per preceding class
+no_break = $classes.map { |prev|
+    $classes.each_with_index.inject(0) { |mask, (cur, i)|
+        hit = $no_break.any? { |a, b| a.include?(prev) and b.include?(cur) }
+        hit ? (mask | (1 << i)) : mask
+    }
+}
+
+tar_hfile = "vtparse_grapheme_table.h"
+tar_cfile = "vtparse_grapheme_table.c"
+
+File.open(tar_hfile, "w") { |f|
+    f.puts "/******************************************************************************"
+    f.puts " * Note: This file was automatically generated. Please execute                *"
+    f.puts " * tables/vtparse_gen_grapheme_tables.rb to re-generate this file.            *"
+    f.puts " ******************************************************************************/"
+    f.puts
+    f.puts "#ifndef VTPARSE_VTPARSE_GRAPHEME_TABLE_H"
+    f.puts "#define VTPARSE_VTPARSE_GRAPHEME_TABLE_H"
+    f.puts
+    f.puts "#include <vtparse/vtparse_table_decl.h>"
+    f.puts
+    f.puts "#ifdef __cplusplus"
+    f.puts "extern \"C\" {"
+    f.puts "#endif"
+    f.puts
+    f.puts "typedef enum {"
+    $classes.each_with_index { |cls, i|
+        f.puts "   VTPARSE_GRAPHEME_#{cls.to_s.upcase} = #{i},"
+    }
+    f.puts "} vtparse_grapheme_class_t;"
+    f.puts
+    f.puts "/* Grapheme break classes of all code points, Unicode #{$ucd_version}. The first"
+    f.puts "   stage maps bits #{$block_bits} to 20 of a code point to a block of the second stage;"
+    f.puts "   each block holds the classes of #{$block_size} code points, packed with four bits"
+    f.puts "   per code point, least significant bits first. */"
+    f.puts "#define VTPARSE_GRAPHEME_UNICODE_VERSION \"#{$ucd_version}\""
+    f.puts "#define VTPARSE_GRAPHEME_BLOCK_BITS #{$block_bits}"
+    f.puts "#define VTPARSE_GRAPHEME_NUM_BLOCKS #{blocks.length}"
+    f.puts
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char GRAPHEME_STAGE1[#{stage1.length}];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char GRAPHEME_STAGE2[#{blocks.length}][#{$block_size / 2}];"
+    f.puts
+    f.puts "/* Bit i of GRAPHEME_NO_BREAK[c] is set if there is no boundary between a"
+    f.puts "   character of class c and a following character of class i. */"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned short GRAPHEME_NO_BREAK[#{$classes.length}];"
+    f.puts
+    f.puts "#ifdef __cplusplus"
+    f.puts "}"
+    f.puts "#endif"
+    f.puts
+    f.puts "#endif /* VTPARSE_VTPARSE_GRAPHEME_TABLE_H */"
+    f.puts
+}
+
+puts "Wrote #{tar_hfile}"
+
+File.open(tar_cfile, "w") { |f|
+    f.puts "/******************************************************************************"
+    f.puts " * Note: This file was automatically generated. Please execute                *"
+    f.puts " * tables/vtparse_gen_grapheme_tables.rb to re-generate this file.            *"
+    f.puts " ******************************************************************************/"
+    f.puts
+    f.puts '#include <vtparse/vtparse_grapheme_table.h>'
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char GRAPHEME_STAGE1[] = {"
+    stage1.each_slice(16).with_index { |row, i|
+        f.puts "/*#{("%05x" % (i << (4 + $block_bits)))}*/ #{row.map { |b| "%3d," % b }.join(" ")}"
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char GRAPHEME_STAGE2[][#{$block_size / 2}] = {"
+    blocks.each_with_index { |bytes, i|
+        f.puts "  {  /* #{i} */"
+        bytes.each_slice(16) { |row|
+            f.puts "    #{row.map { |b| "0x%02x," % b }.join(" ")}"
+        }
+        f.puts "  },"
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned short GRAPHEME_NO_BREAK[] = {"
+    $classes.each_with_index { |cls, i|
+        f.puts "   0x%04x, /* #{cls.to_s.upcase} */" % no_break[i]
+    }
+    f.puts "};"
+}
+
+puts "Wrote #{tar_cfile}"
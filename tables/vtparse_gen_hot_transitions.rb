@@ -0,0 +1,176 @@
+#!/usr/bin/env ruby
+
+# Generates the transitions that vtparse_parse() performs inline, without
+# going through the exit, transition and entry action cycles of the state
+# machine, from a transition frequency profile recorded with the
+# vtparse_profile example. Usage (from the vtparse directory):
+#
+#     ./vtparse_profile <CORPUS FILES> > ../tables/vtparse_profile.txt
+#     ruby ../tables/vtparse_gen_hot_transitions.rb [PROFILE]
+#
+# where the profile defaults to tables/vtparse_profile.txt. Only transitions
+# whose actions never return to the user can be inlined. Of these, the byte
+# ranges accounting for at least $min_share of the profiled bytes are checked
+# first, most frequent first; all others are left to the generic table-driven
+# code.
+
+require_relative 'vtparse_tables'
+
+# Actions that only update the collected parameters and intermediate
+# characters
+$internal_actions = [:clear, :collect, :ignore, :param]
+
+# Maximum number of inlined byte ranges
+$max_hot = 24
+
+# Minimum share of the profiled bytes a byte range must account for to be
+# inlined; rarer transitions are left to the generic table-driven code
+$min_share = 0.001
+
+# Returns a hash mapping [state, byte] to the number of times the byte was
+# read in the state
+def read_profile(path)
+    profile = Hash.new(0)
+    File.foreach(path) { |line|
+        line = line.sub(/#.*/, "").strip
+        next if line.empty?
+        state, byte, count = line.split(/\s+/)
+        state = state.to_sym
+        raise "Unknown state \"#{state}\"" unless $states[state]
+        profile[[state, Integer(byte)]] += Integer(count)
+    }
+    profile
+end
+
+# Returns the transition for the given byte in the given state as a pair of
+# action and target state, or nil if the transition cannot be inlined
+def hot_transition(state, byte)
+    transition = $state_tables[state][byte]
+    return nil unless transition
+    (action,) = transition.find_all { |s| s.kind_of?(Symbol) }
+    (target,) = transition.find_all { |s| s.kind_of?(StateTransition) }
+    target = target.to_state if target
+    return nil unless action or target
+    actions = [action]
+    actions += [$states[state][:on_exit], $states[target][:on_entry]] if target
+    return nil unless actions.all? { |a| a.nil? or $internal_actions.include?(a) }
+    [action, target]
+end
+
+# Formats a list of bytes as a C condition on "ch"
+def condition(bytes)
+    ranges = []
+    bytes.sort.each { |b|
+        if ranges.length > 0 and ranges[-1][1] == b - 1
+            ranges[-1][1] = b
+        else
+            ranges << [b, b]
+        end
+    }
+    terms = ranges.map { |(lo, hi)|
+        if lo == hi
+            "ch == 0x%02x" % lo
+        else
+            "ch >= 0x%02x && ch <= 0x%02x" % [lo, hi]
+        end
+    }
+    return terms[0] if terms.length == 1
+    terms.map { |t| t.include?("&&") ? "(#{t})" : t }.join(" ||\n\t\t\t    ")
+end
+
+profile_file = ARGV[0] || File.join(__dir__, "vtparse_profile.txt")
+profile = read_profile(profile_file)
+total = [profile.values.sum, 1].max
+
+# Split the bytes of each state into ranges of consecutive bytes with the same
+# transition and select the most frequent ranges. Each range is selected on
+# its own count, such that rare bytes are not inlined merely because they
+# share the transition of a frequent one.
+ranges = []
+$states_in_order.each { |state|
+    (0..255).each { |byte|
+        transition = hot_transition(state, byte)
+        next unless transition
+        last = ranges[-1]
+        if last and last[:state] == state and last[:transition] == transition and
+           last[:bytes][-1] == byte - 1
+            last[:bytes] << byte
+        else
+            ranges << {:state => state, :transition => transition, :bytes => [byte]}
+            last = ranges[-1]
+        end
+    }
+}
+ranges.each { |r|
+    r[:count] = r[:bytes].map { |byte| profile[[r[:state], byte]] }.sum
+}
+ranges = ranges.select { |r| r[:count] > 0 and r[:count] >= $min_share * total }
+ranges = ranges.sort_by { |r| -r[:count] }.first($max_hot)
+
+# Merge the selected ranges of a state sharing the same transition into a
+# single condition
+groups = Hash.new { |h, k| h[k] = {:bytes => [], :count => 0} }
+ranges.each { |r|
+    group = groups[[r[:state], r[:transition]]]
+    group[:bytes] += r[:bytes]
+    group[:count] += r[:count]
+}
+hot = groups.to_a.sort_by { |(_, g)| -g[:count] }
+
+# Order the states, and the transitions within each state, by frequency
+by_state = hot.group_by { |((state, _), _)| state }
+by_state = by_state.sort_by { |(_, gs)| -gs.map { |(_, g)| g[:count] }.sum }
+
+def percent(count, total)
+    "%.2f%%" % (100.0 * count / total)
+end
+
+tar_file = "vtparse_hot_transitions.h"
+
+File.open(tar_file, "w") { |f|
+    f.puts "/******************************************************************************"
+    f.puts " * Note: This file was automatically generated. Please execute                *"
+    f.puts " * tables/vtparse_gen_hot_transitions.rb to re-generate this file.            *"
+    f.puts " ******************************************************************************/"
+    f.puts
+    f.puts "/* Included by vtparse.c only. Generated from the profile of"
+    f.puts "   #{total} bytes in #{File.basename(profile_file)}; the inlined transitions"
+    f.puts "   cover #{percent(hot.map { |(_, g)| g[:count] }.sum, total)} of the profiled bytes. */"
+    f.puts
+    f.puts "#ifndef VTPARSE_VTPARSE_HOT_TRANSITIONS_H"
+    f.puts "#define VTPARSE_VTPARSE_HOT_TRANSITIONS_H"
+    f.puts
+    f.puts "/**"
+    f.puts " * Performs the transition for the character ch just read at pos[-1] if it"
+    f.puts " * is one of the inlined transitions. Returns zero if the transition must be"
+    f.puts " * performed by the generic code."
+    f.puts " */"
+    f.puts "static int vtparse_hot_transition(vtparse_t *parser, unsigned char ch,"
+    f.puts "                                  const unsigned char *pos) {"
+    f.puts "\tswitch (parser->priv_.state) {"
+    by_state.each { |(state, gs)|
+        f.puts "\t\tcase VTPARSE_STATE_#{state.to_s.upcase}: /* #{percent(gs.map { |(_, g)| g[:count] }.sum, total)} */"
+        gs.each { |((_, (action, target)), g)|
+            f.puts "\t\t\tif (#{condition(g[:bytes])}) { /* #{percent(g[:count], total)} */"
+            actions = [action]
+            actions = [$states[state][:on_exit], action, $states[target][:on_entry]] if target
+            actions.compact.each { |a|
+                next if a == :ignore
+                f.puts "\t\t\t\tvtparse_execute_action(parser, VTPARSE_ACTION_#{a.to_s.upcase}, ch, pos);"
+            }
+            if target
+                f.puts "\t\t\t\tvtparse_hot_enter(parser, VTPARSE_STATE_#{target.to_s.upcase}, pos);"
+            end
+            f.puts "\t\t\t\treturn 1;"
+            f.puts "\t\t\t}"
+        }
+        f.puts "\t\t\tbreak;"
+    }
+    f.puts "\t}"
+    f.puts "\treturn 0;"
+    f.puts "}"
+    f.puts
+    f.puts "#endif /* VTPARSE_VTPARSE_HOT_TRANSITIONS_H */"
+}
+
+puts "Wrote #{tar_file}"
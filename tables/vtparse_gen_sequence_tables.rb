@@ -0,0 +1,206 @@
+#!/usr/bin/env ruby
+
+# Generates the recognizer for frequent control sequences used by the
+# VTPARSE_OPTION_SEQUENCES option. Usage (from the vtparse directory):
+#
+#     ruby ../tables/vtparse_gen_sequence_tables.rb [SEQUENCE LIST]
+#
+# where the sequence list defaults to tables/vtparse_sequences.txt. The
+# sequences are compiled into a DFA over byte classes that is run on the bytes
+# following an ESC in the ground state.
+
+# Returns the list of [name, tokens] pairs in the given sequence list. A token
+# is either a byte or :num for an optional decimal parameter.
+def read_sequences(path)
+    sequences = []
+    File.foreach(path) { |line|
+        line = line.sub(/#.*/, "").strip
+        next if line.empty?
+        name, pattern = line.split(/\s+/, 2)
+        raise "Invalid sequence name \"#{name}\"" unless name =~ /\A[a-z][a-z0-9_]*\z/
+        raise "Missing pattern for \"#{name}\"" unless pattern
+        check_pattern(pattern.gsub("<n>", "0"), name)
+        tokens = pattern.split(/(<n>)/).flat_map { |s|
+            s == "<n>" ? [:num] : s.bytes
+        }
+        sequences << [name, tokens]
+    }
+    sequences
+end
+
+# The recognized sequences must take the path through the state machine
+# mirrored by vtparse_sequence_take() in vtparse.c: an escape sequence with
+# optional intermediate characters, or a CSI sequence with an optional private
+# marker, parameters and intermediate characters.
+def check_pattern(pattern, name)
+    csi = /\A\[[<=>?]?[0-9;]*[ -\/]*[@-~]\z/
+    esc = /\A[ -\/]*[0-~]\z/
+    return if pattern =~ csi
+    if pattern =~ esc and not (pattern.length == 1 and "PX[]^_".include?(pattern))
+        return
+    end
+    raise "Pattern \"#{pattern}\" of \"#{name}\" is not a complete ESC or CSI sequence"
+end
+
+def digit?(byte)
+    byte >= 0x30 and byte <= 0x39
+end
+
+# NFA states are pairs [sequence index, token index]; a :num token may be
+# skipped
+def closure(set, sequences)
+    todo = set.to_a
+    result = set.dup
+    while (s = todo.pop)
+        (i, j) = s
+        if sequences[i][1][j] == :num and not result.include?([i, j + 1])
+            result << [i, j + 1]
+            todo << [i, j + 1]
+        end
+    end
+    result
+end
+
+def accepts?(token, byte)
+    token == byte or (token == :num and digit?(byte))
+end
+
+def step(set, byte, sequences)
+    next_set = []
+    set.each { |(i, j)|
+        token = sequences[i][1][j]
+        next unless token and accepts?(token, byte)
+        next_set << (token == :num ? [i, j] : [i, j + 1])
+    }
+    closure(next_set.uniq.sort, sequences).uniq.sort
+end
+
+seq_file = ARGV[0] || File.join(__dir__, "vtparse_sequences.txt")
+sequences = read_sequences(seq_file)
+names = sequences.map { |(name, _)| name }.uniq
+
+# Bytes that are accepted by the same set of NFA states share a class; class 0
+# holds all bytes that do not occur in any sequence
+positions = sequences.each_with_index.flat_map { |(_, tokens), i|
+    (0...tokens.length).map { |j| [i, j] }
+}
+signatures = (0..255).map { |b|
+    positions.select { |(i, j)| accepts?(sequences[i][1][j], b) }
+}
+class_of = {[] => 0}
+byte_classes = signatures.map { |sig| class_of[sig] ||= class_of.length }
+class_bytes = Array.new(class_of.length) { |c| byte_classes.index(c) }
+
+# Subset construction; DFA state 0 rejects, state 1 is the initial state
+start = closure(sequences.each_index.map { |i| [i, 0] }, sequences).uniq.sort
+dfa_states = [nil, start]
+dfa_index = {start => 1}
+transitions = [Array.new(class_of.length, 0)]
+accept = [0]
+i = 1
+while i < dfa_states.length
+    set = dfa_states[i]
+    done = set.select { |(k, j)| j == sequences[k][1].length }
+    ids = done.map { |(k, _)| names.index(sequences[k][0]) + 1 }.uniq
+    raise "Ambiguous sequences #{ids.map { |id| names[id - 1] }}" if ids.length > 1
+    if ids.length > 0 and done.length != set.length
+        raise "Sequence #{names[ids[0] - 1]} is a prefix of another sequence"
+    end
+    accept << (ids[0] || 0)
+    transitions << class_bytes.each_with_index.map { |b, c|
+        next 0 if c == 0
+        target = step(set, b, sequences)
+        next 0 if target.empty?
+        unless dfa_index[target]
+            dfa_index[target] = dfa_states.length
+            dfa_states << target
+        end
+        dfa_index[target]
+    }
+    i += 1
+end
+raise "Too many DFA states" if dfa_states.length > 256
+
+tar_hfile = "vtparse_sequence_table.h"
+tar_cfile = "vtparse_sequence_table.c"
+
+File.open(tar_hfile, "w") { |f|
+    f.puts "/******************************************************************************"
+    f.puts " * Note: This file was automatically generated. Please execute                *"
+    f.puts " * tables/vtparse_gen_sequence_tables.rb to re-generate this file.            *"
+    f.puts " ******************************************************************************/"
+    f.puts
+    f.puts "#ifndef VTPARSE_VTPARSE_SEQUENCE_TABLE_H"
+    f.puts "#define VTPARSE_VTPARSE_SEQUENCE_TABLE_H"
+    f.puts
+    f.puts "#include <vtparse/vtparse_table_decl.h>"
+    f.puts
+    f.puts "#ifdef __cplusplus"
+    f.puts "extern \"C\" {"
+    f.puts "#endif"
+    f.puts
+    f.puts "typedef enum {"
+    f.puts "   VTPARSE_SEQUENCE_NONE = 0,"
+    names.each_with_index { |name, i|
+        f.puts "   VTPARSE_SEQUENCE_#{name.upcase} = #{i + 1},"
+    }
+    f.puts "} vtparse_sequence_t;"
+    f.puts
+    f.puts "/* DFA recognizing the sequences following an ESC. SEQUENCE_CLASSES maps"
+    f.puts "   bytes to the columns of SEQUENCE_DFA; state 0 rejects the input and"
+    f.puts "   state 1 is the initial state. SEQUENCE_ACCEPT holds the sequence"
+    f.puts "   recognized upon entering a state, or VTPARSE_SEQUENCE_NONE. */"
+    f.puts "#define VTPARSE_SEQUENCE_NUM_STATES #{dfa_states.length}"
+    f.puts "#define VTPARSE_SEQUENCE_NUM_CLASSES #{class_of.length}"
+    f.puts
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_CLASSES[256];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_DFA[#{dfa_states.length}][#{class_of.length}];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_ACCEPT[#{dfa_states.length}];"
+    f.puts "VTPARSE_TABLE_DECL const char *const SEQUENCE_NAMES[#{names.length + 1}];"
+    f.puts
+    f.puts "#ifdef __cplusplus"
+    f.puts "}"
+    f.puts "#endif"
+    f.puts
+    f.puts "#endif /* VTPARSE_VTPARSE_SEQUENCE_TABLE_H */"
+    f.puts
+}
+
+puts "Wrote #{tar_hfile}"
+
+File.open(tar_cfile, "w") { |f|
+    f.puts "/******************************************************************************"
+    f.puts " * Note: This file was automatically generated. Please execute                *"
+    f.puts " * tables/vtparse_gen_sequence_tables.rb to re-generate this file.            *"
+    f.puts " ******************************************************************************/"
+    f.puts
+    f.puts '#include <vtparse/vtparse_sequence_table.h>'
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF const char *const SEQUENCE_NAMES[] = {"
+    f.puts "   \"<no sequence>\","
+    names.each { |name|
+        f.puts "   \"#{name.upcase}\","
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_CLASSES[] = {"
+    byte_classes.each_slice(16).with_index { |row, i|
+        f.puts "/*#{"%02x" % (i * 16)}*/ #{row.map { |c| "%2d," % c }.join(" ")}"
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_DFA[][#{class_of.length}] = {"
+    transitions.each_with_index { |row, i|
+        f.puts "   {#{row.map { |s| "%2d" % s }.join(", ")}}, /* #{i} */"
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_ACCEPT[] = {"
+    accept.each_with_index { |id, i|
+        label = id > 0 ? "VTPARSE_SEQUENCE_#{names[id - 1].upcase}" : "VTPARSE_SEQUENCE_NONE"
+        f.puts "   #{label}, /* #{i} */"
+    }
+    f.puts "};"
+}
+
+puts "Wrote #{tar_cfile}"
@@ -0,0 +1,127 @@
+#!/usr/bin/env ruby
+
+# Generates the two-level lookup table for the column width of code points
+# from the Unicode Character Database. Usage (from the vtparse directory):
+#
+#     ruby ../tables/vtparse_gen_width_tables.rb <UCD DIRECTORY>
+#
+# where the UCD directory contains EastAsianWidth.txt and
+# DerivedGeneralCategory.txt (possibly in the "extracted" subdirectory).
+
+require_relative 'vtparse_ucd'
+
+# Number of code points per block of the second stage; the widths of a block
+# are packed into 64 bytes, i.e. a single cache line
+$block_bits = 8
+$block_size = 1 << $block_bits
+$num_code_points = 0x110000
+
+# Format characters that are visible nonetheless: the soft hyphen and the
+# prepended concatenation marks
+$visible_format = [0x00AD, 0x0600..0x0605, 0x06DD, 0x070F, 0x0890..0x0891,
+                   0x08E2, 0x110BD, 0x110CD]
+
+# Hangul Jamo medial vowels and final consonants combine with the preceding
+# initial consonant
+$conjoining_jamo = [0x1160..0x11FF, 0xD7B0..0xD7FF]
+
+ucd_dir = ARGV[0] or raise "Usage: #{$0} <UCD DIRECTORY>"
+
+# Default width is one column
+$widths = Array.new($num_code_points, 1)
+
+# Wide and fullwidth characters
+each_ucd_range(ucd_file(ucd_dir, "EastAsianWidth.txt", "extracted")) { |range, value|
+    w = (value == "W" or value == "F") ? 2 : 1
+    range.each { |cp| $widths[cp] = w }
+}
+
+# Combining marks, format and control characters take no space
+each_ucd_range(ucd_file(ucd_dir, "DerivedGeneralCategory.txt", "extracted")) { |range, value|
+    next unless ["Mn", "Me", "Cf", "Cc"].include?(value)
+    range.each { |cp| $widths[cp] = 0 }
+}
+$conjoining_jamo.each { |range| range.each { |cp| $widths[cp] = 0 } }
+$visible_format.each { |cps| Array(cps).each { |cp| $widths[cp] = 1 } }
+
+# Pack the widths with two bits per code point and deduplicate the blocks
+blocks = []
+block_index = {}
+stage1 = []
+$widths.each_slice($block_size) { |slice|
+    bytes = slice.each_slice(4).map { |w|
+        w[0] | (w[1] << 2) | (w[2] << 4) | (w[3] << 6)
+    }
+    unless block_index[bytes]
+        block_index[bytes] = blocks.length
+        blocks << bytes
+    end
+    stage1 << block_index[bytes]
+}
+raise "Too many distinct blocks" if blocks.length > 256
+
+tar_hfile = "vtparse_width_table.h"
+tar_cfile = "vtparse_width_table.c"
+
+File.open(tar_hfile, "w") { |f|
+    f.puts "/******************************************************************************"
+    f.puts " * Note: This file was automatically generated. Please execute                *"
+    f.puts " * tables/vtparse_gen_width_tables.rb to re-generate this file.               *"
+    f.puts " ******************************************************************************/"
+    f.puts
+    f.puts "#ifndef VTPARSE_VTPARSE_WIDTH_TABLE_H"
+    f.puts "#define VTPARSE_VTPARSE_WIDTH_TABLE_H"
+    f.puts
+    f.puts "#include <vtparse/vtparse_table_decl.h>"
+    f.puts
+    f.puts "#ifdef __cplusplus"
+    f.puts "extern \"C\" {"
+    f.puts "#endif"
+    f.puts
+    f.puts "/* Column widths (0, 1 or 2) of all code points, Unicode #{$ucd_version}. The"
+    f.puts "   first stage maps bits 8 to 20 of a code point to a block of the second"
+    f.puts "   stage; each block holds the widths of 256 code points, packed with two"
+    f.puts "   bits per code point, least significant bits first. */"
+    f.puts "#define VTPARSE_WIDTH_UNICODE_VERSION \"#{$ucd_version}\""
+    f.puts "#define VTPARSE_WIDTH_BLOCK_BITS #{$block_bits}"
+    f.puts "#define VTPARSE_WIDTH_NUM_BLOCKS #{blocks.length}"
+    f.puts
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char WIDTH_STAGE1[#{stage1.length}];"
+    f.puts "VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char WIDTH_STAGE2[#{blocks.length}][#{$block_size / 4}];"
+    f.puts
+    f.puts "#ifdef __cplusplus"
+    f.puts "}"
+    f.puts "#endif"
+    f.puts
+    f.puts "#endif /* VTPARSE_VTPARSE_WIDTH_TABLE_H */"
+    f.puts
+}
+
+puts "Wrote #{tar_hfile}"
+
+File.open(tar_cfile, "w") { |f|
+    f.puts "/******************************************************************************"
+    f.puts " * Note: This file was automatically generated. Please execute                *"
+    f.puts " * tables/vtparse_gen_width_tables.rb to re-generate this file.               *"
+    f.puts " ******************************************************************************/"
+    f.puts
+    f.puts '#include <vtparse/vtparse_width_table.h>'
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char WIDTH_STAGE1[] = {"
+    stage1.each_slice(16).with_index { |row, i|
+        f.puts "/*#{("%05x" % (i << (4 + $block_bits)))}*/ #{row.map { |b| "%3d," % b }.join(" ")}"
+    }
+    f.puts "};"
+    f.puts
+    f.puts "VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char WIDTH_STAGE2[][#{$block_size / 4}] = {"
+    blocks.each_with_index { |bytes, i|
+        f.puts "  {  /* #{i} */"
+        bytes.each_slice(16) { |row|
+            f.puts "    #{row.map { |b| "0x%02x," % b }.join(" ")}"
+        }
+        f.puts "  },"
+    }
+    f.puts "};"
+}
+
+puts "Wrote #{tar_cfile}"
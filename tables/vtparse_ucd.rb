@@ -0,0 +1,42 @@
+# Access to the Unicode Character Database, shared by the generators of the
+# column width and grapheme break tables. Both tables must be generated from
+# the same UCD release, such that the width of a PRINT span and its grapheme
+# clusters agree.
+
+# Release of the Unicode Character Database all tables are generated from.
+# Update this when moving to a new release and re-run both generators.
+$ucd_version = "15.0.0"
+
+# Returns the path of the given UCD file, which may also be located in the
+# given subdirectory (e.g. "extracted", "auxiliary" or "emoji")
+def ucd_file(dir, name, subdir)
+    [File.join(dir, name), File.join(dir, subdir, name)].each { |path|
+        return path if File.exist?(path)
+    }
+    raise "Cannot find #{name} in #{dir}"
+end
+
+# Calls the block for each range and value listed in the given UCD file;
+# "@missing" lines are reported first. Fails if the file does not belong to
+# the release $ucd_version; the emoji files only state major and minor
+# version.
+def each_ucd_range(path)
+    version = nil
+    File.foreach(path) { |line|
+        version ||= line[/-(\d+\.\d+(?:\.\d+)?)\.txt/, 1]
+        version ||= line[/^#\s*Version:?\s*(\d+\.\d+(?:\.\d+)?)/, 1]
+        line = line.sub(/^#\s*@missing:/, "")
+        line = line.sub(/#.*/, "").strip
+        next if line.empty?
+        m = line.match(/^([0-9A-F]+)(?:\.\.([0-9A-F]+))?\s*;\s*(\w+)/)
+        raise "Cannot parse \"#{line}\" in #{path}" unless m
+        lo = m[1].to_i(16)
+        hi = (m[2] || m[1]).to_i(16)
+        yield(lo..hi, m[3])
+    }
+    raise "Cannot determine the Unicode version of #{path}" unless version
+    unless version.split(".")[0, 2] == $ucd_version.split(".")[0, 2] and
+           (version.count(".") < 2 or version == $ucd_version)
+        raise "#{path} belongs to Unicode #{version}, expected #{$ucd_version}"
+    end
+end
@@ -516,12 +516,909 @@ void test_dcs_hook_unhook() {
 	EXPECT_FALSE(vtparse_has_event(&parser));
 }
 
+void test_intermediate_csi_invalid_3() {
+	const unsigned char buf[] = "X\e[??25hABC";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+
+	EXPECT_EQ(8, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf, parser.data_begin);
+	EXPECT_EQ(buf + 1, parser.data_end);
+
+	EXPECT_EQ(3, vtparse_parse(&parser, buf + 8, buf_len - 8));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf + 8, parser.data_begin);
+	EXPECT_EQ(buf + 11, parser.data_end);
+
+	EXPECT_EQ(0U, vtparse_parse(&parser, NULL, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_execute_in_csi_at_end() {
+	const unsigned char buf[] = "\e[1\n2";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+
+	EXPECT_EQ(4, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_EXECUTE, parser.action);
+	EXPECT_EQ('\n', parser.ch);
+
+	EXPECT_EQ(1, vtparse_parse(&parser, buf + 4, buf_len - 4));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_dcs_ignore_in_put() {
+	const unsigned char buf[] = "\ePq12\x7f" "34\e\\";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+
+	EXPECT_EQ(3, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_EQ(VTPARSE_ACTION_HOOK, parser.action);
+
+	EXPECT_EQ(3, vtparse_parse(&parser, buf + 3, buf_len - 3));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PUT, parser.action);
+	EXPECT_EQ(buf + 3, parser.data_begin);
+	EXPECT_EQ(buf + 5, parser.data_end);
+
+	EXPECT_EQ(3, vtparse_parse(&parser, buf + 6, buf_len - 6));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PUT, parser.action);
+	EXPECT_EQ(buf + 6, parser.data_begin);
+	EXPECT_EQ(buf + 8, parser.data_end);
+
+	EXPECT_EQ(0, vtparse_parse(&parser, buf + 9, buf_len - 9));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_UNHOOK, parser.action);
+}
+
+void test_event_mask_execute() {
+	const unsigned char buf[] = "Hello\nWorld\e[1m";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+	vtparse_set_event_mask(&parser,
+	                       VTPARSE_EVENT_MASK(VTPARSE_ACTION_PRINT) |
+	                           VTPARSE_EVENT_MASK(VTPARSE_ACTION_CSI_DISPATCH));
+
+	/* The pending data is returned before the line break is consumed */
+	EXPECT_EQ(6, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf, parser.data_begin);
+	EXPECT_EQ(buf + 5, parser.data_end);
+
+	EXPECT_EQ(9, vtparse_parse(&parser, buf + 6, buf_len - 6));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf + 6, parser.data_begin);
+	EXPECT_EQ(buf + 11, parser.data_end);
+
+	EXPECT_EQ(0, vtparse_parse(&parser, buf + 15, buf_len - 15));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(1, parser.params[0]);
+
+	EXPECT_EQ(0U, vtparse_parse(&parser, NULL, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_event_mask_osc() {
+	const unsigned char buf[] = "Hello\n\e[1m\e]0;Title\aWorld\n";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+	vtparse_set_event_mask(&parser,
+	                       VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_PUT) |
+	                           VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_END));
+
+	EXPECT_EQ(20, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_OSC_PUT, parser.action);
+	EXPECT_EQ(buf + 12, parser.data_begin);
+	EXPECT_EQ(buf + 19, parser.data_end);
+
+	EXPECT_EQ(0, vtparse_parse(&parser, buf + 20, buf_len - 20));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_OSC_END, parser.action);
+
+	EXPECT_EQ(6, vtparse_parse(&parser, buf + 20, buf_len - 20));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_line_spans() {
+	const unsigned char buf[] = "Hello\nWorld\r\n\tX\e[1\n2m\n";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+	vtparse_set_options(&parser, VTPARSE_OPTION_LINE_SPANS);
+
+	EXPECT_EQ(19, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf, parser.data_begin);
+	EXPECT_EQ(buf + 15, parser.data_end);
+	EXPECT_EQ(2, parser.num_line_breaks);
+
+	/* Line breaks inside control sequences are still executed */
+	EXPECT_EQ(0, vtparse_parse(&parser, buf + 19, buf_len - 19));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_EXECUTE, parser.action);
+	EXPECT_EQ('\n', parser.ch);
+
+	EXPECT_EQ(2, vtparse_parse(&parser, buf + 19, buf_len - 19));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(12, parser.params[0]);
+
+	EXPECT_EQ(1, vtparse_parse(&parser, buf + 21, buf_len - 21));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf + 21, parser.data_begin);
+	EXPECT_EQ(buf + 22, parser.data_end);
+	EXPECT_EQ(1, parser.num_line_breaks);
+
+	EXPECT_EQ(0U, vtparse_parse(&parser, NULL, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_lazy_params() {
+	const unsigned char buf[] = "\e[?38;5;123m\e[1\x7f" "2m";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+	vtparse_set_options(&parser, VTPARSE_OPTION_LAZY_PARAMS);
+
+	EXPECT_EQ(12, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(1, parser.num_intermediate_chars);
+	EXPECT_EQ(0, parser.num_params);
+	EXPECT_EQ(buf + 3, parser.param_begin);
+	EXPECT_EQ(buf + 11, parser.param_end);
+
+	vtparse_decode_params(&parser);
+	EXPECT_EQ(NULL, parser.param_begin);
+	EXPECT_EQ(3, parser.num_params);
+	EXPECT_EQ(38, parser.params[0]);
+	EXPECT_EQ(5, parser.params[1]);
+	EXPECT_EQ(123, parser.params[2]);
+
+	/* Decoding twice has no effect */
+	vtparse_decode_params(&parser);
+	EXPECT_EQ(3, parser.num_params);
+
+	/* Non-contiguous parameters are decoded eagerly */
+	EXPECT_EQ(6, vtparse_parse(&parser, buf + 12, buf_len - 12));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(NULL, parser.param_begin);
+	EXPECT_EQ(1, parser.num_params);
+	EXPECT_EQ(12, parser.params[0]);
+
+	EXPECT_EQ(0U, vtparse_parse(&parser, NULL, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_lazy_params_straddle() {
+	const unsigned char buf1[] = "\e[38;5";
+	const size_t buf1_len = sizeof(buf1) - 1U;
+	const unsigned char buf2[] = ";123mA\e[4;2H";
+	const size_t buf2_len = sizeof(buf2) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+	vtparse_set_options(&parser, VTPARSE_OPTION_LAZY_PARAMS);
+
+	EXPECT_EQ(buf1_len, vtparse_parse(&parser, buf1, buf1_len));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+
+	EXPECT_EQ(5, vtparse_parse(&parser, buf2, buf2_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(NULL, parser.param_begin);
+	EXPECT_EQ(3, parser.num_params);
+	EXPECT_EQ(38, parser.params[0]);
+	EXPECT_EQ(5, parser.params[1]);
+	EXPECT_EQ(123, parser.params[2]);
+
+	/* Parameters following pending data are decoded eagerly */
+	EXPECT_EQ(7, vtparse_parse(&parser, buf2 + 5, buf2_len - 5));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+
+	EXPECT_EQ(0, vtparse_parse(&parser, buf2 + 12, buf2_len - 12));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ('H', parser.ch);
+	EXPECT_EQ(NULL, parser.param_begin);
+	EXPECT_EQ(2, parser.num_params);
+	EXPECT_EQ(4, parser.params[0]);
+	EXPECT_EQ(2, parser.params[1]);
+
+	EXPECT_EQ(0U, vtparse_parse(&parser, NULL, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_max_params() {
+	const unsigned char buf[] =
+	    "\e[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16m"
+	    "\e[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17m";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+
+	EXPECT_EQ(41, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(16, parser.num_params);
+	EXPECT_EQ(16, parser.params[15]);
+
+	EXPECT_EQ(44, vtparse_parse(&parser, buf + 41, buf_len - 41));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_arena() {
+	const unsigned char buf[] =
+	    "\e[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17;18;19;20m"
+	    "\e(%!0"
+	    "\e[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17;18;19;20;21;22m";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	int arena_params[5];
+	unsigned char arena_intermediate_chars[1];
+	vtparse_arena_t arena;
+	vtparse_t parser;
+	unsigned int i;
+
+	arena.params = arena_params;
+	arena.max_params = 5;
+	arena.intermediate_chars = arena_intermediate_chars;
+	arena.max_intermediate_chars = 1;
+
+	vtparse_init(&parser);
+	vtparse_set_arena(&parser, &arena);
+
+	EXPECT_EQ(53, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(0, parser.error);
+	EXPECT_EQ(20, parser.num_params);
+	for (i = 0; i < 20; i++) {
+		EXPECT_EQ((int)(i + 1), vtparse_get_param(&parser, i));
+	}
+	EXPECT_EQ(0, vtparse_get_param(&parser, 20));
+
+	EXPECT_EQ(5, vtparse_parse(&parser, buf + 53, buf_len - 53));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_ESC_DISPATCH, parser.action);
+	EXPECT_EQ('0', parser.ch);
+	EXPECT_EQ(3, parser.num_intermediate_chars);
+	EXPECT_EQ('(', vtparse_get_intermediate_char(&parser, 0));
+	EXPECT_EQ('%', vtparse_get_intermediate_char(&parser, 1));
+	EXPECT_EQ('!', vtparse_get_intermediate_char(&parser, 2));
+
+	/* Sequences exceeding the arena are ignored */
+	EXPECT_EQ(59, vtparse_parse(&parser, buf + 58, buf_len - 58));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_compact_ground() {
+	const unsigned char buf[] = "Hello";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_compact_t compact;
+	vtparse_init(&parser);
+
+	EXPECT_TRUE(sizeof(compact) <= 16U);
+
+	/* Pending events cannot be stored */
+	EXPECT_EQ(buf_len, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_FALSE(vtparse_suspend(&parser, &compact));
+
+	EXPECT_EQ(0U, vtparse_parse(&parser, NULL, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+	EXPECT_TRUE(vtparse_suspend(&parser, &compact));
+	EXPECT_EQ(0, compact.num_params);
+	EXPECT_EQ(0, compact.error);
+}
+
+void test_compact_resume_csi() {
+	const unsigned char buf1[] = "\e[?38;5";
+	const size_t buf1_len = sizeof(buf1) - 1U;
+	const unsigned char buf2[] = "\e[1;2;3;4;5;6;7m";
+	const size_t buf2_len = sizeof(buf2) - 1U;
+	const unsigned char buf3[] = ";123mA";
+	const size_t buf3_len = sizeof(buf3) - 1U;
+
+	vtparse_t parser;
+	vtparse_compact_t compact;
+
+	/* Parse the first half of a control sequence and suspend the parser */
+	vtparse_init(&parser);
+	EXPECT_EQ(buf1_len, vtparse_parse(&parser, buf1, buf1_len));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+	EXPECT_TRUE(vtparse_suspend(&parser, &compact));
+
+	/* Use the parser instance for another stream */
+	vtparse_init(&parser);
+	EXPECT_EQ(buf2_len, vtparse_parse(&parser, buf2, buf2_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(7, parser.num_params);
+	EXPECT_EQ(0U, vtparse_parse(&parser, NULL, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+
+	/* Resume the first stream */
+	vtparse_resume(&parser, &compact);
+	EXPECT_FALSE(vtparse_has_event(&parser));
+	EXPECT_EQ(5, vtparse_parse(&parser, buf3, buf3_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ('m', parser.ch);
+	EXPECT_EQ(3, parser.num_params);
+	EXPECT_EQ(38, parser.params[0]);
+	EXPECT_EQ(5, parser.params[1]);
+	EXPECT_EQ(123, parser.params[2]);
+	EXPECT_EQ(1, parser.num_intermediate_chars);
+	EXPECT_EQ('?', parser.intermediate_chars[0]);
+	EXPECT_EQ(0, parser.error);
+
+	EXPECT_EQ(1, vtparse_parse(&parser, buf3 + 5, buf3_len - 5));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf3 + 5, parser.data_begin);
+	EXPECT_EQ(buf3 + 6, parser.data_end);
+}
+
+void test_compact_truecolor() {
+	const unsigned char buf1[] = "\e[38;2;255;128;65535;48;2;1";
+	const size_t buf1_len = sizeof(buf1) - 1U;
+	const unsigned char buf2[] = "2;3;4m";
+	const size_t buf2_len = sizeof(buf2) - 1U;
+	static const int expected[] = {38, 2, 255, 128, 65535, 48, 2, 12, 3, 4};
+	const int n_expected = sizeof(expected) / sizeof(expected[0]);
+
+	vtparse_t parser;
+	vtparse_compact_t compact;
+	unsigned short spill[VTPARSE_COMPACT_MAX_SPILL];
+	int i;
+
+	/* Without spill storage, the sequence does not fit */
+	vtparse_init(&parser);
+	EXPECT_EQ(buf1_len, vtparse_parse(&parser, buf1, buf1_len));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+	EXPECT_TRUE(vtparse_suspend(&parser, &compact));
+	EXPECT_EQ(1, compact.error);
+	EXPECT_EQ(0, compact.num_params);
+	EXPECT_TRUE(vtparse_suspend_spill(&parser, &compact, spill, 3U));
+	EXPECT_EQ(1, compact.error);
+
+	/* Parameters beyond VTPARSE_COMPACT_MAX_PARAMS survive suspending and
+	   resuming in the middle of a parameter if they are spilled */
+	EXPECT_TRUE(vtparse_suspend_spill(&parser, &compact, spill,
+	                                  VTPARSE_COMPACT_MAX_SPILL));
+	EXPECT_EQ(0, compact.error);
+	EXPECT_EQ(8, compact.num_params);
+
+	vtparse_init(&parser);
+	vtparse_resume_spill(&parser, &compact, spill);
+	EXPECT_EQ(buf2_len, vtparse_parse(&parser, buf2, buf2_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(0, parser.error);
+	EXPECT_EQ(n_expected, parser.num_params);
+	for (i = 0; i < n_expected; i++) {
+		EXPECT_EQ(expected[i], parser.params[i]);
+	}
+
+	/* Resuming without the spill storage drops the sequence */
+	vtparse_init(&parser);
+	vtparse_resume(&parser, &compact);
+	EXPECT_EQ(1, parser.error);
+	EXPECT_EQ(0, parser.num_params);
+}
+
+void test_compact_large_param() {
+	const unsigned char buf[] = "\e[1;70000";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_compact_t compact;
+
+	/* Parameters are limited to 16 bit */
+	vtparse_init(&parser);
+	EXPECT_EQ(buf_len, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_EQ(70000, parser.params[1]);
+	EXPECT_TRUE(vtparse_suspend(&parser, &compact));
+	EXPECT_EQ(1, compact.error);
+	EXPECT_EQ(0, compact.num_params);
+}
+
+void test_compact_overflow() {
+	const unsigned char buf1[] = "\e[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17";
+	const size_t buf1_len = sizeof(buf1) - 1U;
+	const unsigned char buf2[] = "mA";
+	const size_t buf2_len = sizeof(buf2) - 1U;
+
+	vtparse_t parser;
+	vtparse_compact_t compact;
+
+	/* The erroneous sequence stays erroneous */
+	vtparse_init(&parser);
+	EXPECT_EQ(buf1_len, vtparse_parse(&parser, buf1, buf1_len));
+	EXPECT_TRUE(vtparse_suspend(&parser, &compact));
+	EXPECT_EQ(1, compact.error);
+
+	/* The sequence is dropped after resuming */
+	vtparse_resume(&parser, &compact);
+	EXPECT_EQ(2, vtparse_parse(&parser, buf2, buf2_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf2 + 1, parser.data_begin);
+	EXPECT_EQ(buf2 + 2, parser.data_end);
+}
+
+void test_compact_arena() {
+	const unsigned char buf1[] = "\e[!!!!!!";
+	const size_t buf1_len = sizeof(buf1) - 1U;
+	const unsigned char buf2[] = "\e[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17";
+	const size_t buf2_len = sizeof(buf2) - 1U;
+	const unsigned char buf3[] = "mA";
+	const size_t buf3_len = sizeof(buf3) - 1U;
+
+	int arena_params[8];
+	unsigned char arena_intermediate_chars[8];
+	unsigned short spill[16];
+	vtparse_arena_t arena;
+	vtparse_t parser;
+	vtparse_compact_t compact;
+	unsigned int i;
+
+	arena.params = arena_params;
+	arena.max_params = 8;
+	arena.intermediate_chars = arena_intermediate_chars;
+	arena.max_intermediate_chars = 8;
+
+	/* Intermediate characters stored in the arena do not fit */
+	vtparse_init(&parser);
+	vtparse_set_arena(&parser, &arena);
+	EXPECT_EQ(buf1_len, vtparse_parse(&parser, buf1, buf1_len));
+	EXPECT_EQ(6, parser.num_intermediate_chars);
+	EXPECT_TRUE(vtparse_suspend(&parser, &compact));
+	EXPECT_EQ(1, compact.error);
+	EXPECT_EQ(0, compact.num_intermediate_chars);
+	for (i = 0; i < VTPARSE_MAX_INTERMEDIATE_CHARS; i++) {
+		EXPECT_EQ(0, compact.intermediate_chars[i]);
+	}
+
+	vtparse_resume(&parser, &compact);
+	EXPECT_EQ(2, vtparse_parse(&parser, buf3, buf3_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf3 + 1, parser.data_begin);
+
+	/* Neither do parameters stored in the arena */
+	vtparse_init(&parser);
+	vtparse_set_arena(&parser, &arena);
+	EXPECT_EQ(buf2_len, vtparse_parse(&parser, buf2, buf2_len));
+	EXPECT_EQ(0, parser.error);
+	EXPECT_EQ(17, parser.num_params);
+	EXPECT_TRUE(vtparse_suspend(&parser, &compact));
+	EXPECT_EQ(1, compact.error);
+	EXPECT_EQ(0, compact.num_params);
+
+	/* ...unless they are spilled and the arena is set when resuming */
+	EXPECT_TRUE(vtparse_suspend_spill(&parser, &compact, spill, 16U));
+	EXPECT_EQ(0, compact.error);
+	EXPECT_EQ(17, compact.num_params);
+
+	vtparse_init(&parser);
+	vtparse_resume_spill(&parser, &compact, spill);
+	EXPECT_EQ(1, parser.error);
+
+	vtparse_init(&parser);
+	vtparse_set_arena(&parser, &arena);
+	vtparse_resume_spill(&parser, &compact, spill);
+	EXPECT_EQ(1, vtparse_parse(&parser, buf3, buf3_len));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(0, parser.error);
+	EXPECT_EQ(17, parser.num_params);
+	for (i = 0; i < 17U; i++) {
+		EXPECT_EQ((int)i + 1, vtparse_get_param(&parser, i));
+	}
+}
+
 void test_action_str() {
 	EXPECT_EQ(0, strcmp("<invalid>", vtparse_action_str(482)));
 	EXPECT_EQ(0, strcmp("<no action>", vtparse_action_str(0)));
 	EXPECT_EQ(0, strcmp("ERROR", vtparse_action_str(VTPARSE_ACTION_ERROR)));
 }
 
+/* Hashes the events produced by parsing buf in chunks of varying length */
+static unsigned long hash_events(const unsigned char *buf, unsigned int len,
+                                 unsigned int options) {
+	vtparse_t parser;
+	unsigned long hash = 0;
+	unsigned int pos = 0, end = 0, seed = 1;
+	int i;
+
+	vtparse_init(&parser);
+	vtparse_set_options(&parser, options);
+	while (end < len) {
+		seed = seed * 1103515245U + 12345U;
+		end += (seed >> 16U) % 300U;
+		end = end > len ? len : end;
+		while (1) {
+			pos += vtparse_parse(&parser, buf + pos, end - pos);
+			if (!vtparse_has_event(&parser)) {
+				break;
+			}
+			vtparse_decode_params(&parser);
+			hash = hash * 31UL + (unsigned long)parser.action;
+			hash = hash * 31UL + (unsigned long)(parser.data_begin - buf);
+			hash = hash * 31UL + (unsigned long)(parser.data_end - buf);
+			hash = hash * 31UL + (unsigned long)parser.num_params;
+			for (i = 0; i < parser.num_params; i++) {
+				hash = hash * 31UL + (unsigned long)parser.params[i];
+			}
+		}
+	}
+	return hash;
+}
+
+void test_isa() {
+	static const char *snippets[] = {
+	    "\033[1;31m", "\033[38;2;255;128;0m", "\033]0;A window title\007",
+	    "\033P1;2|payload\030\031\032payload\033\\", "\033[;;5;H",
+	    "\033[1;2;3;4;5;6;7;8;9;10;11;12;13;14;15;16;17m", "\n", "\r\n",
+	    "\033[123456789012m", "\033]2;\302\251 title\033\\"};
+	unsigned char buf[8192];
+	unsigned int len = 0, seed = 4711, n, i, options;
+	unsigned long ref;
+	int isa;
+
+	/* Interleave runs of printable characters of random length (including
+	   bytes at the boundaries of the run classes) with control sequences */
+	while (len < sizeof(buf) - 256U) {
+		seed = seed * 1103515245U + 12345U;
+		n = (seed >> 16U) % 200U;
+		for (i = 0; i < n; i++) {
+			seed = seed * 1103515245U + 12345U;
+			buf[len++] = (unsigned char)(0x20U + (seed >> 16U) % 0xE0U);
+		}
+		seed = seed * 1103515245U + 12345U;
+		n = (seed >> 16U) % (sizeof(snippets) / sizeof(snippets[0]));
+		for (i = 0; snippets[n][i]; i++) {
+			buf[len++] = (unsigned char)snippets[n][i];
+		}
+	}
+
+	for (options = 0; options < 4U; options++) {
+		vtparse_set_isa(VTPARSE_ISA_SCALAR);
+		ref = hash_events(buf, len, options);
+		for (isa = VTPARSE_ISA_SSE2; isa <= VTPARSE_ISA_AVX512; isa++) {
+			if (vtparse_set_isa(isa) == isa) {
+				EXPECT_EQ(ref, hash_events(buf, len, options));
+			}
+		}
+	}
+	vtparse_set_isa(VTPARSE_ISA_AUTO);
+}
+
+/* Folds the event held by the parser into the given hash; data ranges are
+   hashed byte by byte, such that the result does not depend on how they are
+   split */
+static unsigned long fold_event(unsigned long hash, const vtparse_t *parser) {
+	const unsigned char *p;
+	int i;
+
+	if (parser->data_begin != parser->data_end) {
+		for (p = parser->data_begin; p < parser->data_end; p++) {
+			hash = hash * 31UL + (unsigned long)parser->action;
+			hash = hash * 31UL + *p;
+		}
+		return hash;
+	}
+	hash = hash * 31UL + (unsigned long)parser->action;
+	hash = hash * 31UL + (unsigned long)parser->ch;
+	if (parser->action != VTPARSE_ACTION_CSI_DISPATCH &&
+	    parser->action != VTPARSE_ACTION_ESC_DISPATCH &&
+	    parser->action != VTPARSE_ACTION_HOOK) {
+		return hash; /* Parameters are left over from an earlier sequence */
+	}
+	for (i = 0; i < parser->num_params; i++) {
+		hash = hash * 31UL + (unsigned long)parser->params[i];
+	}
+	for (i = 0; i < parser->num_intermediate_chars; i++) {
+		hash = hash * 31UL + (unsigned long)parser->intermediate_chars[i];
+	}
+	return hash;
+}
+
+/* Digest of the events produced by parsing buf in chunks of at most
+   max_chunk bytes */
+static unsigned long digest_events(const unsigned char *buf, unsigned int len,
+                                   unsigned int max_chunk, unsigned int options,
+                                   unsigned int event_mask) {
+	vtparse_t parser;
+	unsigned long hash = 0;
+	unsigned int pos = 0, end = 0, seed = 1;
+
+	vtparse_init(&parser);
+	vtparse_set_options(&parser, options);
+	vtparse_set_event_mask(&parser, event_mask);
+	while (end < len) {
+		seed = seed * 1103515245U + 12345U;
+		end += 1U + (seed >> 16U) % max_chunk;
+		end = end > len ? len : end;
+		while (1) {
+			pos += vtparse_parse(&parser, buf + pos, end - pos);
+			if (!vtparse_has_event(&parser)) {
+				break;
+			}
+			vtparse_decode_params(&parser);
+			hash = fold_event(hash, &parser);
+		}
+	}
+	return hash;
+}
+
+void test_tiny_buffers() {
+	static const char alphabet[] = "abc \033\033[[;;12mHD\b\r\n\t\007]P\\\303\251";
+	static const unsigned int masks[] = {
+	    VTPARSE_EVENT_MASK_ALL,
+	    VTPARSE_EVENT_MASK_ALL & ~VTPARSE_EVENT_MASK(VTPARSE_ACTION_PRINT),
+	    VTPARSE_EVENT_MASK_ALL & ~VTPARSE_EVENT_MASK(VTPARSE_ACTION_EXECUTE)};
+	unsigned char buf[4096];
+	unsigned int i, j, options, seed = 42;
+
+	/* Random input; feeding it in tiny pieces must produce the same events as
+	   parsing it at once */
+	for (i = 0; i < sizeof(buf); i++) {
+		seed = seed * 1103515245U + 12345U;
+		buf[i] = (unsigned char)alphabet[(seed >> 16U) % (sizeof(alphabet) - 1U)];
+	}
+	for (options = 0; options <= VTPARSE_OPTION_LINE_SPANS; options++) {
+		for (j = 0; j < sizeof(masks) / sizeof(masks[0]); j++) {
+			EXPECT_EQ(digest_events(buf, sizeof(buf), sizeof(buf), options,
+			                        masks[j]),
+			          digest_events(buf, sizeof(buf), 4U, options, masks[j]));
+			EXPECT_EQ(digest_events(buf, sizeof(buf), sizeof(buf), options,
+			                        masks[j]),
+			          digest_events(buf, sizeof(buf), 16U, options, masks[j]));
+		}
+	}
+}
+
+void test_keystroke_echo() {
+	const unsigned char buf[] = "a\b";
+	vtparse_t parser;
+	vtparse_init(&parser);
+
+	/* A single printable character */
+	EXPECT_EQ(1U, vtparse_parse(&parser, buf, 1U));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf, parser.data_begin);
+	EXPECT_EQ(buf + 1, parser.data_end);
+	EXPECT_EQ(0U, vtparse_parse(&parser, buf + 1, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+
+	/* A single control character */
+	EXPECT_EQ(1U, vtparse_parse(&parser, buf + 1, 1U));
+	EXPECT_TRUE(vtparse_has_event(&parser));
+	EXPECT_EQ(VTPARSE_ACTION_EXECUTE, parser.action);
+	EXPECT_EQ('\b', parser.ch);
+	EXPECT_EQ(parser.data_begin, parser.data_end);
+	EXPECT_EQ(0U, vtparse_parse(&parser, buf + 2, 0U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+}
+
+void test_budget() {
+	static const char alphabet[] = "abc \033\033[[;;12mHD\b\r\n\t\007]P\\";
+	static const unsigned int budgets[][2] = {
+	    {1U, 0U}, {7U, 0U}, {0U, 1U}, {0U, 3U}, {5U, 2U}, {100U, 10U}};
+	unsigned char buf[4096];
+	unsigned long hash;
+	unsigned int i, j, pos, n_slices, n_bytes, n_events, seed = 42;
+	int ok;
+	vtparse_t parser;
+
+	for (i = 0; i < sizeof(buf); i++) {
+		seed = seed * 1103515245U + 12345U;
+		buf[i] = (unsigned char)alphabet[(seed >> 16U) % (sizeof(alphabet) - 1U)];
+	}
+
+	/* Parsing the input in bounded slices must produce the same events as
+	   parsing it at once, and no slice may exceed its budget */
+	for (j = 0; j < sizeof(budgets) / sizeof(budgets[0]); j++) {
+		vtparse_init(&parser);
+		hash = 0;
+		pos = 0;
+		n_slices = 0;
+		ok = 1;
+		while (pos < sizeof(buf) || vtparse_has_event(&parser)) {
+			vtparse_set_budget(&parser, budgets[j][0], budgets[j][1]);
+			while (1) {
+				pos += vtparse_parse(&parser, buf + pos, sizeof(buf) - pos);
+				if (!vtparse_has_event(&parser)) {
+					break;
+				}
+				hash = fold_event(hash, &parser);
+			}
+			vtparse_get_budget_used(&parser, &n_bytes, &n_events);
+			if ((budgets[j][0] && n_bytes > budgets[j][0]) ||
+			    (budgets[j][1] && n_events > budgets[j][1] + 3U) ||
+			    (pos < sizeof(buf) && !vtparse_budget_exhausted(&parser))) {
+				ok = 0;
+			}
+			n_slices++;
+		}
+		EXPECT_TRUE(ok);
+		EXPECT_TRUE(n_slices > 1U);
+		EXPECT_EQ(digest_events(buf, sizeof(buf), sizeof(buf), 0U,
+		                        VTPARSE_EVENT_MASK_ALL),
+		          hash);
+	}
+}
+
+void test_budget_masked() {
+	const unsigned char buf[] = "hello world\r\nhello";
+	unsigned int n_bytes, n_events;
+	vtparse_t parser;
+
+	/* With all events masked, only the byte budget bounds the call */
+	vtparse_init(&parser);
+	vtparse_set_event_mask(&parser, 0U);
+	vtparse_set_budget(&parser, 4U, 0U);
+	EXPECT_EQ(4U, vtparse_parse(&parser, buf, sizeof(buf) - 1U));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+	EXPECT_TRUE(vtparse_budget_exhausted(&parser));
+	EXPECT_EQ(0U, vtparse_parse(&parser, buf + 4, sizeof(buf) - 5U));
+	vtparse_get_budget_used(&parser, &n_bytes, &n_events);
+	EXPECT_EQ(4U, n_bytes);
+	EXPECT_EQ(0U, n_events);
+
+	/* Renewing grants the same budget again */
+	vtparse_renew_budget(&parser);
+	EXPECT_FALSE(vtparse_budget_exhausted(&parser));
+	EXPECT_EQ(4U, vtparse_parse(&parser, buf + 4, sizeof(buf) - 5U));
+	EXPECT_TRUE(vtparse_budget_exhausted(&parser));
+	vtparse_get_budget_used(&parser, &n_bytes, &n_events);
+	EXPECT_EQ(4U, n_bytes);
+
+	/* Unlimited budget */
+	vtparse_set_budget(&parser, VTPARSE_BUDGET_UNLIMITED,
+	                   VTPARSE_BUDGET_UNLIMITED);
+	EXPECT_EQ(sizeof(buf) - 9U, vtparse_parse(&parser, buf + 8, sizeof(buf) - 9U));
+	EXPECT_FALSE(vtparse_budget_exhausted(&parser));
+}
+
+void test_sequences() {
+	const unsigned char buf[] =
+	    "ab\e[0m\e[?25l\e[12;34H\e[38;5;196m\e(B\e[2J\e[m\e[38;5";
+	const size_t buf_len = sizeof(buf) - 1U;
+
+	vtparse_t parser;
+	vtparse_init(&parser);
+	vtparse_set_options(&parser, VTPARSE_OPTION_SEQUENCES);
+
+	EXPECT_EQ(2, vtparse_parse(&parser, buf, buf_len));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(VTPARSE_SEQUENCE_NONE, parser.sequence);
+
+	EXPECT_EQ(4, vtparse_parse(&parser, buf + 2, buf_len - 2));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(VTPARSE_SEQUENCE_SGR_RESET, parser.sequence);
+	EXPECT_EQ('m', parser.ch);
+	EXPECT_EQ(1, parser.num_params);
+	EXPECT_EQ(0, parser.params[0]);
+
+	EXPECT_EQ(6, vtparse_parse(&parser, buf + 6, buf_len - 6));
+	EXPECT_EQ(VTPARSE_SEQUENCE_HIDE_CURSOR, parser.sequence);
+	EXPECT_EQ('l', parser.ch);
+	EXPECT_EQ(1, parser.num_intermediate_chars);
+	EXPECT_EQ('?', parser.intermediate_chars[0]);
+	EXPECT_EQ(1, parser.num_params);
+	EXPECT_EQ(25, parser.params[0]);
+
+	EXPECT_EQ(8, vtparse_parse(&parser, buf + 12, buf_len - 12));
+	EXPECT_EQ(VTPARSE_SEQUENCE_CURSOR_POSITION, parser.sequence);
+	EXPECT_EQ(0, parser.num_intermediate_chars);
+	EXPECT_EQ(2, parser.num_params);
+	EXPECT_EQ(12, parser.params[0]);
+	EXPECT_EQ(34, parser.params[1]);
+
+	EXPECT_EQ(11, vtparse_parse(&parser, buf + 20, buf_len - 20));
+	EXPECT_EQ(VTPARSE_SEQUENCE_SGR_FG_256, parser.sequence);
+	EXPECT_EQ(3, parser.num_params);
+	EXPECT_EQ(196, parser.params[2]);
+
+	EXPECT_EQ(3, vtparse_parse(&parser, buf + 31, buf_len - 31));
+	EXPECT_EQ(VTPARSE_ACTION_ESC_DISPATCH, parser.action);
+	EXPECT_EQ(VTPARSE_SEQUENCE_G0_ASCII, parser.sequence);
+	EXPECT_EQ('B', parser.ch);
+	EXPECT_EQ(1, parser.num_intermediate_chars);
+	EXPECT_EQ('(', parser.intermediate_chars[0]);
+
+	/* Other sequences take the regular path */
+	EXPECT_EQ(4, vtparse_parse(&parser, buf + 34, buf_len - 34));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(VTPARSE_SEQUENCE_NONE, parser.sequence);
+	EXPECT_EQ('J', parser.ch);
+
+	EXPECT_EQ(3, vtparse_parse(&parser, buf + 38, buf_len - 38));
+	EXPECT_EQ(VTPARSE_SEQUENCE_SGR_RESET, parser.sequence);
+	EXPECT_EQ(0, parser.num_params);
+
+	/* So do sequences that straddle input buffers */
+	EXPECT_EQ(6, vtparse_parse(&parser, buf + 41, buf_len - 41));
+	EXPECT_FALSE(vtparse_has_event(&parser));
+	EXPECT_EQ(5, vtparse_parse(&parser, (const unsigned char *)";196m", 5));
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, parser.action);
+	EXPECT_EQ(VTPARSE_SEQUENCE_NONE, parser.sequence);
+	EXPECT_EQ(3, parser.num_params);
+	EXPECT_EQ(196, parser.params[2]);
+
+	EXPECT_EQ(0, strcmp("CURSOR_POSITION",
+	                    vtparse_sequence_str(VTPARSE_SEQUENCE_CURSOR_POSITION)));
+	EXPECT_EQ(0, strcmp("<invalid>", vtparse_sequence_str(-1)));
+}
+
+void test_sequences_equivalence() {
+	static const char *snippets[] = {
+	    "\033[0m", "\033[m", "\033[K", "\033[H", "\033[?25l", "\033[?25h",
+	    "\033[1;80H", "\033[;H", "\033[38;5;208m", "\033[48;5;17m", "\033(B",
+	    "\033[0", "\033[?2", "\033[38;5;", "\033[3\n8;5;1m", "\033[0;1m",
+	    "\033[?25;1l", "\033[12;34;56H", "\033(", "\033[38;2;1;2;3m", "\033\033[m",
+	    "\033]0;title\007", "\033P1|x\033\\", "hello ", "\r\n", "\b"};
+	static const unsigned int masks[] = {
+	    VTPARSE_EVENT_MASK_ALL,
+	    VTPARSE_EVENT_MASK_ALL & ~VTPARSE_EVENT_MASK(VTPARSE_ACTION_CSI_DISPATCH),
+	    VTPARSE_EVENT_MASK_ALL & ~VTPARSE_EVENT_MASK(VTPARSE_ACTION_PRINT)};
+	unsigned char buf[8192];
+	unsigned int len = 0, seed = 4711, n, i, j, options, chunk;
+
+	while (len < sizeof(buf) - 32U) {
+		seed = seed * 1103515245U + 12345U;
+		n = (seed >> 16U) % (sizeof(snippets) / sizeof(snippets[0]));
+		for (i = 0; snippets[n][i]; i++) {
+			buf[len++] = (unsigned char)snippets[n][i];
+		}
+	}
+
+	/* The recognizer must produce the same events as the state machine */
+	for (options = 0; options <= VTPARSE_OPTION_LAZY_PARAMS; options++) {
+		for (j = 0; j < sizeof(masks) / sizeof(masks[0]); j++) {
+			for (chunk = 4U; chunk <= sizeof(buf); chunk *= 8U) {
+				EXPECT_EQ(
+				    digest_events(buf, len, chunk, options, masks[j]),
+				    digest_events(buf, len, chunk,
+				                  options | VTPARSE_OPTION_SEQUENCES, masks[j]));
+			}
+		}
+	}
+}
+
 int main() {
 	RUN(test_null);
 	RUN(test_simple);
@@ -541,6 +1438,29 @@ int main() {
 	RUN(test_intermediate_csi_invalid_1);
 	RUN(test_intermediate_csi_invalid_2);
 	RUN(test_dcs_hook_unhook);
+	RUN(test_intermediate_csi_invalid_3);
+	RUN(test_execute_in_csi_at_end);
+	RUN(test_dcs_ignore_in_put);
+	RUN(test_event_mask_execute);
+	RUN(test_event_mask_osc);
+	RUN(test_line_spans);
+	RUN(test_lazy_params);
+	RUN(test_lazy_params_straddle);
+	RUN(test_max_params);
+	RUN(test_arena);
+	RUN(test_compact_ground);
+	RUN(test_compact_resume_csi);
+	RUN(test_compact_truecolor);
+	RUN(test_compact_large_param);
+	RUN(test_compact_overflow);
+	RUN(test_compact_arena);
 	RUN(test_action_str);
+	RUN(test_isa);
+	RUN(test_tiny_buffers);
+	RUN(test_keystroke_echo);
+	RUN(test_budget);
+	RUN(test_budget_masked);
+	RUN(test_sequences);
+	RUN(test_sequences_equivalence);
 	DONE;
 }
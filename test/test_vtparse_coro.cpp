@@ -0,0 +1,305 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_coro.cpp
+ *
+ * Unit tests for the coroutine interface in vtparse_coro.hpp. Heap
+ * allocations are counted by replacing the global operator new.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_coro.hpp>
+
+static unsigned long n_allocs = 0;
+
+void *operator new(std::size_t size) {
+	void *ptr = std::malloc(size ? size : 1);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	n_allocs++;
+	return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+/* Appends a textual description of the given event to str; data split across
+   several events is merged */
+static void describe(std::string &str, const vtparse::event &e) {
+	static vtparse_action_t last_data_action;
+	if (str.empty()) {
+		last_data_action = vtparse_action_t(0);
+	}
+	if (e.has_data() && e.action() == last_data_action) {
+		str += e.data();
+		return;
+	}
+	last_data_action = e.has_data() ? e.action() : vtparse_action_t(0);
+	str += str.empty() ? "" : " ";
+	str += vtparse_action_str(e.action());
+	str += ":";
+	if (e.has_data()) {
+		str += e.data();
+		return;
+	}
+	str += static_cast<char>(e.ch());
+	str += e.intermediate_chars();
+	for (int p : e.params()) {
+		str += "," + std::to_string(p);
+	}
+}
+
+static const std::string_view input =
+    "ab\033[1;22mc\033(B\033P1$qx\033\\";
+
+static const char *expected =
+    "PRINT:ab CSI_DISPATCH:m,1,22 PRINT:c ESC_DISPATCH:B( HOOK:q$,1 PUT:x "
+    "UNHOOK:\033$,1 ESC_DISPATCH:\\";
+
+/* Asynchronous byte source reading from a non-blocking socket. A coroutine
+   waiting for data is resumed by poll() */
+class socket_source {
+public:
+	class read_awaitable {
+	public:
+		read_awaitable(socket_source &source, unsigned char *buf,
+		               std::size_t size)
+		    : source_(source), buf_(buf), size_(size), n_(-1) {}
+
+		bool await_ready() noexcept {
+			n_ = ::read(source_.fd_, buf_, size_);
+			return n_ >= 0 || errno != EAGAIN;
+		}
+
+		void await_suspend(std::coroutine_handle<> h) noexcept {
+			source_.waiting_ = h;
+		}
+
+		std::size_t await_resume() noexcept {
+			if (n_ < 0) {
+				n_ = ::read(source_.fd_, buf_, size_);
+			}
+			return n_ < 0 ? 0 : std::size_t(n_);
+		}
+
+	private:
+		socket_source &source_;
+		unsigned char *buf_;
+		std::size_t size_;
+		ssize_t n_;
+	};
+
+	explicit socket_source(int fd) : fd_(fd) {}
+
+	read_awaitable read(unsigned char *buf, std::size_t size) {
+		return read_awaitable(*this, buf, size);
+	}
+
+	/* Resumes the waiting coroutine once the socket is readable */
+	bool poll(int timeout) {
+		struct pollfd pfd = {fd_, POLLIN, 0};
+		if (!waiting_ || ::poll(&pfd, 1, timeout) <= 0) {
+			return false;
+		}
+		std::exchange(waiting_, nullptr).resume();
+		return true;
+	}
+
+private:
+	int fd_;
+	std::coroutine_handle<> waiting_;
+};
+
+static_assert(vtparse::async_byte_source<socket_source>);
+
+void test_coro_generator() {
+	vtparse::parser p;
+	std::string str;
+
+	for (const vtparse::event &e : vtparse::generate(p, input)) {
+		describe(str, e);
+	}
+	EXPECT_TRUE(str == expected);
+}
+
+void test_coro_generator_allocations() {
+	vtparse::parser p;
+	vtparse::frame_buffer<1024> arena;
+	std::string buf;
+	unsigned long n_events = 0, n_allocs_before;
+	int i;
+
+	for (i = 0; i < 100; i++) {
+		buf += input;
+	}
+
+	/* The frame is the only allocation, independent of the number of events */
+	n_allocs_before = n_allocs;
+	for (const vtparse::event &e : vtparse::generate(p, buf)) {
+		n_events += e.action() != 0;
+	}
+	EXPECT_EQ(800U, n_events);
+	EXPECT_EQ(1U, n_allocs - n_allocs_before);
+
+	/* No allocation with a frame arena; the frame is released when the
+	   generator is destroyed, even if it did not run to completion */
+	n_allocs_before = n_allocs;
+	for (i = 0; i < 2; i++) {
+		n_events = 0;
+		for (const vtparse::event &e :
+		     vtparse::generate(std::allocator_arg, arena, p, buf)) {
+			EXPECT_NE(0U, arena.used());
+			if (++n_events == 3U + i) {
+				(void)e;
+				break;
+			}
+		}
+		EXPECT_EQ(0U, arena.used());
+		p.reset();
+	}
+	EXPECT_EQ(0U, n_allocs - n_allocs_before);
+
+	/* Fall back to the heap if the arena is too small */
+	{
+		vtparse::frame_buffer<16> small;
+		n_allocs_before = n_allocs;
+		for (const vtparse::event &e :
+		     vtparse::generate(std::allocator_arg, small, p, input)) {
+			(void)e;
+		}
+		EXPECT_EQ(1U, n_allocs - n_allocs_before);
+		EXPECT_EQ(0U, small.used());
+	}
+}
+
+void test_coro_async_socketpair() {
+	vtparse::parser p;
+	vtparse::frame_buffer<1024> arena;
+	unsigned char buf[4];
+	unsigned long n_allocs_before;
+	std::string str;
+	std::size_t i, n;
+	int fds[2];
+
+	ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+	ASSERT_EQ(0, fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK));
+	socket_source source(fds[0]);
+
+	/* Creating the task only places its frame in the arena */
+	n_allocs_before = n_allocs;
+	vtparse::task<std::size_t> t = vtparse::async_parse(
+	    std::allocator_arg, arena, p, source, buf, sizeof(buf),
+	    [&str](const vtparse::event &e) { describe(str, e); });
+	EXPECT_EQ(0U, n_allocs - n_allocs_before);
+	EXPECT_NE(0U, arena.used());
+
+	/* Write the input in small pieces; the task is suspended in between */
+	t.start();
+	for (i = 0; i < input.size(); i += n) {
+		n = std::min<std::size_t>(5, input.size() - i);
+		ASSERT_EQ(ssize_t(n), write(fds[1], input.data() + i, n));
+		while (source.poll(0)) {
+		}
+		EXPECT_FALSE(t.done());
+	}
+	close(fds[1]);
+	while (!t.done()) {
+		source.poll(-1);
+	}
+	close(fds[0]);
+
+	EXPECT_EQ(input.size(), t.result());
+	EXPECT_TRUE(str == expected);
+}
+
+/* Source that is always ready, for awaiting a task from another coroutine */
+class memory_source {
+public:
+	explicit memory_source(std::string_view data) : data_(data) {}
+
+	auto read(unsigned char *buf, std::size_t size) {
+		struct awaitable {
+			memory_source &source;
+			unsigned char *buf;
+			std::size_t size;
+			bool await_ready() const noexcept { return true; }
+			void await_suspend(std::coroutine_handle<>) const noexcept {}
+			std::size_t await_resume() const noexcept {
+				std::string_view chunk = source.data_.substr(0, size);
+				chunk.copy(reinterpret_cast<char *>(buf), chunk.size());
+				source.data_.remove_prefix(chunk.size());
+				return chunk.size();
+			}
+		};
+		return awaitable{*this, buf, size};
+	}
+
+private:
+	std::string_view data_;
+};
+
+static vtparse::task<std::size_t> count_events(vtparse::parser &p,
+                                               std::string_view data,
+                                               unsigned long &n_events) {
+	memory_source source(data);
+	unsigned char buf[3];
+	std::size_t n = co_await vtparse::async_parse(
+	    p, source, buf, sizeof(buf), [&n_events](const vtparse::event &e) {
+		    n_events++;
+		    return e.action() != VTPARSE_ACTION_HOOK;
+	    });
+	co_return n;
+}
+
+void test_coro_async_stop() {
+	vtparse::parser p;
+	unsigned long n_events = 0;
+
+	/* The visitor stops the task at the HOOK event in the middle of a buffer;
+	   the task completes synchronously since the source is always ready */
+	vtparse::task<std::size_t> t = count_events(p, input, n_events);
+	t.start();
+	ASSERT_TRUE(t.done());
+	EXPECT_EQ(input.find('q') + 1, t.result());
+	EXPECT_EQ(5U, n_events);
+}
+
+int main() {
+	RUN(test_coro_generator);
+	RUN(test_coro_generator_allocations);
+	RUN(test_coro_async_socketpair);
+	RUN(test_coro_async_stop);
+	DONE;
+}
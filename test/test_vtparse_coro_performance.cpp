@@ -0,0 +1,205 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_coro_performance.cpp
+ *
+ * Measures the overhead of the coroutine interface in vtparse_coro.hpp over
+ * passing the events to a visitor. The generator is resumed once per event;
+ * async_parse() reads the input from an in-memory source in 64 KiB pieces.
+ * Heap allocations are counted by replacing the global operator new.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <time.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_coro.hpp>
+
+static const int N_REPEAT = 200;
+
+static unsigned long n_allocs = 0;
+
+void *operator new(std::size_t size) {
+	void *ptr = std::malloc(size ? size : 1);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	n_allocs++;
+	return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+static long long int microtime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &tp);
+	return tp.tv_sec * 1000 * 1000 + tp.tv_nsec / 1000;
+}
+
+/* Checksum over the events; independent of data being split into several
+   events at buffer boundaries */
+static void fold(unsigned long &sum, const vtparse::event &e) {
+	if (e.has_data()) {
+		sum += e.data().size();
+		return;
+	}
+	sum += e.action();
+	if (e.action() == VTPARSE_ACTION_CSI_DISPATCH) {
+		for (int p : e.params()) {
+			sum += static_cast<unsigned long>(p);
+		}
+	}
+}
+
+/* Source that is always ready */
+class memory_source {
+public:
+	explicit memory_source(std::string_view data) : data_(data) {}
+
+	auto read(unsigned char *buf, std::size_t size) {
+		struct awaitable {
+			memory_source &source;
+			unsigned char *buf;
+			std::size_t size;
+			bool await_ready() const noexcept { return true; }
+			void await_suspend(std::coroutine_handle<>) const noexcept {}
+			std::size_t await_resume() const noexcept {
+				std::string_view chunk = source.data_.substr(0, size);
+				chunk.copy(reinterpret_cast<char *>(buf), chunk.size());
+				source.data_.remove_prefix(chunk.size());
+				return chunk.size();
+			}
+		};
+		return awaitable{*this, buf, size};
+	}
+
+private:
+	std::string_view data_;
+};
+
+static unsigned long run_visitor(const std::string &buf) {
+	vtparse::parser p;
+	unsigned long sum = 0;
+	p.parse(buf, [&sum](const vtparse::event &e) { fold(sum, e); });
+	return sum;
+}
+
+static unsigned long run_generator(const std::string &buf) {
+	vtparse::parser p;
+	unsigned long sum = 0;
+	for (const vtparse::event &e : vtparse::generate(p, buf)) {
+		fold(sum, e);
+	}
+	return sum;
+}
+
+static unsigned long run_generator_arena(const std::string &buf) {
+	static vtparse::frame_buffer<1024> arena;
+	vtparse::parser p;
+	unsigned long sum = 0;
+	for (const vtparse::event &e :
+	     vtparse::generate(std::allocator_arg, arena, p, buf)) {
+		fold(sum, e);
+	}
+	return sum;
+}
+
+static unsigned long run_async_arena(const std::string &buf) {
+	static vtparse::frame_buffer<1024> arena;
+	static unsigned char chunk[65536];
+	vtparse::parser p;
+	memory_source source(buf);
+	unsigned long sum = 0;
+	vtparse::task<std::size_t> t = vtparse::async_parse(
+	    std::allocator_arg, arena, p, source, chunk, sizeof(chunk),
+	    [&sum](const vtparse::event &e) { fold(sum, e); });
+	t.start();
+	return sum;
+}
+
+int main(int argc, char *argv[]) {
+	static const struct {
+		const char *name;
+		unsigned long (*run)(const std::string &);
+	} loops[] = {{"visitor", run_visitor},
+	             {"generator", run_generator},
+	             {"generator+arena", run_generator_arena},
+	             {"async+arena", run_async_arena}};
+	static const int N_LOOPS = sizeof(loops) / sizeof(loops[0]);
+	std::vector<std::string> files;
+	unsigned long sums[N_LOOPS], allocs;
+	long long int t0, t1;
+	int i, j, k;
+
+	if (argc <= 1) {
+		std::fprintf(stderr,
+		             "Usage ./test_vtparse_coro_performance <INPUT FILE 1> ... "
+		             "<INPUT FILE N>\n");
+		return 1;
+	}
+
+	FX_PRINT_ARROW("Reading input files to memory\n");
+	for (i = 1; i < argc; i++) {
+		std::ifstream f(argv[i], std::ios::binary);
+		if (!f) {
+			FX_PRINT_ERR("Error while opening file!\n");
+			return 1;
+		}
+		files.emplace_back(std::istreambuf_iterator<char>(f),
+		                   std::istreambuf_iterator<char>());
+	}
+	FX_PRINT_OK("Reading input files to memory\n");
+
+	FX_PRINT_ARROW("Parsing files\n");
+	for (i = 0; i < argc - 1; i++) {
+		for (k = 0; k < N_LOOPS; k++) {
+			allocs = n_allocs;
+			t0 = microtime();
+			for (j = 0; j < N_REPEAT; j++) {
+				sums[k] = loops[k].run(files[i]);
+			}
+			t1 = microtime();
+			std::fprintf(stdout,
+			             "      %-16s %s: %6.2fns per byte, %lu allocations\n",
+			             loops[k].name, argv[i + 1],
+			             (double)(t1 - t0) * 1000.0 /
+			                 ((double)files[i].size() * N_REPEAT),
+			             (n_allocs - allocs) / N_REPEAT);
+			if (sums[k] != sums[0]) {
+				FX_PRINT_ERR("Checksums differ!\n");
+				return 1;
+			}
+		}
+	}
+	FX_PRINT_OK("Done parsing files.\n");
+	return 0;
+}
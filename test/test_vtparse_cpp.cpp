@@ -0,0 +1,133 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_cpp.cpp
+ *
+ * Unit tests for the header-only C++ interface in vtparse.hpp.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <string>
+#include <string_view>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse.hpp>
+
+/* Appends a textual description of the given event to str */
+static void describe(std::string &str, const vtparse::event &e) {
+	str += str.empty() ? "" : " ";
+	str += vtparse_action_str(e.action());
+	str += ":";
+	if (e.has_data()) {
+		str += e.data();
+		return;
+	}
+	str += static_cast<char>(e.ch());
+	str += e.intermediate_chars();
+	for (int p : e.params()) {
+		str += "," + std::to_string(p);
+	}
+}
+
+static const std::string_view input =
+    "ab\033[1;22mc\033(B\033P1$qx\033\\";
+
+static const char *expected =
+    "PRINT:ab CSI_DISPATCH:m,1,22 PRINT:c ESC_DISPATCH:B( HOOK:q$,1 PUT:x "
+    "UNHOOK:\033$,1 ESC_DISPATCH:\\";
+
+void test_cpp_visitor() {
+	vtparse::parser p;
+	std::string str;
+	std::size_t pos;
+
+	pos = p.parse(input, [&str](const vtparse::event &e) { describe(str, e); });
+	EXPECT_EQ(input.size(), pos);
+	EXPECT_TRUE(str == expected);
+}
+
+void test_cpp_range() {
+	vtparse::parser p;
+	std::string str;
+
+	for (const vtparse::event &e : p.events(input)) {
+		describe(str, e);
+	}
+	EXPECT_TRUE(str == expected);
+
+	/* Empty input */
+	str.clear();
+	for (const vtparse::event &e : p.events(std::string_view())) {
+		describe(str, e);
+	}
+	EXPECT_TRUE(str.empty());
+}
+
+void test_cpp_lazy_params() {
+	vtparse::parser p;
+	std::string str;
+
+	/* Parameters are decoded when accessed from within the visitor */
+	p.set_options(VTPARSE_OPTION_LAZY_PARAMS);
+	p.parse(input, [&str](const vtparse::event &e) { describe(str, e); });
+	EXPECT_TRUE(str == expected);
+}
+
+void test_cpp_stop() {
+	vtparse::parser p;
+	unsigned int n = 0;
+	std::size_t pos;
+
+	/* Stop after the CSI sequence; the rest is parsed in a second call */
+	pos = p.parse(input, [&n](const vtparse::event &e) {
+		n++;
+		return e.action() != VTPARSE_ACTION_CSI_DISPATCH;
+	});
+	EXPECT_EQ(2U, n);
+	EXPECT_EQ(9U, pos);
+	p.parse(input.substr(pos), [&n](const vtparse::event &) { n++; });
+	EXPECT_EQ(8U, n);
+}
+
+void test_cpp_budget() {
+	vtparse::parser p;
+	unsigned int n = 0;
+
+	/* A budget ends the range early */
+	p.set_budget(4, VTPARSE_BUDGET_UNLIMITED);
+	vtparse::event_range events = p.events(input);
+	for (const vtparse::event &e : events) {
+		(void)e;
+		n++;
+	}
+	EXPECT_EQ(4U, events.consumed());
+	EXPECT_EQ(1U, n);
+}
+
+int main() {
+	RUN(test_cpp_visitor);
+	RUN(test_cpp_range);
+	RUN(test_cpp_lazy_params);
+	RUN(test_cpp_stop);
+	RUN(test_cpp_budget);
+	DONE;
+}
@@ -0,0 +1,159 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_cpp_performance.cpp
+ *
+ * Compares the event loop written against the C API with the visitor and the
+ * range interface of vtparse.hpp. All three loops compute the same checksum
+ * over the events, looking at the action, the data and the parameters.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <time.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse.hpp>
+
+static const int N_REPEAT = 200;
+
+static long long int microtime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &tp);
+	return tp.tv_sec * 1000 * 1000 + tp.tv_nsec / 1000;
+}
+
+static unsigned long run_c(const std::string &buf) {
+	const unsigned char *data =
+	    reinterpret_cast<const unsigned char *>(buf.data());
+	const unsigned int len = static_cast<unsigned int>(buf.size());
+	unsigned long sum = 0;
+	unsigned int pos = 0;
+	vtparse_t parser;
+	int i;
+
+	vtparse_init(&parser);
+	while (true) {
+		pos += vtparse_parse(&parser, data + pos, len - pos);
+		if (!vtparse_has_event(&parser)) {
+			break;
+		}
+		sum += parser.action;
+		if (parser.data_begin != parser.data_end) {
+			sum += static_cast<unsigned long>(parser.data_end -
+			                                  parser.data_begin);
+			sum += parser.data_begin[0];
+		} else if (parser.action == VTPARSE_ACTION_CSI_DISPATCH) {
+			for (i = 0; i < parser.num_params && i < (int)VTPARSE_MAX_PARAMS;
+			     i++) {
+				sum += static_cast<unsigned long>(parser.params[i]);
+			}
+		}
+	}
+	return sum;
+}
+
+static void fold(unsigned long &sum, const vtparse::event &e) {
+	sum += e.action();
+	if (e.has_data()) {
+		sum += e.data().size();
+		sum += static_cast<unsigned char>(e.data()[0]);
+	} else if (e.action() == VTPARSE_ACTION_CSI_DISPATCH) {
+		for (int p : e.params()) {
+			sum += static_cast<unsigned long>(p);
+		}
+	}
+}
+
+static unsigned long run_visitor(const std::string &buf) {
+	vtparse::parser p;
+	unsigned long sum = 0;
+	p.parse(buf, [&sum](const vtparse::event &e) { fold(sum, e); });
+	return sum;
+}
+
+static unsigned long run_range(const std::string &buf) {
+	vtparse::parser p;
+	unsigned long sum = 0;
+	for (const vtparse::event &e : p.events(buf)) {
+		fold(sum, e);
+	}
+	return sum;
+}
+
+int main(int argc, char *argv[]) {
+	static const struct {
+		const char *name;
+		unsigned long (*run)(const std::string &);
+	} loops[] = {{"C API", run_c},
+	             {"C++ visitor", run_visitor},
+	             {"C++ range", run_range}};
+	std::vector<std::string> files;
+	unsigned long sums[3];
+	long long int t0, t1;
+	int i, j, k;
+
+	if (argc <= 1) {
+		std::fprintf(stderr,
+		             "Usage ./test_vtparse_cpp_performance <INPUT FILE 1> ... "
+		             "<INPUT FILE N>\n");
+		return 1;
+	}
+
+	FX_PRINT_ARROW("Reading input files to memory\n");
+	for (i = 1; i < argc; i++) {
+		std::ifstream f(argv[i], std::ios::binary);
+		if (!f) {
+			FX_PRINT_ERR("Error while opening file!\n");
+			return 1;
+		}
+		files.emplace_back(std::istreambuf_iterator<char>(f),
+		                   std::istreambuf_iterator<char>());
+	}
+	FX_PRINT_OK("Reading input files to memory\n");
+
+	FX_PRINT_ARROW("Parsing files\n");
+	for (i = 0; i < argc - 1; i++) {
+		for (k = 0; k < 3; k++) {
+			t0 = microtime();
+			for (j = 0; j < N_REPEAT; j++) {
+				sums[k] = loops[k].run(files[i]);
+			}
+			t1 = microtime();
+			std::fprintf(stdout, "      %-12s %s: %6.2fns per byte\n",
+			             loops[k].name, argv[i + 1],
+			             (double)(t1 - t0) * 1000.0 /
+			                 ((double)files[i].size() * N_REPEAT));
+		}
+		if (sums[0] != sums[1] || sums[0] != sums[2]) {
+			FX_PRINT_ERR("Checksums differ!\n");
+			return 1;
+		}
+	}
+	FX_PRINT_OK("Done parsing files.\n");
+	return 0;
+}
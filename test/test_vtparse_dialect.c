@@ -0,0 +1,290 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_dialect.c
+ *
+ * Unit tests for the custom dialects built at runtime.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse.h>
+#include <vtparse/vtparse_dialect.h>
+
+#define MAX_TRANSCRIPT 1024U
+
+/* Appends a printable representation of the given byte to str */
+static void append_byte(char *str, unsigned char c) {
+	char tmp[8];
+	if (c >= 0x20 && c < 0x7F && c != '\\') {
+		sprintf(tmp, "%c", c);
+	} else {
+		sprintf(tmp, "\\x%02x", c);
+	}
+	strcat(str, tmp);
+}
+
+/* Writes a textual transcript of the events produced for the given input,
+   parsed in chunks of max_chunk bytes, to str. Consecutive data events with
+   the same action are merged, such that the transcript does not depend on
+   the chunk size. */
+static void transcript(char *str, const vtparse_dialect_t *dialect,
+                       unsigned int event_mask, const char *input,
+                       unsigned int max_chunk) {
+	const unsigned char *buf = (const unsigned char *)input;
+	const unsigned int len = (unsigned int)strlen(input);
+	const unsigned char *p;
+	unsigned int pos = 0, end;
+	vtparse_action_t last = 0;
+	vtparse_t parser;
+	char tmp[32];
+	int i;
+
+	str[0] = 0;
+	vtparse_init(&parser);
+	vtparse_set_dialect(&parser, dialect);
+	vtparse_set_event_mask(&parser, event_mask);
+	while (pos < len) {
+		end = (pos + max_chunk > len) ? len : (pos + max_chunk);
+		while (1) {
+			pos += vtparse_parse(&parser, buf + pos, end - pos);
+			if (!vtparse_has_event(&parser)) {
+				break;
+			}
+			if (parser.data_begin != parser.data_end) {
+				if (parser.action != last) {
+					sprintf(tmp, "%s%s:", str[0] ? " " : "",
+					        vtparse_action_str(parser.action));
+					strcat(str, tmp);
+				}
+				for (p = parser.data_begin; p < parser.data_end; p++) {
+					append_byte(str, *p);
+				}
+				last = parser.action;
+				continue;
+			}
+			sprintf(tmp, "%s%s:", str[0] ? " " : "",
+			        vtparse_action_str(parser.action));
+			strcat(str, tmp);
+			append_byte(str, (unsigned char)parser.ch);
+			if (parser.action == VTPARSE_ACTION_CSI_DISPATCH ||
+			    parser.action == VTPARSE_ACTION_HOOK) {
+				for (i = 0; i < parser.num_params; i++) {
+					sprintf(tmp, "%c%d", i ? ';' : '(', parser.params[i]);
+					strcat(str, tmp);
+				}
+				strcat(str, parser.num_params ? ")" : "");
+			}
+			last = 0;
+		}
+	}
+}
+
+/* Checks that the transcript is the same for all chunk sizes */
+static int same_transcript(const char *expected,
+                           const vtparse_dialect_t *dialect,
+                           unsigned int event_mask, const char *input) {
+	static char str[MAX_TRANSCRIPT];
+	unsigned int chunk;
+
+	for (chunk = 1; chunk <= strlen(input); chunk++) {
+		transcript(str, dialect, event_mask, input, chunk);
+		if (strcmp(str, expected) != 0) {
+			fprintf(stderr, "chunk %u:\n  expected: %s\n  got:      %s\n",
+			        chunk, expected, str);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static const char *mixed_input =
+    "Hello\r\n\033[1;31mred\033[0m\033(B\033]0;title\007\033P1$qm\033\\"
+    "\033[?25l\tx\033[12;34;56H\033#8\033Xsos\033\\\033[1\033[2m.";
+
+void test_dialect_default() {
+	static const vtparse_dialect_rule_t rules[] = {VTPARSE_RULE_END};
+	static char expected[MAX_TRANSCRIPT], got[MAX_TRANSCRIPT];
+	static vtparse_dialect_t builtin, dialect;
+	unsigned int s;
+
+	/* Deriving the run classes reproduces the generated ones, which
+	   vtparse_dialect_init() copies */
+	vtparse_dialect_init(&builtin);
+	vtparse_dialect_init(&dialect);
+	EXPECT_TRUE(vtparse_dialect_apply(&dialect, rules));
+	for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+		EXPECT_EQ(0, memcmp(&builtin.run_classes[s], &dialect.run_classes[s],
+		                    sizeof(vtparse_run_class_t)));
+	}
+	EXPECT_EQ(0, memcmp(builtin.state_table, dialect.state_table,
+	                    sizeof(builtin.state_table)));
+
+	/* A copy of the built-in dialect produces the same events */
+	transcript(expected, NULL, VTPARSE_EVENT_MASK_ALL, mixed_input,
+	           MAX_TRANSCRIPT);
+	transcript(got, &dialect, VTPARSE_EVENT_MASK_ALL, mixed_input,
+	           MAX_TRANSCRIPT);
+	EXPECT_EQ(0, strcmp(expected, got));
+	EXPECT_TRUE(same_transcript(expected, &dialect, VTPARSE_EVENT_MASK_ALL,
+	                            mixed_input));
+}
+
+void test_dialect_invalid() {
+	static const vtparse_dialect_rule_t bad_state[] = {
+	    VTPARSE_RULE(VTPARSE_NUM_STATES + 1, 0x20, 0x20, 0, 0),
+	    VTPARSE_RULE_END};
+	static const vtparse_dialect_rule_t bad_target[] = {
+	    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0x20, 0x20, 0,
+	                 VTPARSE_NUM_STATES + 1),
+	    VTPARSE_RULE_END};
+	static const vtparse_dialect_rule_t bad_range[] = {
+	    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0x21, 0x20, 0, 0),
+	    VTPARSE_RULE_END};
+	static const vtparse_dialect_rule_t bad_action[] = {
+	    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_GROUND, VTPARSE_ACTION_ERROR),
+	    VTPARSE_RULE_END};
+	static const vtparse_dialect_rule_t bad_late[] = {
+	    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x00, 0xFF, 0, 0),
+	    {7, 0, 0, 0, 0, 0},
+	    VTPARSE_RULE_END};
+	static vtparse_dialect_t dialect, copy;
+
+	vtparse_dialect_init(&dialect);
+	copy = dialect;
+	EXPECT_FALSE(vtparse_dialect_apply(&dialect, bad_state));
+	EXPECT_FALSE(vtparse_dialect_apply(&dialect, bad_target));
+	EXPECT_FALSE(vtparse_dialect_apply(&dialect, bad_range));
+	EXPECT_FALSE(vtparse_dialect_apply(&dialect, bad_action));
+	EXPECT_FALSE(vtparse_dialect_apply(&dialect, bad_late));
+	EXPECT_EQ(0, memcmp(&dialect, &copy, sizeof(dialect)));
+	EXPECT_EQ(NULL, vtparse_dialect_preset(0));
+}
+
+void test_dialect_from_scratch() {
+	/* Everything is printed, including escape sequences */
+	static const vtparse_dialect_rule_t rules[] = {
+	    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x00, 0xFF, 0, 0),
+	    VTPARSE_RULE_ON_ENTRY(VTPARSE_DIALECT_ANYWHERE, 0),
+	    VTPARSE_RULE_ON_EXIT(VTPARSE_DIALECT_ANYWHERE, 0),
+	    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0x00, 0xFF, VTPARSE_ACTION_PRINT, 0),
+	    VTPARSE_RULE_END};
+	static vtparse_dialect_t dialect;
+	const unsigned char buf[] = "a\033[1mb\n\377";
+	vtparse_t parser;
+
+	vtparse_dialect_init(&dialect);
+	EXPECT_TRUE(vtparse_dialect_apply(&dialect, rules));
+	EXPECT_EQ(1, dialect.run_classes[VTPARSE_STATE_GROUND - 1].num_ranges);
+
+	vtparse_init(&parser);
+	vtparse_set_dialect(&parser, &dialect);
+	EXPECT_EQ(sizeof(buf) - 1U, vtparse_parse(&parser, buf, sizeof(buf) - 1U));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf, parser.data_begin);
+	EXPECT_EQ(buf + sizeof(buf) - 1U, parser.data_end);
+
+	/* vtparse_init() selects the built-in dialect again */
+	vtparse_init(&parser);
+	EXPECT_EQ(5U, vtparse_parse(&parser, buf, sizeof(buf) - 1U));
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser.action);
+	EXPECT_EQ(buf + 1, parser.data_end);
+}
+
+void test_dialect_c1() {
+	static vtparse_dialect_t dialect;
+
+	vtparse_dialect_init(&dialect);
+	EXPECT_TRUE(vtparse_dialect_apply(
+	    &dialect, vtparse_dialect_preset(VTPARSE_DIALECT_C1)));
+	EXPECT_TRUE(same_transcript(
+	    "PRINT:a CSI_DISPATCH:H(1;2) PRINT:b EXECUTE:\\x85 PRINT:\\xe9 "
+	    "OSC_START:\\x9d OSC_PUT:t OSC_END:\\x9c CSI_DISPATCH:m(0)",
+	    &dialect, VTPARSE_EVENT_MASK_ALL,
+	    "a\2331;2Hb\205\351\235t\234\2330m"));
+
+	/* Without the dialect, the C1 bytes are printed */
+	EXPECT_TRUE(same_transcript("PRINT:a\\x9b1;2Hb", NULL,
+	                            VTPARSE_EVENT_MASK_ALL, "a\2331;2Hb"));
+}
+
+void test_dialect_no_dcs() {
+	static vtparse_dialect_t dialect;
+
+	vtparse_dialect_init(&dialect);
+	EXPECT_TRUE(vtparse_dialect_apply(
+	    &dialect, vtparse_dialect_preset(VTPARSE_DIALECT_NO_DCS)));
+	EXPECT_TRUE(same_transcript(
+	    "ESC_DISPATCH:\\x5c PRINT:x CSI_DISPATCH:m(1)", &dialect,
+	    VTPARSE_EVENT_MASK_ALL, "\033P1$qm\033\\x\033[1m"));
+
+	/* The C1 DCS introducer is covered as well */
+	EXPECT_TRUE(vtparse_dialect_apply(
+	    &dialect, vtparse_dialect_preset(VTPARSE_DIALECT_C1)));
+	EXPECT_TRUE(vtparse_dialect_apply(
+	    &dialect, vtparse_dialect_preset(VTPARSE_DIALECT_NO_DCS)));
+	EXPECT_TRUE(same_transcript("PRINT:x", &dialect, VTPARSE_EVENT_MASK_ALL,
+	                            "\2201$qm\234x"));
+}
+
+void test_dialect_tmux() {
+	static vtparse_dialect_t dialect;
+	const unsigned int mask =
+	    VTPARSE_EVENT_MASK_ALL & ~VTPARSE_EVENT_MASK(VTPARSE_ACTION_PUT);
+
+	vtparse_dialect_init(&dialect);
+	EXPECT_TRUE(vtparse_dialect_apply(
+	    &dialect, vtparse_dialect_preset(VTPARSE_DIALECT_TMUX)));
+
+	/* Doubled ESCs are passed through as a single ESC */
+	EXPECT_TRUE(same_transcript(
+	    "HOOK:t PUT:mux;\\x1b[1m\\x1b\\x1b]0;x\\x07 UNHOOK:\\x5c PRINT:x",
+	    &dialect, VTPARSE_EVENT_MASK_ALL,
+	    "\033Ptmux;\033\033[1m\033\033\033\033]0;x\007\033\\x"));
+	EXPECT_TRUE(same_transcript("HOOK:t UNHOOK:\\x5c PRINT:x", &dialect, mask,
+	                            "\033Ptmux;\033\033[1m\033\\x"));
+
+	/* Regular device control strings and aborted strings */
+	EXPECT_TRUE(same_transcript("HOOK:q(1) PUT:m UNHOOK:\\x5c", &dialect,
+	                            VTPARSE_EVENT_MASK_ALL, "\033P1$qm\033\\"));
+	EXPECT_TRUE(same_transcript("HOOK:q PUT:ab UNHOOK:[ CSI_DISPATCH:m(1)",
+	                            &dialect, VTPARSE_EVENT_MASK_ALL,
+	                            "\033Pqab\033[1m"));
+	EXPECT_TRUE(same_transcript("HOOK:q PUT:ab UNHOOK:\\x18 PRINT:x",
+	                            &dialect, VTPARSE_EVENT_MASK_ALL,
+	                            "\033Pqab\030x"));
+	EXPECT_TRUE(same_transcript("ESC_DISPATCH:\\x5c PRINT:x", &dialect,
+	                            VTPARSE_EVENT_MASK_ALL, "\033P:ab\033\033\\x"));
+}
+
+int main() {
+	RUN(test_dialect_default);
+	RUN(test_dialect_invalid);
+	RUN(test_dialect_from_scratch);
+	RUN(test_dialect_c1);
+	RUN(test_dialect_no_dcs);
+	RUN(test_dialect_tmux);
+	DONE;
+}
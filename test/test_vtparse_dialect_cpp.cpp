@@ -0,0 +1,173 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_dialect_cpp.cpp
+ *
+ * Tests for the dialects built at compile time in vtparse_dialect.hpp. The
+ * checked-in tables are included as constexpr data, such that the tables
+ * expanded from vtparse::builtin_rules can be compared in a static_assert.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <string>
+#include <string_view>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_dialect.hpp>
+
+namespace checked_in {
+#undef VTPARSE_TABLE_DEF
+#define VTPARSE_TABLE_DEF inline constexpr
+#include <vtparse/vtparse_table.c>
+}  // namespace checked_in
+
+static constexpr bool equals_checked_in(const vtparse_dialect_t &d) {
+	for (unsigned int s = 0; s < VTPARSE_NUM_STATES; s++) {
+		for (unsigned int c = 0; c < 256U; c++) {
+			if (d.state_table[s][c] != checked_in::STATE_TABLE[s][c]) {
+				return false;
+			}
+		}
+		if (d.entry_actions[s] != checked_in::ENTRY_ACTIONS[s] ||
+		    d.exit_actions[s] != checked_in::EXIT_ACTIONS[s]) {
+			return false;
+		}
+		const vtparse_run_class_t &a = d.run_classes[s];
+		const vtparse_run_class_t &b = checked_in::RUN_CLASSES[s];
+		if (a.action != b.action || a.num_ranges != b.num_ranges) {
+			return false;
+		}
+		for (unsigned int i = 0; i < VTPARSE_MAX_RUN_RANGES; i++) {
+			if (a.lo[i] != b.lo[i] || a.hi[i] != b.hi[i]) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static_assert(equals_checked_in(vtparse::builtin_dialect),
+              "vtparse::builtin_rules and tables/vtparse_tables.rb differ");
+
+static bool equals(const vtparse_dialect_t &a, const vtparse_dialect_t &b) {
+	for (unsigned int s = 0; s < VTPARSE_NUM_STATES; s++) {
+		for (unsigned int c = 0; c < 256U; c++) {
+			if (a.state_table[s][c] != b.state_table[s][c]) {
+				return false;
+			}
+		}
+		if (a.entry_actions[s] != b.entry_actions[s] ||
+		    a.exit_actions[s] != b.exit_actions[s] ||
+		    a.run_classes[s].action != b.run_classes[s].action ||
+		    a.run_classes[s].num_ranges != b.run_classes[s].num_ranges) {
+			return false;
+		}
+		for (unsigned int i = 0; i < a.run_classes[s].num_ranges; i++) {
+			if (a.run_classes[s].lo[i] != b.run_classes[s].lo[i] ||
+			    a.run_classes[s].hi[i] != b.run_classes[s].hi[i]) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/* Same rules as VTPARSE_DIALECT_NO_DCS */
+static constexpr vtparse_dialect_rule_t no_dcs_rules[] = {
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x40, 0x7e, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x40, 0x7e, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x40, 0x7e, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE_END};
+
+static constexpr vtparse_dialect_t no_dcs =
+    vtparse::make_dialect(vtparse::builtin_rules, no_dcs_rules);
+
+/* A copy of the built-in dialect, attached like any custom dialect */
+static constexpr vtparse_dialect_t builtin_copy =
+    vtparse::make_dialect(vtparse::builtin_rules);
+
+/* Returns a textual description of the events produced for the given input */
+template <typename Parser>
+static std::string transcript(Parser &p, std::string_view input) {
+	std::string str;
+	p.parse(input, [&str](const vtparse::event &e) {
+		str += str.empty() ? "" : " ";
+		str += vtparse_action_str(e.action());
+		if (e.has_data()) {
+			str += ":";
+			str += e.data();
+		}
+	});
+	return str;
+}
+
+static const std::string_view input =
+    "ab\033[1;22mc\033]0;title\007\033P1$qx\033\\d";
+
+void test_dialect_cpp_builtin() {
+	vtparse_dialect_t d;
+
+	vtparse_dialect_init(&d);
+	EXPECT_TRUE(equals(d, vtparse::builtin_dialect));
+	EXPECT_TRUE(equals(d, builtin_copy));
+}
+
+void test_dialect_cpp_no_dcs() {
+	vtparse_dialect_t d;
+
+	vtparse_dialect_init(&d);
+	ASSERT_TRUE(
+	    vtparse_dialect_apply(&d, vtparse_dialect_preset(VTPARSE_DIALECT_NO_DCS)));
+	EXPECT_TRUE(equals(d, no_dcs));
+}
+
+void test_dialect_cpp_parser() {
+	vtparse::dialect_parser<vtparse::builtin_dialect> builtin;
+	vtparse::dialect_parser<builtin_copy> copy;
+	vtparse::dialect_parser<no_dcs> p;
+	const char *expected =
+	    "PRINT:ab CSI_DISPATCH PRINT:c OSC_START OSC_PUT:0;title OSC_END "
+	    "HOOK PUT:x UNHOOK ESC_DISPATCH PRINT:d";
+
+	/* The built-in dialect uses the tables compiled into the library */
+	EXPECT_TRUE(builtin.raw().priv_.dialect == nullptr);
+	EXPECT_TRUE(copy.raw().priv_.dialect == &builtin_copy);
+	EXPECT_TRUE(transcript(builtin, input) == expected);
+	EXPECT_TRUE(transcript(copy, input) == expected);
+
+	/* The device control string is ignored; reset() keeps the dialect */
+	p.reset();
+	EXPECT_TRUE(p.raw().priv_.dialect == &no_dcs);
+	EXPECT_TRUE(transcript(p, input) ==
+	            "PRINT:ab CSI_DISPATCH PRINT:c OSC_START OSC_PUT:0;title "
+	            "OSC_END ESC_DISPATCH PRINT:d");
+}
+
+int main() {
+	RUN(test_dialect_cpp_builtin);
+	RUN(test_dialect_cpp_no_dcs);
+	RUN(test_dialect_cpp_parser);
+	DONE;
+}
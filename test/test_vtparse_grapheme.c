@@ -0,0 +1,258 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_grapheme.c
+ *
+ * Unit tests for the grapheme cluster segmenter. Checks the cluster
+ * boundaries of a few strings covering the segmentation rules, and that the
+ * result does not depend on how the input is split.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_grapheme.h>
+
+#define MAX_BOUNDARIES 8U
+#define INPUT_LEN 20000U
+
+typedef struct {
+	const char *str;
+	unsigned int boundaries[MAX_BOUNDARIES];
+	unsigned int num_boundaries;
+} test_vector_t;
+
+/* Offsets of the cluster boundaries */
+static const test_vector_t vectors[] = {
+    {"abc", {0, 1, 2}, 3},
+    /* Combining marks */
+    {"e\314\201x", {0, 3}, 2},
+    {"a\314\210\314\201\314\243b", {0, 7}, 2},
+    /* Regional indicators */
+    {"\360\237\207\251\360\237\207\252\360\237\207\253\360\237\207\267",
+     {0, 8}, 2},
+    {"\360\237\207\251\360\237\207\252\360\237\207\253", {0, 8}, 2},
+    /* Emoji ZWJ sequences and modifiers */
+    {"\360\237\221\250\342\200\215\360\237\221\251\342\200\215\360\237\221\247!",
+     {0, 18}, 2},
+    {"\360\237\221\215\360\237\217\275a", {0, 8}, 2},
+    {"x\360\237\230\200\314\201\342\200\215\360\237\230\200", {0, 1}, 2},
+    {"\342\235\244\357\270\217\342\200\215\360\237\224\245", {0}, 1},
+    {"\360\237\217\263\357\270\217\342\200\215\360\237\214\210", {0}, 1},
+    {"a\342\200\215b", {0, 4}, 2},
+    /* Hangul syllables spelled in Jamo */
+    {"\341\204\200\341\205\241\341\206\250\352\260\200", {0, 9}, 2},
+    /* Spacing marks and prepended concatenation marks */
+    {"\340\244\250\340\244\256\340\244\270\340\245\215\340\244\244\340\245\207",
+     {0, 3, 6, 12}, 4},
+    {"\340\270\201\340\270\263", {0}, 1},
+    {"\330\200a", {0}, 1},
+    {"\344\275\240\345\245\275\344\270\226\347\225\214", {0, 3, 6, 9}, 4},
+};
+
+#define N_VECTORS (sizeof(vectors) / sizeof(vectors[0]))
+
+static unsigned int length(const char *str) {
+	unsigned int len = 0;
+	while (str[len]) {
+		len++;
+	}
+	return len;
+}
+
+/* Segments the string in pieces of the given size and records the offsets at
+   which vtparse_grapheme_next() starts a new cluster. A segment starts where
+   the preceding non-empty segment ended, since a character may be split
+   between pieces. */
+static unsigned int segment(const char *str, unsigned int piece,
+                            unsigned int *boundaries) {
+	const unsigned char *buf = (const unsigned char *)str;
+	const unsigned int len = length(str);
+	vtparse_grapheme_t grapheme;
+	unsigned int pos = 0, start = 0, end, n, n_boundaries = 0;
+	const unsigned char *p;
+
+	vtparse_grapheme_init(&grapheme);
+	while (pos < len) {
+		end = (len - pos > piece) ? pos + piece : len;
+		while (pos < end) {
+			n = vtparse_grapheme_next(&grapheme, buf + pos, end - pos);
+			for (p = grapheme.ascii_begin; p < grapheme.ascii_end; p++) {
+				if (n_boundaries < MAX_BOUNDARIES) {
+					boundaries[n_boundaries] = (unsigned int)(p - buf);
+				}
+				n_boundaries++;
+			}
+			if (grapheme.num_codepoints > 0U && !grapheme.extends) {
+				if (n_boundaries < MAX_BOUNDARIES) {
+					boundaries[n_boundaries] = start;
+				}
+				n_boundaries++;
+			}
+			pos += n;
+			if (grapheme.num_codepoints > 0U ||
+			    grapheme.ascii_begin != grapheme.ascii_end) {
+				start = pos;
+			}
+		}
+	}
+	return n_boundaries;
+}
+
+static unsigned int count(const char *str, unsigned int piece) {
+	const unsigned char *buf = (const unsigned char *)str;
+	const unsigned int len = length(str);
+	vtparse_grapheme_t grapheme;
+	unsigned int pos, n = 0;
+
+	vtparse_grapheme_init(&grapheme);
+	for (pos = 0; pos < len; pos += piece) {
+		n += vtparse_grapheme_count(&grapheme, buf + pos,
+		                            (len - pos > piece) ? piece : len - pos);
+	}
+	return n;
+}
+
+void test_grapheme_vectors() {
+	unsigned int boundaries[MAX_BOUNDARIES], i, j, n;
+	for (i = 0; i < N_VECTORS; i++) {
+		n = segment(vectors[i].str, 1000U, boundaries);
+		EXPECT_EQ(vectors[i].num_boundaries, n);
+		for (j = 0; j < n && j < MAX_BOUNDARIES; j++) {
+			EXPECT_EQ(vectors[i].boundaries[j], boundaries[j]);
+		}
+		EXPECT_EQ(vectors[i].num_boundaries, count(vectors[i].str, 1000U));
+	}
+}
+
+void test_grapheme_split() {
+	unsigned int boundaries[MAX_BOUNDARIES], i, j, n, piece;
+	for (i = 0; i < N_VECTORS; i++) {
+		for (piece = 1; piece <= 4U; piece++) {
+			n = segment(vectors[i].str, piece, boundaries);
+			EXPECT_EQ(vectors[i].num_boundaries, n);
+			for (j = 0; j < n && j < MAX_BOUNDARIES; j++) {
+				EXPECT_EQ(vectors[i].boundaries[j], boundaries[j]);
+			}
+			EXPECT_EQ(vectors[i].num_boundaries, count(vectors[i].str, piece));
+		}
+	}
+}
+
+void test_grapheme_break() {
+	const unsigned char e[] = "e", acute[] = "\314\201";
+	vtparse_grapheme_t grapheme;
+
+	/* A combining mark continues the cluster of the preceding range... */
+	vtparse_grapheme_init(&grapheme);
+	EXPECT_EQ(1U, vtparse_grapheme_count(&grapheme, e, 1U));
+	EXPECT_EQ(0U, vtparse_grapheme_count(&grapheme, acute, 2U));
+	EXPECT_EQ(2U, vtparse_grapheme_next(&grapheme, acute, 2U));
+	EXPECT_TRUE(grapheme.extends);
+	EXPECT_EQ(1U, grapheme.num_codepoints);
+	EXPECT_EQ(0x0301UL, grapheme.codepoints[0]);
+
+	/* ...unless a control character was in between */
+	vtparse_grapheme_count(&grapheme, e, 1U);
+	EXPECT_FALSE(vtparse_grapheme_break(&grapheme));
+	EXPECT_EQ(1U, vtparse_grapheme_count(&grapheme, acute, 2U));
+	vtparse_grapheme_break(&grapheme);
+	vtparse_grapheme_next(&grapheme, acute, 2U);
+	EXPECT_FALSE(grapheme.extends);
+
+	/* An incomplete character is carried over */
+	EXPECT_EQ(1U, vtparse_grapheme_next(&grapheme, acute, 1U));
+	EXPECT_EQ(0U, grapheme.num_codepoints);
+	EXPECT_TRUE(grapheme.ascii_begin == grapheme.ascii_end);
+	EXPECT_EQ(1U, vtparse_grapheme_next(&grapheme, acute + 1, 1U));
+	EXPECT_EQ(1U, grapheme.num_codepoints);
+	EXPECT_TRUE(grapheme.extends);
+}
+
+static unsigned int rnd(unsigned int *seed) {
+	*seed = *seed * 1103515245U + 12345U;
+	return (*seed >> 16U) & 0x7FFFU;
+}
+
+void test_grapheme_random() {
+	static const char *chars[] = {
+	    "a", "Z", " ", "\303\251", "\314\201", "\342\200\215", "\360\237\207\251",
+	    "\360\237\230\200", "\360\237\217\275", "\344\275\240", "\341\204\200",
+	    "\341\205\241", "\341\206\250", "\352\260\200", "\340\244\270",
+	    "\340\245\207", "\330\200", "\357\270\217", "\377"};
+	static unsigned char buf[INPUT_LEN];
+	vtparse_grapheme_t grapheme;
+	unsigned int i, j, pos, len, n, n_ref, n_next, seed = 4711U;
+	const char *c;
+	int isa, ok = 1;
+
+	for (i = 0; i < 20U; i++) {
+		for (pos = 0; pos < INPUT_LEN;) {
+			c = chars[rnd(&seed) % (sizeof(chars) / sizeof(chars[0]))];
+			for (j = 0; c[j] && pos < INPUT_LEN; j++) {
+				buf[pos++] = (unsigned char)c[j];
+			}
+		}
+
+		vtparse_set_isa(VTPARSE_ISA_SCALAR);
+		vtparse_grapheme_init(&grapheme);
+		n_ref = vtparse_grapheme_count(&grapheme, buf, INPUT_LEN);
+
+		for (isa = VTPARSE_ISA_SCALAR; isa <= VTPARSE_ISA_AVX512; isa++) {
+			if (vtparse_set_isa(isa) != isa) {
+				continue;
+			}
+			vtparse_grapheme_init(&grapheme);
+			n = 0;
+			n_next = 0;
+			for (pos = 0; pos < INPUT_LEN; pos += len) {
+				len = 1U + rnd(&seed) % 100U;
+				len = len > INPUT_LEN - pos ? INPUT_LEN - pos : len;
+				n += vtparse_grapheme_count(&grapheme, buf + pos, len);
+			}
+			vtparse_grapheme_init(&grapheme);
+			for (pos = 0; pos < INPUT_LEN;) {
+				len = 1U + rnd(&seed) % 100U;
+				len = len > INPUT_LEN - pos ? INPUT_LEN - pos : len;
+				for (j = pos, pos += len; j < pos;) {
+					j += vtparse_grapheme_next(&grapheme, buf + j, pos - j);
+					n_next += (unsigned int)(grapheme.ascii_end -
+					                         grapheme.ascii_begin);
+					n_next += (grapheme.num_codepoints > 0U && !grapheme.extends)
+					              ? 1U
+					              : 0U;
+				}
+			}
+			ok = ok && n == n_ref && n_next == n_ref;
+		}
+	}
+	vtparse_set_isa(VTPARSE_ISA_AUTO);
+	EXPECT_TRUE(ok);
+}
+
+int main() {
+	RUN(test_grapheme_vectors);
+	RUN(test_grapheme_split);
+	RUN(test_grapheme_break);
+	RUN(test_grapheme_random);
+	DONE;
+}
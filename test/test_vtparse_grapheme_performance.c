@@ -0,0 +1,228 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_grapheme_performance.c
+ *
+ * Parses the given files and segments each PRINT span into grapheme clusters,
+ * both by counting the clusters and by iterating over the segments, with every
+ * instruction set supported by the CPU. Reports the throughput relative to the
+ * number of printed bytes. Without arguments, synthetic CJK, emoji and
+ * combining mark heavy inputs are used.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_grapheme.h>
+
+#define N_REPEAT 20
+#define MAX_SPANS (1U << 20U)
+#define SYNTHETIC_LEN (1U << 20U)
+
+static long long int nanotime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return tp.tv_sec * 1000LL * 1000LL * 1000LL + tp.tv_nsec;
+}
+
+static unsigned char *read_file(const char *filename, unsigned int *len) {
+	unsigned char *buf = NULL, *new_buf;
+	size_t n;
+	FILE *f = fopen(filename, "rb");
+	*len = 0;
+	if (!f) {
+		return NULL;
+	}
+	do {
+		if (!(new_buf = realloc(buf, *len + 65536U))) {
+			break;
+		}
+		buf = new_buf;
+		n = fread(buf + *len, 1, 65536U, f);
+		*len += (unsigned int)n;
+	} while (n > 0);
+	fclose(f);
+	return buf;
+}
+
+/* Fills a buffer with lines of words randomly drawn from the given list,
+   separated by SGR sequences */
+static unsigned char *synthesize(const char **words, unsigned int n_words,
+                                 unsigned int *len) {
+	unsigned char *buf = malloc(SYNTHETIC_LEN);
+	unsigned int pos = 0, seed = 4711U, word_len;
+	const char *word;
+	if (!buf) {
+		return NULL;
+	}
+	while (1) {
+		seed = seed * 1103515245U + 12345U;
+		switch ((seed >> 16U) % 16U) {
+			case 0:
+				word = "\r\n";
+				break;
+			case 1:
+				word = "\033[1;31m";
+				break;
+			case 2:
+				word = "\033[0m";
+				break;
+			default:
+				word = words[(seed >> 20U) % n_words];
+				break;
+		}
+		word_len = (unsigned int)strlen(word);
+		if (pos + word_len > SYNTHETIC_LEN) {
+			break;
+		}
+		memcpy(buf + pos, word, word_len);
+		pos += word_len;
+	}
+	*len = pos;
+	return buf;
+}
+
+static void benchmark(const char *name, const unsigned char *input,
+                      unsigned int input_len) {
+	static const char *names[] = {"scalar", "sse2", "avx2", "avx512"};
+	static const char *modes[] = {"count", "next"};
+	static const unsigned char *spans[MAX_SPANS];
+	static unsigned int span_lens[MAX_SPANS];
+	unsigned int pos, n_spans, n_bytes, i, n_result;
+	vtparse_t parser;
+	vtparse_grapheme_t grapheme;
+	long long int t0, tsum;
+	int isa, mode, k;
+
+	/* Collect the spans first, so only the segmenter is measured */
+	vtparse_init(&parser);
+	n_spans = 0;
+	n_bytes = 0;
+	pos = 0;
+	while (n_spans < MAX_SPANS) {
+		pos += vtparse_parse(&parser, input + pos, input_len - pos);
+		if (!vtparse_has_event(&parser)) {
+			break;
+		}
+		if (parser.action == VTPARSE_ACTION_PRINT) {
+			spans[n_spans] = parser.data_begin;
+			span_lens[n_spans] =
+			    (unsigned int)(parser.data_end - parser.data_begin);
+			n_bytes += span_lens[n_spans++];
+		}
+	}
+
+	for (isa = VTPARSE_ISA_SCALAR; isa <= VTPARSE_ISA_AVX512; isa++) {
+		if (vtparse_set_isa(isa) != isa) {
+			continue;
+		}
+		for (mode = 0; mode < 2; mode++) {
+			tsum = 0;
+			n_result = 0;
+			for (k = 0; k < N_REPEAT; k++) {
+				n_result = 0;
+				t0 = nanotime();
+				vtparse_grapheme_init(&grapheme);
+				for (i = 0; i < n_spans; i++) {
+					if (mode == 0) {
+						n_result += vtparse_grapheme_count(&grapheme, spans[i],
+						                                   span_lens[i]);
+						continue;
+					}
+					for (pos = 0; pos < span_lens[i];) {
+						pos += vtparse_grapheme_next(&grapheme, spans[i] + pos,
+						                             span_lens[i] - pos);
+						n_result += (unsigned int)(grapheme.ascii_end -
+						                           grapheme.ascii_begin);
+						n_result +=
+						    (grapheme.num_codepoints > 0U && !grapheme.extends)
+						        ? 1U
+						        : 0U;
+					}
+				}
+				tsum += nanotime() - t0;
+			}
+			fprintf(stdout,
+			        "      %-8s %-6s \"%s\": %.1f MiB/s, %u spans, %u bytes, "
+			        "%u clusters\n",
+			        names[isa - VTPARSE_ISA_SCALAR], modes[mode], name,
+			        (double)n_bytes * N_REPEAT / (1024.0 * 1024.0) /
+			            ((double)tsum * 1e-9),
+			        n_spans, n_bytes, n_result);
+		}
+	}
+	vtparse_set_isa(VTPARSE_ISA_AUTO);
+}
+
+int main(int argc, char *argv[]) {
+	static const char *cjk[] = {
+	    "\344\275\240\345\245\275", "\344\270\226\347\225\214",
+	    "\346\227\245\346\234\254\350\252\236", "\355\225\234\352\265\255\354\226\264",
+	    "\343\201\223\343\202\223\343\201\253\343\201\241\343\201\257", " "};
+	static const char *emoji[] = {
+	    "\360\237\230\200", "\360\237\221\215\360\237\217\275",
+	    "\360\237\207\251\360\237\207\252",
+	    "\360\237\221\250\342\200\215\360\237\221\251\342\200\215\360\237\221\247",
+	    "\342\235\244\357\270\217", "ok ", " "};
+	static const char *combining[] = {
+	    "e\314\201", "a\314\210\314\201\314\243", "\340\244\250\340\244\256\340\244\270\340\245\215\340\244\244\340\245\207",
+	    "\341\204\200\341\205\241\341\206\250", "word ", " "};
+	static const char **synthetic[] = {cjk, emoji, combining};
+	static const unsigned int n_synthetic[] = {
+	    sizeof(cjk) / sizeof(cjk[0]), sizeof(emoji) / sizeof(emoji[0]),
+	    sizeof(combining) / sizeof(combining[0])};
+	static const char *synthetic_names[] = {"<cjk>", "<emoji>", "<combining>"};
+	unsigned char *input;
+	unsigned int input_len;
+	int j;
+
+	FX_PRINT_ARROW("Segmenting PRINT spans into grapheme clusters\n");
+	if (argc <= 1) {
+		for (j = 0; j < 3; j++) {
+			input = synthesize(synthetic[j], n_synthetic[j], &input_len);
+			if (!input) {
+				FX_PRINT_ERR("Out of memory!\n");
+				return 1;
+			}
+			benchmark(synthetic_names[j], input, input_len);
+			free(input);
+		}
+	}
+	for (j = 1; j < argc; j++) {
+		input = read_file(argv[j], &input_len);
+		if (!input || input_len == 0U) {
+			FX_PRINT_ERR("Error while reading \"%s\"!\n", argv[j]);
+			return 1;
+		}
+		benchmark(argv[j], input, input_len);
+		free(input);
+	}
+	FX_PRINT_OK("Done segmenting PRINT spans.\n");
+	return 0;
+}
@@ -0,0 +1,213 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_hot.c
+ *
+ * Verifies the transitions inlined from a transition frequency profile (see
+ * tables/vtparse_gen_hot_transitions.rb) and, if enabled, the stride-2 engine
+ * by comparing the events produced by vtparse_parse() with those of the
+ * reference parser built without them in test_vtparse_hot_reference.c.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse.h>
+
+#define INPUT_LEN 16384U
+
+/* Reference parser, see test_vtparse_hot_reference.c */
+void reference_init(vtparse_t *parser, unsigned int options,
+                    unsigned int event_mask);
+unsigned int reference_parse(vtparse_t *parser, const unsigned char *buf,
+                             unsigned int len, int *has_event);
+
+static void library_init(vtparse_t *parser, unsigned int options,
+                         unsigned int event_mask) {
+	vtparse_init(parser);
+	vtparse_set_options(parser, options);
+	vtparse_set_event_mask(parser, event_mask);
+}
+
+static unsigned int library_parse(vtparse_t *parser, const unsigned char *buf,
+                                  unsigned int len, int *has_event) {
+	const unsigned int n_read = vtparse_parse(parser, buf, len);
+	if ((*has_event = vtparse_has_event(parser))) {
+		vtparse_decode_params(parser);
+	}
+	return n_read;
+}
+
+typedef void (*init_fn)(vtparse_t *, unsigned int, unsigned int);
+typedef unsigned int (*parse_fn)(vtparse_t *, const unsigned char *,
+                                 unsigned int, int *);
+
+/* Folds the event held by the parser into the given hash; data ranges are
+   hashed byte by byte, such that the result does not depend on how they are
+   split */
+static unsigned long fold_event(unsigned long hash, const vtparse_t *parser) {
+	const unsigned char *p;
+	int i;
+
+	if (parser->data_begin != parser->data_end) {
+		for (p = parser->data_begin; p < parser->data_end; p++) {
+			hash = hash * 31UL + (unsigned long)parser->action;
+			hash = hash * 31UL + *p;
+		}
+		return hash;
+	}
+	hash = hash * 31UL + (unsigned long)parser->action;
+	hash = hash * 31UL + (unsigned long)parser->ch;
+	hash = hash * 31UL + (unsigned long)parser->sequence;
+	if (parser->action != VTPARSE_ACTION_CSI_DISPATCH &&
+	    parser->action != VTPARSE_ACTION_ESC_DISPATCH &&
+	    parser->action != VTPARSE_ACTION_HOOK) {
+		return hash;
+	}
+	for (i = 0; i < parser->num_params; i++) {
+		hash = hash * 31UL + (unsigned long)parser->params[i];
+	}
+	for (i = 0; i < parser->num_intermediate_chars; i++) {
+		hash = hash * 31UL + (unsigned long)parser->intermediate_chars[i];
+	}
+	return hash;
+}
+
+/* Digest of the events produced by parsing buf in chunks of at most
+   max_chunk bytes */
+static unsigned long digest_events(init_fn init, parse_fn parse,
+                                   const unsigned char *buf, unsigned int len,
+                                   unsigned int max_chunk, unsigned int options,
+                                   unsigned int event_mask) {
+	vtparse_t parser;
+	unsigned long hash = 0;
+	unsigned int pos = 0, end = 0, seed = 1;
+	int has_event;
+
+	init(&parser, options, event_mask);
+	while (end < len) {
+		seed = seed * 1103515245U + 12345U;
+		end += 1U + (seed >> 16U) % max_chunk;
+		end = end > len ? len : end;
+		while (1) {
+			pos += parse(&parser, buf + pos, end - pos, &has_event);
+			if (!has_event) {
+				break;
+			}
+			hash = fold_event(hash, &parser);
+		}
+	}
+	return hash;
+}
+
+static int same_events(const unsigned char *buf, unsigned int len,
+                       unsigned int max_chunk, unsigned int options,
+                       unsigned int event_mask) {
+	return digest_events(library_init, library_parse, buf, len, max_chunk,
+	                     options, event_mask) ==
+	       digest_events(reference_init, reference_parse, buf, len, max_chunk,
+	                     options, event_mask);
+}
+
+static const unsigned int masks[] = {
+    VTPARSE_EVENT_MASK_ALL,
+    VTPARSE_EVENT_MASK_ALL & ~VTPARSE_EVENT_MASK(VTPARSE_ACTION_CSI_DISPATCH),
+    VTPARSE_EVENT_MASK_ALL & ~VTPARSE_EVENT_MASK(VTPARSE_ACTION_PRINT),
+    VTPARSE_EVENT_MASK(VTPARSE_ACTION_ESC_DISPATCH)};
+
+#define N_MASKS (sizeof(masks) / sizeof(masks[0]))
+
+static const unsigned int options[] = {
+    0U, VTPARSE_OPTION_LINE_SPANS, VTPARSE_OPTION_LAZY_PARAMS,
+    VTPARSE_OPTION_SEQUENCES,
+    VTPARSE_OPTION_LAZY_PARAMS | VTPARSE_OPTION_SEQUENCES};
+
+#define N_OPTIONS (sizeof(options) / sizeof(options[0]))
+
+/* Every byte read in every state of the state machine */
+void test_hot_all_transitions() {
+	static const char *prefixes[] = {
+	    "",          "\033",      "\033(",    "\033[",       "\033[1",
+	    "\033[1$",   "\033[1:",   "\033P",    "\033P1",      "\033P$",
+	    "\033P:",    "\033P1q",   "\033]0;",  "\033X"};
+	static const char suffix[] = "x;1m\033[m";
+	unsigned char buf[32];
+	unsigned int i, j, len, ch, k, ok = 1;
+
+	for (i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); i++) {
+		for (ch = 0; ch < 256U; ch++) {
+			len = 0;
+			for (j = 0; prefixes[i][j]; j++) {
+				buf[len++] = (unsigned char)prefixes[i][j];
+			}
+			buf[len++] = (unsigned char)ch;
+			for (j = 0; suffix[j]; j++) {
+				buf[len++] = (unsigned char)suffix[j];
+			}
+			for (k = 0; k < N_OPTIONS; k++) {
+				for (j = 0; j < N_MASKS; j++) {
+					ok = ok && same_events(buf, len, len, options[k], masks[j]);
+					ok = ok && same_events(buf, len, 2U, options[k], masks[j]);
+				}
+			}
+		}
+	}
+	EXPECT_TRUE(ok);
+}
+
+/* Random mix of control sequences, text and arbitrary bytes */
+void test_hot_random() {
+	static const char *snippets[] = {
+	    "\033[0m", "\033[38;5;208m", "\033[1;80H", "\033[?25l", "\033[K",
+	    "\033[12;34;56;78;90;12;34;56;78;90;12;34;56;78;90;12;34m",
+	    "\033(B", "\033#8", "\033[?1049h", "\033[>c", "\033[1$p",
+	    "\033]0;title\007", "\033]2;x\033\\", "\033P1$q\033\\", "\033Xsos\033\\",
+	    "hello ", "\r\n", "\t", "\b", "\303\244", "\033\033[m", "\033[1\033[2m"};
+	static unsigned char buf[INPUT_LEN];
+	unsigned int len = 0, seed = 4711U, n, i, j, k, chunk, ok = 1;
+
+	while (len < INPUT_LEN - 64U) {
+		seed = seed * 1103515245U + 12345U;
+		n = (seed >> 16U) % 32U;
+		if (n < sizeof(snippets) / sizeof(snippets[0])) {
+			for (i = 0; snippets[n][i]; i++) {
+				buf[len++] = (unsigned char)snippets[n][i];
+			}
+		} else {
+			buf[len++] = (unsigned char)(seed >> 24U);
+		}
+	}
+
+	for (k = 0; k < N_OPTIONS; k++) {
+		for (j = 0; j < N_MASKS; j++) {
+			for (chunk = 1U; chunk <= INPUT_LEN; chunk *= 8U) {
+				ok = ok && same_events(buf, len, chunk, options[k], masks[j]);
+			}
+		}
+	}
+	EXPECT_TRUE(ok);
+}
+
+int main() {
+	RUN(test_hot_all_transitions);
+	RUN(test_hot_random);
+	DONE;
+}
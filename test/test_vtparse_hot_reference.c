@@ -0,0 +1,49 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_hot_reference.c
+ *
+ * Reference parser for test_vtparse_hot.c: a private copy of vtparse pulled
+ * in via vtparse_amalgamated.h and built without the inlined transitions and
+ * the stride-2 engine, i.e. running every transition through the generic
+ * table-driven code.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define VTPARSE_NO_HOT_TRANSITIONS
+#undef VTPARSE_STRIDE2
+#include <vtparse/vtparse_amalgamated.h>
+
+void reference_init(vtparse_t *parser, unsigned int options,
+                    unsigned int event_mask) {
+	vtparse_init(parser);
+	vtparse_set_options(parser, options);
+	vtparse_set_event_mask(parser, event_mask);
+}
+
+unsigned int reference_parse(vtparse_t *parser, const unsigned char *buf,
+                             unsigned int len, int *has_event) {
+	const unsigned int n_read = vtparse_parse(parser, buf, len);
+	if ((*has_event = vtparse_has_event(parser))) {
+		vtparse_decode_params(parser);
+	}
+	return n_read;
+}
@@ -0,0 +1,253 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_ingest.c
+ *
+ * Unit tests for the ingestion module. Checks that both the io_uring backend
+ * and the read() fallback deliver the input in order and produce the same
+ * events as parsing the input in one go.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_ingest.h>
+
+#define INPUT_LEN 300000U
+
+static unsigned char *make_input(void) {
+	static const char *chunks[] = {"Hello World ", "\033[1;31m", "\r\n",
+	                               "\033[38;2;10;20;30m", "\033]0;title\007",
+	                               "\033P1$rdata\033\\", "\033[?25h", "x"};
+	unsigned char *buf = malloc(INPUT_LEN);
+	unsigned int pos = 0, i = 0, n;
+	while (pos < INPUT_LEN) {
+		n = (unsigned int)strlen(chunks[i % 8U]);
+		if (pos + n > INPUT_LEN) {
+			n = INPUT_LEN - pos;
+		}
+		memcpy(buf + pos, chunks[i % 8U], n);
+		pos += n;
+		i = i * 5U + 3U;
+	}
+	return buf;
+}
+
+static int make_file(const unsigned char *buf, unsigned int len) {
+	FILE *f = tmpfile();
+	int fd = dup(fileno(f));
+	EXPECT_EQ(len, (unsigned int)fwrite(buf, 1, len, f));
+	fclose(f);
+	lseek(fd, 0, SEEK_SET);
+	return fd;
+}
+
+/* Hash over all events that does not depend on where data spans are split */
+static int hash_event(void *user_data, vtparse_t *parser) {
+	unsigned long *hash = user_data;
+	unsigned char const *p;
+	int i;
+	if (parser->data_begin != parser->data_end) {
+		for (p = parser->data_begin; p < parser->data_end; p++) {
+			*hash = *hash * 31UL + *p + parser->action;
+		}
+	} else {
+		*hash = *hash * 31UL + parser->action * 1000UL + parser->ch;
+		for (i = 0; i < parser->num_params; i++) {
+			*hash = *hash * 31UL + (unsigned long)parser->params[i];
+		}
+	}
+	return 0;
+}
+
+static unsigned long hash_reference(const unsigned char *buf, unsigned int len) {
+	unsigned long hash = 0;
+	unsigned int pos = 0;
+	vtparse_t parser;
+	vtparse_init(&parser);
+	while (1) {
+		pos += vtparse_parse(&parser, buf + pos, len - pos);
+		if (!vtparse_has_event(&parser)) {
+			break;
+		}
+		hash_event(&hash, &parser);
+	}
+	return hash;
+}
+
+static void check_run(int fd, const vtparse_ingest_config_t *config,
+                      int expect_uring, unsigned long expected) {
+	unsigned long hash = 0;
+	vtparse_t parser;
+	vtparse_ingest_t *ingest = vtparse_ingest_open(fd, config);
+	EXPECT_TRUE(ingest != NULL);
+	if (expect_uring >= 0) {
+		EXPECT_EQ(expect_uring, vtparse_ingest_uses_uring(ingest));
+	}
+	vtparse_init(&parser);
+	EXPECT_EQ(0, vtparse_ingest_run(ingest, &parser, hash_event, &hash));
+	EXPECT_EQ(expected, hash);
+	vtparse_ingest_close(ingest);
+}
+
+void test_ingest_file() {
+	unsigned char *buf = make_input();
+	unsigned long expected = hash_reference(buf, INPUT_LEN);
+	vtparse_ingest_config_t config;
+	int fd = make_file(buf, INPUT_LEN);
+
+	/* Default configuration; uses io_uring if available */
+	check_run(fd, NULL, -1, expected);
+
+	/* Small, odd-sized buffers, such that spans are split everywhere */
+	memset(&config, 0, sizeof(config));
+	config.buf_size = 4093U;
+	config.n_bufs = 4U;
+	lseek(fd, 0, SEEK_SET);
+	check_run(fd, &config, -1, expected);
+
+	/* Force the read() fallback */
+	config.flags = VTPARSE_INGEST_NO_URING;
+	lseek(fd, 0, SEEK_SET);
+	check_run(fd, &config, 0, expected);
+
+	close(fd);
+	free(buf);
+}
+
+void test_ingest_pipe() {
+	unsigned char *buf = make_input();
+	const unsigned int len = 16384U; /* Fits into the pipe buffer */
+	unsigned long expected = hash_reference(buf, len);
+	vtparse_ingest_config_t config;
+	int fds[2];
+
+	memset(&config, 0, sizeof(config));
+	config.buf_size = 1000U;
+	config.n_bufs = 3U;
+
+	EXPECT_EQ(0, pipe(fds));
+	EXPECT_EQ(len, (unsigned int)write(fds[1], buf, len));
+	close(fds[1]);
+	check_run(fds[0], &config, -1, expected);
+	close(fds[0]);
+
+	config.flags = VTPARSE_INGEST_NO_URING;
+	EXPECT_EQ(0, pipe(fds));
+	EXPECT_EQ(len, (unsigned int)write(fds[1], buf, len));
+	close(fds[1]);
+	check_run(fds[0], &config, 0, expected);
+	close(fds[0]);
+
+	free(buf);
+}
+
+void test_ingest_hold_buffers() {
+	unsigned char *buf = make_input();
+	vtparse_ingest_config_t config;
+	vtparse_ingest_buf_t held[2], next;
+	unsigned int pos = 0, flags;
+	int fd = make_file(buf, INPUT_LEN), ok = 1;
+	vtparse_ingest_t *ingest;
+
+	for (flags = 0; flags <= VTPARSE_INGEST_NO_URING; flags++) {
+		memset(&config, 0, sizeof(config));
+		config.buf_size = 65536U;
+		config.n_bufs = 2U;
+		config.flags = flags;
+		lseek(fd, 0, SEEK_SET);
+		ingest = vtparse_ingest_open(fd, &config);
+
+		/* Hold on to both buffers; the third request must fail */
+		EXPECT_EQ(1, vtparse_ingest_next(ingest, &held[0]));
+		EXPECT_EQ(1, vtparse_ingest_next(ingest, &held[1]));
+		EXPECT_EQ(-1, vtparse_ingest_next(ingest, &next));
+		EXPECT_EQ(ENOBUFS, errno);
+
+		/* Buffers are delivered in file order */
+		pos = 0;
+		ok = memcmp(held[0].data, buf + pos, held[0].len) == 0;
+		pos += held[0].len;
+		ok = ok && memcmp(held[1].data, buf + pos, held[1].len) == 0;
+		pos += held[1].len;
+		vtparse_ingest_release(ingest, &held[0]);
+		vtparse_ingest_release(ingest, &held[1]);
+		while (vtparse_ingest_next(ingest, &next) > 0) {
+			ok = ok && pos + next.len <= INPUT_LEN &&
+			     memcmp(next.data, buf + pos, next.len) == 0;
+			pos += next.len;
+			vtparse_ingest_release(ingest, &next);
+		}
+		EXPECT_TRUE(ok);
+		EXPECT_EQ(INPUT_LEN, pos);
+		EXPECT_EQ(0, vtparse_ingest_next(ingest, &next));
+		vtparse_ingest_close(ingest);
+	}
+
+	close(fd);
+	free(buf);
+}
+
+void test_ingest_budget() {
+	unsigned char *buf = make_input();
+	unsigned long expected = hash_reference(buf, INPUT_LEN), hash;
+	vtparse_ingest_config_t config;
+	vtparse_ingest_t *ingest;
+	vtparse_t parser;
+	unsigned int flags;
+	int fd = make_file(buf, INPUT_LEN);
+
+	/* The budget is exhausted many times per buffer; no byte is lost */
+	for (flags = 0; flags <= VTPARSE_INGEST_NO_URING; flags++) {
+		memset(&config, 0, sizeof(config));
+		config.buf_size = 4093U;
+		config.n_bufs = 4U;
+		config.flags = flags;
+		lseek(fd, 0, SEEK_SET);
+		ingest = vtparse_ingest_open(fd, &config);
+		hash = 0;
+		vtparse_init(&parser);
+		vtparse_set_budget(&parser, 500U, 20U);
+		EXPECT_EQ(0, vtparse_ingest_run(ingest, &parser, hash_event, &hash));
+		EXPECT_EQ(expected, hash);
+		vtparse_ingest_close(ingest);
+	}
+
+	close(fd);
+	free(buf);
+}
+
+int main() {
+	RUN(test_ingest_file);
+	RUN(test_ingest_pipe);
+	RUN(test_ingest_hold_buffers);
+	RUN(test_ingest_budget);
+	DONE;
+}
@@ -0,0 +1,142 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_ingest_performance.c
+ *
+ * Measures the wall-clock time it takes to read and parse the given files,
+ * comparing a plain fread() loop with the ingestion module (read() fallback
+ * and io_uring backend).
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_ingest.h>
+
+static const int N_REPEAT = 20;
+
+static long long int microtime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return tp.tv_sec * 1000 * 1000 + tp.tv_nsec / 1000;
+}
+
+static int count_event(void *user_data, vtparse_t *parser) {
+	(*(long long int *)user_data)++;
+	(void)parser;
+	return 0;
+}
+
+static long long int parse_fread(const char *filename) {
+	static unsigned char buf[65536];
+	unsigned int buf_pos, did_read;
+	long long int n_events = 0;
+	vtparse_t parser;
+	FILE *f = fopen(filename, "rb");
+	if (!f) {
+		return -1;
+	}
+	vtparse_init(&parser);
+	do {
+		did_read = fread(buf, 1, sizeof(buf), f);
+		buf_pos = 0;
+		while (1) {
+			buf_pos += vtparse_parse(&parser, buf + buf_pos, did_read - buf_pos);
+			if (!vtparse_has_event(&parser)) {
+				break;
+			}
+			count_event(&n_events, &parser);
+		}
+	} while (did_read > 0);
+	fclose(f);
+	return n_events;
+}
+
+static long long int parse_ingest(const char *filename, unsigned int flags) {
+	long long int n_events = 0;
+	vtparse_ingest_config_t config;
+	vtparse_ingest_t *ingest;
+	vtparse_t parser;
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		return -1;
+	}
+	memset(&config, 0, sizeof(config));
+	config.flags = flags;
+	ingest = vtparse_ingest_open(fd, &config);
+	vtparse_init(&parser);
+	if (!ingest ||
+	    vtparse_ingest_run(ingest, &parser, count_event, &n_events) != 0) {
+		n_events = -1;
+	}
+	vtparse_ingest_close(ingest);
+	close(fd);
+	return n_events;
+}
+
+int main(int argc, char *argv[]) {
+	static const char *names[] = {"fread()", "ingest (read)",
+	                              "ingest (io_uring)"};
+	long long int t0, tsum[3], n_events[3];
+	int i, j, k;
+
+	if (argc <= 1) {
+		fprintf(stderr,
+		        "Usage ./test_vtparse_ingest_performance <INPUT FILE 1> ... "
+		        "<INPUT FILE N>\n");
+		return 1;
+	}
+
+	FX_PRINT_ARROW("Reading and parsing files\n");
+	for (i = 1; i < argc; i++) {
+		for (k = 0; k < 3; k++) {
+			tsum[k] = 0;
+			for (j = 0; j < N_REPEAT; j++) {
+				t0 = microtime();
+				n_events[k] = (k == 0) ? parse_fread(argv[i])
+				                       : parse_ingest(argv[i],
+				                                      k == 1 ? VTPARSE_INGEST_NO_URING
+				                                             : 0U);
+				tsum[k] += microtime() - t0;
+			}
+			if (n_events[k] < 0) {
+				FX_PRINT_ERR("Error while reading \"%s\"!\n", argv[i]);
+				return 1;
+			}
+			fprintf(stdout,
+			        "      "
+			        "%-18s \"%s\" (%lld events) took %dµs per iteration\n",
+			        names[k], argv[i], n_events[k],
+			        (int)(tsum[k] / (long long int)N_REPEAT));
+		}
+	}
+	FX_PRINT_OK("Done parsing files.\n");
+	return 0;
+}
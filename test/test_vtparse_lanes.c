@@ -0,0 +1,275 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_lanes.c
+ *
+ * Checks that vtparse_parse_streams() produces the same events as
+ * vtparse_parse() for randomly generated streams, for all instruction sets
+ * supported by the CPU.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_lanes.h>
+
+#define N_STREAMS 97U
+#define MAX_STREAM_LEN 3000U
+#define MAX_EVENTS (MAX_STREAM_LEN + VTPARSE_LANES_MIN_EVENTS)
+
+typedef struct {
+	unsigned char buf[MAX_STREAM_LEN];
+	unsigned int len;
+	vtparse_event_t ref[MAX_EVENTS];
+	unsigned int n_ref;
+	vtparse_event_t events[MAX_EVENTS];
+	unsigned int n_events;
+	vtparse_stream_t stream;
+} test_stream_t;
+
+static unsigned int rnd(unsigned int *seed) {
+	*seed = *seed * 1103515245U + 12345U;
+	return (*seed >> 16U) & 0x7FFFU;
+}
+
+/* Random input biased towards characters that are relevant for the state
+   machine */
+static void make_stream(test_stream_t *s, unsigned int *seed) {
+	static const char alphabet[] =
+	    "\033\033\033\033[[[[;;;;0123456789?>$ mHAJ]P\\\007\030\032\n\r\t"
+	    "abcdefgXYZ \177";
+	unsigned int i, r;
+	s->len = rnd(seed) % MAX_STREAM_LEN;
+	for (i = 0; i < s->len; i++) {
+		r = rnd(seed);
+		if (r % 16U == 0U) {
+			s->buf[i] = (unsigned char)(rnd(seed) & 0xFFU);
+		} else {
+			s->buf[i] = (unsigned char)alphabet[r % (sizeof(alphabet) - 1U)];
+		}
+	}
+}
+
+/* Appends an event, merging adjacent data spans */
+static void append(vtparse_event_t *events, unsigned int *n,
+                   const vtparse_event_t *event) {
+	vtparse_event_t *last = *n ? &events[*n - 1U] : NULL;
+	if (event->data && last && last->data &&
+	    last->data + last->data_len == event->data) {
+		last->data_len += event->data_len;
+		last->action = event->action;
+		return;
+	}
+	events[(*n)++] = *event;
+}
+
+static void make_reference(test_stream_t *s, int merge) {
+	unsigned int pos = 0, i;
+	vtparse_event_t event;
+	vtparse_t parser;
+
+	s->n_ref = 0;
+	vtparse_init(&parser);
+	while (1) {
+		pos += vtparse_parse(&parser, s->buf + pos, s->len - pos);
+		if (!vtparse_has_event(&parser)) {
+			break;
+		}
+		memset(&event, 0, sizeof(event));
+		event.action = (unsigned char)parser.action;
+		if (parser.data_begin != parser.data_end) {
+			event.data = parser.data_begin;
+			event.data_len = (unsigned int)(parser.data_end - parser.data_begin);
+		} else {
+			event.ch = (unsigned char)parser.ch;
+			event.num_params = (unsigned char)parser.num_params;
+			for (i = 0; i < (unsigned int)parser.num_params; i++) {
+				event.params[i] = (unsigned short)(
+				    parser.params[i] > 65535 ? 65535 : parser.params[i]);
+			}
+			event.num_intermediate_chars =
+			    (unsigned char)parser.num_intermediate_chars;
+			for (i = 0; i < (unsigned int)parser.num_intermediate_chars; i++) {
+				event.intermediate_chars[i] = parser.intermediate_chars[i];
+			}
+		}
+		if (merge) {
+			append(s->ref, &s->n_ref, &event);
+		} else {
+			s->ref[s->n_ref++] = event;
+		}
+	}
+}
+
+static int events_equal(const vtparse_event_t *a, const vtparse_event_t *b) {
+	unsigned int i;
+	if (a->action != b->action || a->data != b->data ||
+	    a->data_len != b->data_len) {
+		return 0;
+	}
+	if (a->data) {
+		return 1;
+	}
+	if (a->ch != b->ch || a->num_params != b->num_params ||
+	    a->num_intermediate_chars != b->num_intermediate_chars) {
+		return 0;
+	}
+	for (i = 0; i < a->num_params; i++) {
+		if (a->params[i] != b->params[i]) {
+			return 0;
+		}
+	}
+	for (i = 0; i < a->num_intermediate_chars; i++) {
+		if (a->intermediate_chars[i] != b->intermediate_chars[i]) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static int check_stream(test_stream_t *s, const vtparse_event_t *events,
+                        unsigned int n_events) {
+	unsigned int i;
+	if (n_events != s->n_ref) {
+		return 0;
+	}
+	for (i = 0; i < n_events; i++) {
+		if (!events_equal(&s->ref[i], &events[i])) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static void run_isa(int isa, unsigned int max_events) {
+	test_stream_t *streams = calloc(N_STREAMS, sizeof(test_stream_t));
+	vtparse_stream_t *ptrs[N_STREAMS];
+	vtparse_event_t *queues = calloc(N_STREAMS, sizeof(vtparse_event_t) * 5U);
+	unsigned int i, j, seed = 4711U, n_ok = 0, pending;
+	test_stream_t *s;
+
+	for (i = 0; i < N_STREAMS; i++) {
+		s = &streams[i];
+		make_stream(s, &seed);
+		make_reference(s, max_events < MAX_EVENTS);
+		vtparse_stream_init(&s->stream,
+		                    max_events < MAX_EVENTS ? queues + i * 5U : s->events,
+		                    max_events);
+		s->stream.buf = s->buf;
+		s->stream.buf_len = s->len;
+		ptrs[i] = &s->stream;
+	}
+
+	/* Parse until all streams are done, draining the queues after each
+	   call */
+	do {
+		vtparse_parse_streams(ptrs, N_STREAMS);
+		pending = 0;
+		for (i = 0; i < N_STREAMS; i++) {
+			s = &streams[i];
+			if (max_events < MAX_EVENTS) {
+				for (j = 0; j < s->stream.num_events; j++) {
+					append(s->events, &s->n_events, &s->stream.events[j]);
+				}
+				s->stream.num_events = 0;
+			} else {
+				s->n_events = s->stream.num_events;
+			}
+			pending += s->stream.buf_pos < s->stream.buf_len;
+		}
+	} while (pending > 0U);
+
+	for (i = 0; i < N_STREAMS; i++) {
+		n_ok += check_stream(&streams[i], streams[i].events,
+		                     streams[i].n_events);
+	}
+	EXPECT_EQ(N_STREAMS, n_ok);
+
+	free(queues);
+	free(streams);
+}
+
+void test_lanes() {
+	int isa;
+	for (isa = VTPARSE_LANES_ISA_SCALAR; isa <= VTPARSE_LANES_ISA_AVX512;
+	     isa++) {
+		if (vtparse_lanes_set_isa(isa) == isa) {
+			run_isa(isa, MAX_EVENTS);
+		}
+	}
+	vtparse_lanes_set_isa(VTPARSE_LANES_ISA_AUTO);
+}
+
+void test_lanes_small_queues() {
+	int isa;
+	for (isa = VTPARSE_LANES_ISA_SCALAR; isa <= VTPARSE_LANES_ISA_AVX512;
+	     isa++) {
+		if (vtparse_lanes_set_isa(isa) == isa) {
+			run_isa(isa, VTPARSE_LANES_MIN_EVENTS);
+		}
+	}
+	vtparse_lanes_set_isa(VTPARSE_LANES_ISA_AUTO);
+}
+
+void test_lanes_resume() {
+	const unsigned char buf[] = "ab\033[1;2";
+	const unsigned char buf2[] = "3mcd";
+	vtparse_event_t events[8];
+	vtparse_stream_t stream;
+	vtparse_stream_t *ptr = &stream;
+
+	/* The parser state is carried over to the next buffer */
+	vtparse_stream_init(&stream, events, 8U);
+	stream.buf = buf;
+	stream.buf_len = sizeof(buf) - 1U;
+	vtparse_parse_streams(&ptr, 1U);
+	EXPECT_EQ(stream.buf_len, stream.buf_pos);
+	EXPECT_EQ(1U, stream.num_events);
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, events[0].action);
+	EXPECT_EQ(buf, events[0].data);
+	EXPECT_EQ(2U, events[0].data_len);
+
+	stream.num_events = 0;
+	stream.buf = buf2;
+	stream.buf_len = sizeof(buf2) - 1U;
+	stream.buf_pos = 0;
+	vtparse_parse_streams(&ptr, 1U);
+	EXPECT_EQ(2U, stream.num_events);
+	EXPECT_EQ(VTPARSE_ACTION_CSI_DISPATCH, events[0].action);
+	EXPECT_EQ('m', events[0].ch);
+	EXPECT_EQ(2U, events[0].num_params);
+	EXPECT_EQ(1U, events[0].params[0]);
+	EXPECT_EQ(23U, events[0].params[1]);
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, events[1].action);
+	EXPECT_EQ(buf2 + 2, events[1].data);
+	EXPECT_EQ(2U, events[1].data_len);
+}
+
+int main() {
+	RUN(test_lanes);
+	RUN(test_lanes_small_queues);
+	RUN(test_lanes_resume);
+	DONE;
+}
@@ -0,0 +1,251 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_lanes_performance.c
+ *
+ * Splits the given files into many short streams (between 256 bytes and
+ * 2 KiB each) and converts them into per-stream event queues, once by calling
+ * vtparse_parse() for each stream in turn, and once with
+ * vtparse_parse_streams() for each available instruction set.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_lanes.h>
+
+#define N_REPEAT 20
+#define MIN_STREAM_LEN 256U
+#define MAX_STREAM_LEN 2048U
+
+static long long int nanotime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return tp.tv_sec * 1000LL * 1000LL * 1000LL + tp.tv_nsec;
+}
+
+static unsigned char *read_file(const char *filename, unsigned int *len) {
+	unsigned char *buf = NULL, *new_buf;
+	size_t n;
+	FILE *f = fopen(filename, "rb");
+	*len = 0;
+	if (!f) {
+		return NULL;
+	}
+	do {
+		if (!(new_buf = realloc(buf, *len + 65536U))) {
+			break;
+		}
+		buf = new_buf;
+		n = fread(buf + *len, 1, 65536U, f);
+		*len += (unsigned int)n;
+	} while (n > 0);
+	fclose(f);
+	return buf;
+}
+
+/* Splits the input into streams, each with an event queue large enough to
+   hold all events of the stream */
+static vtparse_stream_t *make_streams(unsigned char const *input,
+                                      unsigned int input_len,
+                                      vtparse_event_t *events,
+                                      unsigned int *n_streams) {
+	vtparse_stream_t *streams;
+	unsigned int pos = 0, len, seed = 4711U, n = 0;
+
+	streams = malloc(sizeof(vtparse_stream_t) *
+	                 (input_len / MIN_STREAM_LEN + 1U));
+	while (pos < input_len) {
+		seed = seed * 1103515245U + 12345U;
+		len = MIN_STREAM_LEN +
+		      ((seed >> 16U) % (MAX_STREAM_LEN - MIN_STREAM_LEN + 1U));
+		if (len > input_len - pos) {
+			len = input_len - pos;
+		}
+		vtparse_stream_init(&streams[n], events,
+		                    len + VTPARSE_LANES_MIN_EVENTS);
+		streams[n].buf = input + pos;
+		streams[n].buf_len = len;
+		events += len + VTPARSE_LANES_MIN_EVENTS;
+		pos += len;
+		n++;
+	}
+	*n_streams = n;
+	return streams;
+}
+
+static void reset_streams(vtparse_stream_t *streams, unsigned int n_streams) {
+	unsigned char const *buf;
+	unsigned int i, buf_len;
+	for (i = 0; i < n_streams; i++) {
+		buf = streams[i].buf;
+		buf_len = streams[i].buf_len;
+		vtparse_stream_init(&streams[i], streams[i].events,
+		                    streams[i].max_events);
+		streams[i].buf = buf;
+		streams[i].buf_len = buf_len;
+	}
+}
+
+/* Reference: parse each stream with vtparse_parse() and copy the events into
+   the queue */
+static void run_sequential(vtparse_stream_t *streams, unsigned int n_streams) {
+	vtparse_t parser;
+	vtparse_stream_t *stream;
+	vtparse_event_t *event;
+	unsigned int i, j, n;
+
+	for (i = 0; i < n_streams; i++) {
+		stream = &streams[i];
+		vtparse_init(&parser);
+		while (1) {
+			stream->buf_pos +=
+			    vtparse_parse(&parser, stream->buf + stream->buf_pos,
+			                  stream->buf_len - stream->buf_pos);
+			if (!vtparse_has_event(&parser)) {
+				break;
+			}
+			event = &stream->events[stream->num_events++];
+			event->action = (unsigned char)parser.action;
+			event->ch = (unsigned char)parser.ch;
+			event->data = parser.data_begin;
+			event->data_len =
+			    (unsigned int)(parser.data_end - parser.data_begin);
+			n = 0U;
+			if (!event->data_len) {
+				n = (unsigned int)parser.num_params;
+				for (j = 0; j < n; j++) {
+					event->params[j] = (unsigned short)parser.params[j];
+				}
+			}
+			event->num_params = (unsigned char)n;
+		}
+	}
+}
+
+static unsigned long checksum(const vtparse_stream_t *streams,
+                              unsigned int n_streams) {
+	const vtparse_event_t *event;
+	unsigned long res = 0;
+	unsigned int i, j, k;
+
+	for (i = 0; i < n_streams; i++) {
+		for (j = 0; j < streams[i].num_events; j++) {
+			event = &streams[i].events[j];
+			res = res * 31UL + event->action;
+			for (k = 0; k < event->data_len; k++) {
+				res = res * 31UL + event->data[k];
+			}
+			if (!event->data_len) {
+				res = res * 31UL + event->ch;
+				for (k = 0; k < event->num_params; k++) {
+					res = res * 31UL + event->params[k];
+				}
+			}
+		}
+	}
+	return res;
+}
+
+int main(int argc, char *argv[]) {
+	static const char *names[] = {"sequential", "lanes (scalar)",
+	                              "lanes (AVX2)", "lanes (AVX-512)"};
+	static const int isas[] = {0, VTPARSE_LANES_ISA_SCALAR,
+	                           VTPARSE_LANES_ISA_AVX2, VTPARSE_LANES_ISA_AVX512};
+	unsigned char *input;
+	unsigned int input_len, n_streams;
+	vtparse_event_t *events;
+	vtparse_stream_t *streams, **ptrs;
+	unsigned long checksums[4];
+	long long int t0, tsum;
+	unsigned int i;
+	int j, k;
+
+	if (argc <= 1) {
+		fprintf(stderr,
+		        "Usage ./test_vtparse_lanes_performance <INPUT FILE 1> ... "
+		        "<INPUT FILE N>\n");
+		return 1;
+	}
+
+	FX_PRINT_ARROW("Parsing files\n");
+	for (j = 1; j < argc; j++) {
+		input = read_file(argv[j], &input_len);
+		if (!input || input_len == 0U) {
+			FX_PRINT_ERR("Error while reading \"%s\"!\n", argv[j]);
+			return 1;
+		}
+		events = malloc(sizeof(vtparse_event_t) *
+		                (input_len + (input_len / MIN_STREAM_LEN + 1U) *
+		                                 VTPARSE_LANES_MIN_EVENTS));
+		streams = make_streams(input, input_len, events, &n_streams);
+		ptrs = malloc(sizeof(vtparse_stream_t *) * n_streams);
+		for (i = 0; i < n_streams; i++) {
+			ptrs[i] = &streams[i];
+		}
+
+		for (k = 0; k < 4; k++) {
+			if (k > 0 && vtparse_lanes_set_isa(isas[k]) != isas[k]) {
+				checksums[k] = checksums[0];
+				continue;
+			}
+			tsum = 0;
+			for (i = 0; i < N_REPEAT; i++) {
+				reset_streams(streams, n_streams);
+				t0 = nanotime();
+				if (k == 0) {
+					run_sequential(streams, n_streams);
+				} else {
+					vtparse_parse_streams(ptrs, n_streams);
+				}
+				tsum += nanotime() - t0;
+			}
+			checksums[k] = checksum(streams, n_streams);
+			fprintf(stdout,
+			        "      %-16s \"%s\" (%u streams): %.1f MiB/s (%.2f ns/byte)\n",
+			        names[k], argv[j], n_streams,
+			        (double)input_len * N_REPEAT / (1024.0 * 1024.0) /
+			            ((double)tsum * 1e-9),
+			        (double)tsum / ((double)input_len * N_REPEAT));
+		}
+		vtparse_lanes_set_isa(VTPARSE_LANES_ISA_AUTO);
+		for (k = 1; k < 4; k++) {
+			if (checksums[k] != checksums[0]) {
+				FX_PRINT_ERR("Checksum mismatch!\n");
+				return 1;
+			}
+		}
+
+		free(ptrs);
+		free(streams);
+		free(events);
+		free(input);
+	}
+	FX_PRINT_OK("Done parsing files.\n");
+	return 0;
+}
@@ -23,31 +23,115 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <foxen/unittest.h>
-#include <vtparse/vtparse.c>
+
+/* The benchmark is compiled twice: once against the vtparse library and once
+   against the amalgamated single-include version of the parser. */
+#ifdef VTPARSE_BENCHMARK_AMALGAMATED
+#include <vtparse/vtparse_amalgamated.h>
+#else
+#include <vtparse/vtparse.h>
+#endif
 
 static const int N_REPEAT = 1000;
 
+/* Names of the VTPARSE_ISA_* constants, as accepted by VTPARSE_FORCE_ISA */
+static const char *isa_names[] = {"auto", "scalar", "sse2", "avx2", "avx512"};
+
 static long long int microtime() {
 	struct timespec tp;
 	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &tp);
 	return tp.tv_sec * 1000 * 1000 + tp.tv_nsec / 1000;
 }
 
+/* Number of repetitions per pattern in the tiny-buffer benchmark */
+static const long long int N_REPEAT_TINY = 10000000LL;
+
+/**
+ * Measures the latency of parsing tiny buffers, as they occur when echoing
+ * keystrokes in interactive sessions. Each iteration passes the entire buffer
+ * to the parser and processes all resulting events.
+ */
+static int run_tiny() {
+	static const struct {
+		const char *name;
+		const char *data;
+	} patterns[] = {
+	    {"keystroke", "a"},
+	    {"backspace", "\b \b"},
+	    {"newline", "\r\n"},
+	    {"cursor left", "\033[D"},
+	    {"word", "hello world\r\n"},
+	    {"coloured char", "\033[1;31mx\033[0m"},
+	};
+	volatile unsigned int sink = 0;
+	long long int t0, t1, j, n_calls;
+	unsigned int i, len, pos;
+	const unsigned char *buf;
+	vtparse_t parser;
+
+	FX_PRINT_ARROW("Parsing tiny buffers\n");
+	for (i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+		buf = (const unsigned char *)patterns[i].data;
+		for (len = 0; buf[len]; len++) {
+		}
+		vtparse_init(&parser);
+		n_calls = 0;
+		t0 = microtime();
+		for (j = 0; j < N_REPEAT_TINY; j++) {
+			pos = 0;
+			while (1) {
+				pos += vtparse_parse(&parser, buf + pos, len - pos);
+				n_calls++;
+				if (!vtparse_has_event(&parser)) {
+					break;
+				}
+				sink += parser.action;
+			}
+		}
+		t1 = microtime();
+		fprintf(stdout,
+		        "      %-14s (%2u bytes): %5.1fns per buffer, %5.1fns per "
+		        "vtparse_parse() call\n",
+		        patterns[i].name, len,
+		        (double)(t1 - t0) * 1000.0 / (double)N_REPEAT_TINY,
+		        (double)(t1 - t0) * 1000.0 / (double)n_calls);
+	}
+	(void)sink;
+	FX_PRINT_OK("Done parsing tiny buffers.\n");
+	return 0;
+}
+
 int main(int argc, char *argv[]) {
 	int i, j;
+	unsigned int options = 0;
 	unsigned char **file_buffers;
 	unsigned int *file_buffer_sizes;
+	long long int total_time = 0, total_bytes = 0;
 	FILE *f;
 
 	/* Check the arguments */
 	if (argc <= 1) {
 		fprintf(stderr,
 		        "Usage ./test_vtparse_performance <INPUT FILE 1> ... <INPUT "
-		        "FILE N>\n");
+		        "FILE N>\n"
+		        "      ./test_vtparse_performance --sequences <INPUT FILE 1> "
+		        "... <INPUT FILE N>\n"
+		        "      ./test_vtparse_performance --tiny\n");
 		return 1;
 	}
+	if (strcmp(argv[1], "--tiny") == 0) {
+		return run_tiny();
+	}
+
+	/* Optionally match frequent control sequences as a whole */
+	if (strcmp(argv[1], "--sequences") == 0) {
+		options = VTPARSE_OPTION_SEQUENCES;
+		argc--;
+		argv++;
+	}
 
 	/* Read the specified files to memory */
 	file_buffers = calloc(sizeof(char *), argc - 1);
@@ -82,6 +166,9 @@ int main(int argc, char *argv[]) {
 	FX_PRINT_OK("Reading input files to memory\n");
 
 	FX_PRINT_ARROW("Parsing files\n");
+	fprintf(stdout, "      Instruction set: %s%s\n",
+	        isa_names[vtparse_get_isa()],
+	        options ? ", recognizing frequent sequences" : "");
 	for (i = 0; i < argc - 1; i++) {
 		/* Pass the file n_repeat times through vtparse */
 		long long int t0, t1, tsum = 0, nsmul = 1000;
@@ -99,6 +186,7 @@ int main(int argc, char *argv[]) {
 			volatile vtparse_t parser_volatile;
 			vtparse_t parser;
 			vtparse_init(&parser);
+			vtparse_set_options(&parser, options);
 
 			while (1) {
 				buf_pos +=
@@ -121,6 +209,17 @@ int main(int argc, char *argv[]) {
 		        "per byte)\n",
 		        argv[i + 1], buf_pos, (int)(tsum / (long long int)N_REPEAT),
 		        (int)((tsum * nsmul) / (long long int)(N_REPEAT * buf_pos)));
+		total_time += tsum;
+		total_bytes += buf_pos;
+	}
+	if (total_bytes > 0) {
+		fprintf(stdout,
+		        "      "
+		        "Parsing all files took %lldµs per iteration (%lldps per "
+		        "byte)\n",
+		        total_time / (long long int)N_REPEAT,
+		        (total_time * 1000LL * 1000LL) /
+		            ((long long int)N_REPEAT * total_bytes));
 	}
 	FX_PRINT_OK("Done parsing files.\n");
 
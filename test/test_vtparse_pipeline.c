@@ -0,0 +1,222 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_pipeline.c
+ *
+ * Unit tests for the pipeline module. Runs reader, parser and consumer on
+ * separate threads and checks that the consumer sees the same events as a
+ * single-threaded parser. The reader overwrites each buffer as soon as it is
+ * reclaimed; spans referencing a recycled buffer would thus corrupt the
+ * result.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_pipeline.h>
+
+#define INPUT_LEN 300000U
+#define N_BUFS 4U
+#define BUF_SIZE 997U
+
+typedef struct {
+	vtparse_pipeline_t *pipeline;
+	unsigned char const *input;
+	unsigned char bufs[N_BUFS][BUF_SIZE];
+	vtparse_t parser;
+	unsigned long hash;
+	unsigned int n_reclaimed;
+} pipeline_test_t;
+
+static unsigned char *make_input(void) {
+	static const char *chunks[] = {"Hello World ", "\033[1;31m", "\r\n",
+	                               "\033[38;2;10;20;30m", "\033]0;title\007",
+	                               "\033P1$rdata\033\\", "\033[?25h", "x"};
+	unsigned char *buf = malloc(INPUT_LEN);
+	unsigned int pos = 0, i = 0, n;
+	while (pos < INPUT_LEN) {
+		n = (unsigned int)strlen(chunks[i % 8U]);
+		if (pos + n > INPUT_LEN) {
+			n = INPUT_LEN - pos;
+		}
+		memcpy(buf + pos, chunks[i % 8U], n);
+		pos += n;
+		i = i * 5U + 3U;
+	}
+	return buf;
+}
+
+/* Hash over all events that does not depend on where data spans are split */
+static unsigned long hash_event(unsigned long hash, unsigned int action,
+                                unsigned int ch, unsigned char const *data,
+                                unsigned int data_len, unsigned int num_params,
+                                const int *params) {
+	unsigned int i;
+	if (data_len > 0U) {
+		for (i = 0; i < data_len; i++) {
+			hash = hash * 31UL + data[i] + action;
+		}
+	} else {
+		hash = hash * 31UL + action * 1000UL + ch;
+		for (i = 0; i < num_params; i++) {
+			hash = hash * 31UL + (unsigned long)params[i];
+		}
+	}
+	return hash;
+}
+
+static unsigned long hash_reference(const unsigned char *buf, unsigned int len) {
+	unsigned long hash = 0;
+	unsigned int pos = 0;
+	vtparse_t parser;
+	vtparse_init(&parser);
+	while (1) {
+		pos += vtparse_parse(&parser, buf + pos, len - pos);
+		if (!vtparse_has_event(&parser)) {
+			break;
+		}
+		hash = hash_event(hash, parser.action, parser.ch, parser.data_begin,
+		                  (unsigned int)(parser.data_end - parser.data_begin),
+		                  (unsigned int)parser.num_params, parser.params);
+	}
+	return hash;
+}
+
+static void *reader_main(void *arg) {
+	pipeline_test_t *test = arg;
+	unsigned int pos = 0, len, n_free = N_BUFS, idx;
+	unsigned char *free_bufs[N_BUFS];
+	void *cookie;
+
+	for (idx = 0; idx < N_BUFS; idx++) {
+		free_bufs[idx] = test->bufs[idx];
+	}
+	while (pos < INPUT_LEN) {
+		/* Wait for a free buffer; poison reclaimed buffers */
+		while (vtparse_pipeline_reclaim(test->pipeline, &cookie)) {
+			memset(cookie, 0xAA, BUF_SIZE);
+			free_bufs[n_free++] = cookie;
+			test->n_reclaimed++;
+		}
+		if (n_free == 0U) {
+			sched_yield();
+			continue;
+		}
+		len = INPUT_LEN - pos < BUF_SIZE ? INPUT_LEN - pos : BUF_SIZE;
+		memcpy(free_bufs[--n_free], test->input + pos, len);
+		vtparse_pipeline_push(test->pipeline, free_bufs[n_free], len,
+		                      free_bufs[n_free]);
+		pos += len;
+	}
+	vtparse_pipeline_close(test->pipeline);
+	return NULL;
+}
+
+static void *parser_main(void *arg) {
+	pipeline_test_t *test = arg;
+	vtparse_pipeline_run_parser(test->pipeline, &test->parser);
+	return NULL;
+}
+
+static void *consumer_main(void *arg) {
+	pipeline_test_t *test = arg;
+	vtparse_event_t event;
+	int params[VTPARSE_MAX_PARAMS];
+	unsigned int i;
+	while (vtparse_pipeline_pop(test->pipeline, &event)) {
+		for (i = 0; i < event.num_params; i++) {
+			params[i] = event.params[i];
+		}
+		test->hash = hash_event(test->hash, event.action, event.ch, event.data,
+		                        event.data_len, event.num_params, params);
+	}
+	return NULL;
+}
+
+static void run_pipeline(pipeline_test_t *test,
+                         const vtparse_pipeline_config_t *config) {
+	pthread_t reader, parser, consumer;
+	void *cookie;
+
+	test->pipeline = vtparse_pipeline_create(config);
+	test->hash = 0;
+	test->n_reclaimed = 0;
+	vtparse_init(&test->parser);
+	pthread_create(&consumer, NULL, consumer_main, test);
+	pthread_create(&parser, NULL, parser_main, test);
+	pthread_create(&reader, NULL, reader_main, test);
+	pthread_join(reader, NULL);
+	pthread_join(parser, NULL);
+	pthread_join(consumer, NULL);
+
+	/* All buffers are handed back once the consumer is done */
+	while (vtparse_pipeline_reclaim(test->pipeline, &cookie)) {
+		test->n_reclaimed++;
+	}
+	vtparse_pipeline_destroy(test->pipeline);
+}
+
+void test_pipeline() {
+	pipeline_test_t *test = calloc(1, sizeof(pipeline_test_t));
+	unsigned char *input = make_input();
+	unsigned long expected = hash_reference(input, INPUT_LEN);
+	vtparse_pipeline_config_t config;
+
+	test->input = input;
+	run_pipeline(test, NULL);
+	EXPECT_EQ(expected, test->hash);
+	EXPECT_EQ((INPUT_LEN + BUF_SIZE - 1U) / BUF_SIZE, test->n_reclaimed);
+
+	/* A tiny event ring forces the parser to wait for the consumer */
+	memset(&config, 0, sizeof(config));
+	config.max_bufs = N_BUFS;
+	config.event_capacity = 2U;
+	run_pipeline(test, &config);
+	EXPECT_EQ(expected, test->hash);
+	EXPECT_EQ((INPUT_LEN + BUF_SIZE - 1U) / BUF_SIZE, test->n_reclaimed);
+
+	free(input);
+	free(test);
+}
+
+void test_pipeline_empty() {
+	vtparse_pipeline_t *pipeline = vtparse_pipeline_create(NULL);
+	vtparse_event_t event;
+	vtparse_t parser;
+	vtparse_init(&parser);
+	vtparse_pipeline_close(pipeline);
+	vtparse_pipeline_run_parser(pipeline, &parser);
+	EXPECT_EQ(0, vtparse_pipeline_pop(pipeline, &event));
+	EXPECT_EQ(0, vtparse_pipeline_pop(pipeline, &event));
+	vtparse_pipeline_destroy(pipeline);
+}
+
+int main() {
+	RUN(test_pipeline);
+	RUN(test_pipeline_empty);
+	DONE;
+}
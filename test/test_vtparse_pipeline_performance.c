@@ -0,0 +1,279 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_pipeline_performance.c
+ *
+ * Compares reading, parsing and consuming the given files on a single thread
+ * with the three-thread pipeline. "Reading" copies 4 KiB slices of the file
+ * into a pool of buffers. The consumer computes a checksum over all events.
+ * Reports the wall-clock throughput and the latency between a buffer being
+ * read and all of its events being consumed.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_pipeline.h>
+
+#define N_REPEAT 20
+#define N_BUFS 64U
+#define BUF_SIZE 4096U
+
+typedef struct {
+	unsigned char data[BUF_SIZE];
+	long long int t_read;
+} buf_t;
+
+typedef struct {
+	vtparse_pipeline_t *pipeline;
+	unsigned char const *input;
+	unsigned int input_len;
+	buf_t *bufs;
+	vtparse_t parser;
+	unsigned long checksum;
+	long long int latency_sum, latency_max, n_latency;
+} bench_t;
+
+static long long int nanotime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return tp.tv_sec * 1000LL * 1000LL * 1000LL + tp.tv_nsec;
+}
+
+static unsigned long consume(unsigned long checksum, unsigned int action,
+                             unsigned int ch, unsigned char const *data,
+                             unsigned int data_len, unsigned int num_params,
+                             const unsigned short *params) {
+	unsigned int i;
+	for (i = 0; i < data_len; i++) {
+		checksum = checksum * 31UL + data[i];
+	}
+	checksum = checksum * 31UL + action + ch;
+	for (i = 0; i < num_params; i++) {
+		checksum = checksum * 31UL + params[i];
+	}
+	return checksum;
+}
+
+static void record_latency(bench_t *bench, long long int t_read) {
+	long long int dt = nanotime() - t_read;
+	bench->latency_sum += dt;
+	bench->n_latency++;
+	if (dt > bench->latency_max) {
+		bench->latency_max = dt;
+	}
+}
+
+static unsigned int read_slice(bench_t *bench, unsigned int pos, buf_t *buf) {
+	unsigned int len = bench->input_len - pos;
+	if (len > BUF_SIZE) {
+		len = BUF_SIZE;
+	}
+	memcpy(buf->data, bench->input + pos, len);
+	buf->t_read = nanotime();
+	return len;
+}
+
+static void run_single(bench_t *bench) {
+	unsigned short params[VTPARSE_MAX_PARAMS];
+	unsigned int pos = 0, len, buf_pos, i, idx = 0;
+	buf_t *buf;
+	vtparse_t *parser = &bench->parser;
+
+	vtparse_init(parser);
+	while (pos < bench->input_len) {
+		buf = &bench->bufs[idx++ % N_BUFS];
+		len = read_slice(bench, pos, buf);
+		pos += len;
+		buf_pos = 0;
+		while (1) {
+			buf_pos += vtparse_parse(parser, buf->data + buf_pos, len - buf_pos);
+			if (!vtparse_has_event(parser)) {
+				break;
+			}
+			for (i = 0; i < (unsigned int)parser->num_params &&
+			            i < VTPARSE_MAX_PARAMS;
+			     i++) {
+				params[i] = (unsigned short)parser->params[i];
+			}
+			bench->checksum = consume(
+			    bench->checksum, parser->action, parser->ch, parser->data_begin,
+			    (unsigned int)(parser->data_end - parser->data_begin),
+			    parser->data_begin != parser->data_end ? 0U : i, params);
+		}
+		record_latency(bench, buf->t_read);
+	}
+}
+
+static void *reader_main(void *arg) {
+	bench_t *bench = arg;
+	buf_t *free_bufs[N_BUFS];
+	unsigned int pos = 0, len, n_free, i;
+	void *cookie;
+
+	for (i = 0; i < N_BUFS; i++) {
+		free_bufs[i] = &bench->bufs[i];
+	}
+	n_free = N_BUFS;
+	while (1) {
+		while (vtparse_pipeline_reclaim(bench->pipeline, &cookie)) {
+			record_latency(bench, ((buf_t *)cookie)->t_read);
+			free_bufs[n_free++] = cookie;
+		}
+		if (pos == bench->input_len) {
+			if (n_free == N_BUFS) {
+				break;
+			}
+		} else if (n_free > 0U) {
+			len = read_slice(bench, pos, free_bufs[--n_free]);
+			vtparse_pipeline_push(bench->pipeline, free_bufs[n_free]->data, len,
+			                      free_bufs[n_free]);
+			pos += len;
+			if (pos == bench->input_len) {
+				vtparse_pipeline_close(bench->pipeline);
+			}
+			continue;
+		}
+		sched_yield();
+	}
+	return NULL;
+}
+
+static void *parser_main(void *arg) {
+	bench_t *bench = arg;
+	vtparse_init(&bench->parser);
+	vtparse_pipeline_run_parser(bench->pipeline, &bench->parser);
+	return NULL;
+}
+
+static void *consumer_main(void *arg) {
+	bench_t *bench = arg;
+	vtparse_event_t ev;
+	while (vtparse_pipeline_pop(bench->pipeline, &ev)) {
+		bench->checksum =
+		    consume(bench->checksum, ev.action, ev.ch, ev.data, ev.data_len,
+		            ev.num_params, ev.params);
+	}
+	return NULL;
+}
+
+static void run_pipelined(bench_t *bench) {
+	pthread_t reader, parser, consumer;
+	vtparse_pipeline_config_t config;
+
+	memset(&config, 0, sizeof(config));
+	config.max_bufs = N_BUFS;
+	bench->pipeline = vtparse_pipeline_create(&config);
+	pthread_create(&consumer, NULL, consumer_main, bench);
+	pthread_create(&parser, NULL, parser_main, bench);
+	pthread_create(&reader, NULL, reader_main, bench);
+	pthread_join(reader, NULL);
+	pthread_join(parser, NULL);
+	pthread_join(consumer, NULL);
+	vtparse_pipeline_destroy(bench->pipeline);
+}
+
+static unsigned char *read_file(const char *filename, unsigned int *len) {
+	unsigned char *buf = NULL, *new_buf;
+	size_t n;
+	FILE *f = fopen(filename, "rb");
+	*len = 0;
+	if (!f) {
+		return NULL;
+	}
+	do {
+		if (!(new_buf = realloc(buf, *len + 65536U))) {
+			break;
+		}
+		buf = new_buf;
+		n = fread(buf + *len, 1, 65536U, f);
+		*len += (unsigned int)n;
+	} while (n > 0);
+	fclose(f);
+	return buf;
+}
+
+int main(int argc, char *argv[]) {
+	static const char *names[] = {"single thread", "pipelined"};
+	bench_t bench;
+	unsigned long checksum[2];
+	long long int t0, tsum;
+	int i, j, k;
+
+	if (argc <= 1) {
+		fprintf(stderr,
+		        "Usage ./test_vtparse_pipeline_performance <INPUT FILE 1> ... "
+		        "<INPUT FILE N>\n");
+		return 1;
+	}
+
+	memset(&bench, 0, sizeof(bench));
+	bench.bufs = malloc(N_BUFS * sizeof(buf_t));
+	FX_PRINT_ARROW("Parsing files\n");
+	for (i = 1; i < argc; i++) {
+		bench.input = read_file(argv[i], &bench.input_len);
+		if (!bench.input || bench.input_len == 0U) {
+			FX_PRINT_ERR("Error while reading \"%s\"!\n", argv[i]);
+			return 1;
+		}
+		for (k = 0; k < 2; k++) {
+			tsum = 0;
+			bench.latency_sum = bench.latency_max = bench.n_latency = 0;
+			for (j = 0; j < N_REPEAT; j++) {
+				bench.checksum = 0;
+				t0 = nanotime();
+				if (k == 0) {
+					run_single(&bench);
+				} else {
+					run_pipelined(&bench);
+				}
+				tsum += nanotime() - t0;
+			}
+			checksum[k] = bench.checksum;
+			fprintf(stdout,
+			        "      "
+			        "%-14s \"%s\": %.1f MiB/s, buffer latency mean %lldns, max "
+			        "%lldns\n",
+			        names[k], argv[i],
+			        (double)bench.input_len * N_REPEAT / (1024.0 * 1024.0) /
+			            ((double)tsum * 1e-9),
+			        bench.latency_sum / bench.n_latency, bench.latency_max);
+		}
+		if (checksum[0] != checksum[1]) {
+			FX_PRINT_ERR("Checksum mismatch!\n");
+			return 1;
+		}
+		free((void *)bench.input);
+	}
+	FX_PRINT_OK("Done parsing files.\n");
+	free(bench.bufs);
+	return 0;
+}
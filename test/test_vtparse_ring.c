@@ -0,0 +1,212 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_ring.c
+ *
+ * Checks that feeding input to the ring buffer module in arbitrary pieces
+ * produces exactly the events vtparse_parse() produces for the entire input,
+ * i.e. that spans are never split at read boundaries.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <string.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_ring.h>
+
+#define INPUT_LEN 65536U
+
+static unsigned char input[INPUT_LEN];
+
+static void make_input(void) {
+	static const char alphabet[] =
+	    "\033\033[[;;12mHJ]P\\\007\030\b\r\n\t abcdefghijklmnop\303\251\342\202\254";
+	unsigned int i, seed = 4711U;
+	for (i = 0; i < INPUT_LEN; i++) {
+		seed = seed * 1103515245U + 12345U;
+		input[i] = (unsigned char)alphabet[(seed >> 16U) % (sizeof(alphabet) - 1U)];
+	}
+}
+
+/* Folds the event into the hash; in contrast to the hash used by
+   test_vtparse.c, this one depends on where the data ranges are split */
+static unsigned long fold_event(unsigned long hash, const vtparse_t *parser) {
+	const unsigned char *p;
+	int i;
+
+	hash = hash * 31UL + (unsigned long)parser->action;
+	if (parser->data_begin != parser->data_end) {
+		hash = hash * 31UL + (unsigned long)(parser->data_end - parser->data_begin);
+		hash = hash * 31UL + (unsigned long)parser->num_line_breaks;
+		for (p = parser->data_begin; p < parser->data_end; p++) {
+			hash = hash * 31UL + *p;
+		}
+		return hash;
+	}
+	hash = hash * 31UL + (unsigned long)parser->ch;
+	for (i = 0; i < parser->num_params; i++) {
+		hash = hash * 31UL + (unsigned long)parser->params[i];
+	}
+	return hash;
+}
+
+static unsigned long reference_hash(unsigned int options) {
+	vtparse_t parser;
+	unsigned long hash = 0;
+	unsigned int pos = 0;
+
+	vtparse_init(&parser);
+	vtparse_set_options(&parser, options);
+	while (1) {
+		pos += vtparse_parse(&parser, input + pos, INPUT_LEN - pos);
+		if (!vtparse_has_event(&parser)) {
+			break;
+		}
+		hash = fold_event(hash, &parser);
+	}
+	return hash;
+}
+
+static unsigned long ring_hash(unsigned int size, unsigned int flags,
+                               unsigned int options, unsigned int max_chunk) {
+	vtparse_ring_t *ring = vtparse_ring_open(size, flags);
+	vtparse_t *parser;
+	unsigned long hash = 0;
+	unsigned int pos = 0, len, seed = 1U;
+
+	if (!ring) {
+		return 0;
+	}
+	vtparse_set_options(vtparse_ring_parser(ring), options);
+	while (pos < INPUT_LEN) {
+		seed = seed * 1103515245U + 12345U;
+		len = 1U + (seed >> 16U) % max_chunk;
+		len = len > INPUT_LEN - pos ? INPUT_LEN - pos : len;
+		pos += vtparse_feed(ring, input + pos, len);
+		while ((parser = vtparse_next_event(ring, 0))) {
+			hash = fold_event(hash, parser);
+		}
+	}
+	while ((parser = vtparse_next_event(ring, 1))) {
+		hash = fold_event(hash, parser);
+	}
+	vtparse_ring_close(ring);
+	return hash;
+}
+
+void test_ring_spans() {
+	unsigned int options;
+	for (options = 0; options <= VTPARSE_OPTION_LINE_SPANS; options++) {
+		EXPECT_EQ(reference_hash(options), ring_hash(0, 0, options, 1U));
+		EXPECT_EQ(reference_hash(options), ring_hash(0, 0, options, 7U));
+		EXPECT_EQ(reference_hash(options), ring_hash(0, 0, options, 4096U));
+		EXPECT_EQ(reference_hash(options),
+		          ring_hash(0, VTPARSE_RING_NO_MMAP, options, 7U));
+		EXPECT_EQ(reference_hash(options),
+		          ring_hash(0, VTPARSE_RING_NO_MMAP, options, 4096U));
+	}
+}
+
+void test_ring_wrap() {
+	/* Input larger than the ring, with runs crossing the end of the ring */
+	EXPECT_EQ(reference_hash(0), ring_hash(4096U, 0, 0, 1000U));
+	EXPECT_EQ(reference_hash(0),
+	          ring_hash(4096U, VTPARSE_RING_NO_MMAP, 0, 1000U));
+}
+
+void test_ring_utf8() {
+	const unsigned char buf1[] = "h\303";
+	const unsigned char buf2[] = "\251llo";
+	const unsigned char buf3[] = "\r\n";
+	vtparse_ring_t *ring = vtparse_ring_open(0, 0);
+	vtparse_t *parser;
+
+	/* A UTF-8 sequence split between two reads arrives in one span */
+	EXPECT_EQ(2U, vtparse_feed(ring, buf1, 2U));
+	EXPECT_TRUE(vtparse_next_event(ring, 0) == NULL);
+	EXPECT_EQ(4U, vtparse_feed(ring, buf2, 4U));
+	EXPECT_TRUE(vtparse_next_event(ring, 0) == NULL);
+	EXPECT_EQ(2U, vtparse_feed(ring, buf3, 2U));
+	parser = vtparse_next_event(ring, 0);
+	EXPECT_TRUE(parser != NULL);
+	if (!parser) {
+		vtparse_ring_close(ring);
+		return;
+	}
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser->action);
+	EXPECT_EQ(6, parser->data_end - parser->data_begin);
+	EXPECT_EQ(0, memcmp(parser->data_begin, "h\303\251llo", 6U));
+	parser = vtparse_next_event(ring, 0);
+	EXPECT_EQ(VTPARSE_ACTION_EXECUTE, parser->action);
+	EXPECT_EQ('\r', parser->ch);
+	parser = vtparse_next_event(ring, 0);
+	EXPECT_EQ(VTPARSE_ACTION_EXECUTE, parser->action);
+	EXPECT_EQ('\n', parser->ch);
+	EXPECT_TRUE(vtparse_next_event(ring, 0) == NULL);
+
+	/* Flushing returns the pending text */
+	EXPECT_EQ(1U, vtparse_feed(ring, buf1, 1U));
+	EXPECT_TRUE(vtparse_next_event(ring, 0) == NULL);
+	parser = vtparse_next_event(ring, 1);
+	EXPECT_TRUE(parser != NULL);
+	if (!parser) {
+		vtparse_ring_close(ring);
+		return;
+	}
+	EXPECT_EQ(VTPARSE_ACTION_PRINT, parser->action);
+	EXPECT_EQ(1, parser->data_end - parser->data_begin);
+	EXPECT_EQ('h', parser->data_begin[0]);
+	EXPECT_TRUE(vtparse_next_event(ring, 1) == NULL);
+
+	vtparse_ring_close(ring);
+}
+
+void test_ring_full() {
+	unsigned char buf[1024];
+	unsigned int n = 0, n_events = 0, avail;
+	vtparse_ring_t *ring = vtparse_ring_open(4096U, 0);
+	vtparse_t *parser;
+
+	/* A run filling the entire ring is returned even without flushing */
+	memset(buf, 'x', sizeof(buf));
+	while (n < 8192U) {
+		n += vtparse_feed(ring, buf, sizeof(buf));
+		while ((parser = vtparse_next_event(ring, 0))) {
+			EXPECT_EQ(VTPARSE_ACTION_PRINT, parser->action);
+			n_events++;
+		}
+		vtparse_ring_write_ptr(ring, &avail);
+		EXPECT_TRUE(avail > 0U);
+	}
+	EXPECT_TRUE(n_events > 0U);
+	vtparse_ring_close(ring);
+}
+
+int main() {
+	make_input();
+	RUN(test_ring_spans);
+	RUN(test_ring_wrap);
+	RUN(test_ring_utf8);
+	RUN(test_ring_full);
+	DONE;
+}
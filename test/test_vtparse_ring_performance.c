@@ -0,0 +1,182 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_ring_performance.c
+ *
+ * Feeds the given files to the parser in reads of random size (as delivered
+ * by a pipe or PTY), once by calling vtparse_parse() on each read and once
+ * through the ring buffer module. Reports the throughput and the number of
+ * data spans the consumer has to process.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_ring.h>
+
+#define N_REPEAT 20
+#define MAX_READ 4096U
+
+static long long int nanotime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return tp.tv_sec * 1000LL * 1000LL * 1000LL + tp.tv_nsec;
+}
+
+static unsigned char *read_file(const char *filename, unsigned int *len) {
+	unsigned char *buf = NULL, *new_buf;
+	size_t n;
+	FILE *f = fopen(filename, "rb");
+	*len = 0;
+	if (!f) {
+		return NULL;
+	}
+	do {
+		if (!(new_buf = realloc(buf, *len + 65536U))) {
+			break;
+		}
+		buf = new_buf;
+		n = fread(buf + *len, 1, 65536U, f);
+		*len += (unsigned int)n;
+	} while (n > 0);
+	fclose(f);
+	return buf;
+}
+
+static unsigned int next_read(unsigned int *seed, unsigned int pos,
+                              unsigned int len) {
+	unsigned int n;
+	*seed = *seed * 1103515245U + 12345U;
+	n = 1U + (*seed >> 16U) % MAX_READ;
+	return n > len - pos ? len - pos : n;
+}
+
+/* Both variants copy each read into a buffer, just like read() would */
+static unsigned long parse_direct(const unsigned char *input, unsigned int len,
+                                  unsigned long *n_spans) {
+	static unsigned char buf[MAX_READ];
+	vtparse_t parser;
+	unsigned long n_events = 0;
+	unsigned int pos = 0, buf_pos, n, seed = 1U;
+
+	vtparse_init(&parser);
+	while (pos < len) {
+		n = next_read(&seed, pos, len);
+		memcpy(buf, input + pos, n);
+		pos += n;
+		buf_pos = 0;
+		while (1) {
+			buf_pos += vtparse_parse(&parser, buf + buf_pos, n - buf_pos);
+			if (!vtparse_has_event(&parser)) {
+				break;
+			}
+			n_events++;
+			*n_spans += parser.data_begin != parser.data_end;
+		}
+	}
+	return n_events;
+}
+
+static unsigned long parse_ring(vtparse_ring_t *ring,
+                                const unsigned char *input, unsigned int len,
+                                unsigned long *n_spans) {
+	vtparse_t *parser;
+	unsigned long n_events = 0;
+	unsigned int pos = 0, n, seed = 1U;
+	int flush = 0;
+
+	while (!flush) {
+		n = next_read(&seed, pos, len);
+		pos += vtparse_feed(ring, input + pos, n);
+		flush = pos == len;
+		while ((parser = vtparse_next_event(ring, flush))) {
+			n_events++;
+			*n_spans += parser->data_begin != parser->data_end;
+		}
+	}
+	return n_events;
+}
+
+int main(int argc, char *argv[]) {
+	static const char *names[] = {"vtparse_parse()", "ring (mapped)",
+	                              "ring (fallback)"};
+	unsigned char *input;
+	unsigned int input_len;
+	unsigned long n_events, n_spans;
+	long long int t0, tsum;
+	vtparse_ring_t *ring;
+	int i, j, k;
+
+	if (argc <= 1) {
+		fprintf(stderr,
+		        "Usage ./test_vtparse_ring_performance <INPUT FILE 1> ... "
+		        "<INPUT FILE N>\n");
+		return 1;
+	}
+
+	FX_PRINT_ARROW("Parsing files\n");
+	for (j = 1; j < argc; j++) {
+		input = read_file(argv[j], &input_len);
+		if (!input || input_len == 0U) {
+			FX_PRINT_ERR("Error while reading \"%s\"!\n", argv[j]);
+			return 1;
+		}
+		for (k = 0; k < 3; k++) {
+			ring = NULL;
+			if (k > 0) {
+				ring = vtparse_ring_open(0, k == 2 ? VTPARSE_RING_NO_MMAP : 0U);
+				if (!ring || (k == 1 && !vtparse_ring_is_mapped(ring))) {
+					vtparse_ring_close(ring);
+					continue;
+				}
+			}
+			tsum = 0;
+			for (i = 0; i < N_REPEAT; i++) {
+				n_spans = 0;
+				t0 = nanotime();
+				if (k == 0) {
+					n_events = parse_direct(input, input_len, &n_spans);
+				} else {
+					n_events = parse_ring(ring, input, input_len, &n_spans);
+				}
+				tsum += nanotime() - t0;
+			}
+			vtparse_ring_close(ring);
+			fprintf(stdout,
+			        "      %-16s \"%s\": %.1f MiB/s, %lu events, %lu spans\n",
+			        names[k], argv[j],
+			        (double)input_len * N_REPEAT / (1024.0 * 1024.0) /
+			            ((double)tsum * 1e-9),
+			        n_events, n_spans);
+		}
+		free(input);
+	}
+	FX_PRINT_OK("Done parsing files.\n");
+	return 0;
+}
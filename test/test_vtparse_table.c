@@ -0,0 +1,122 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_table.c
+ *
+ * Verifies the memory layout of the generated tables: the tables consulted in
+ * the ground state must occupy as few cache lines as possible. The tables are
+ * hidden in the shared library, so this test is linked against the object
+ * files of the library instead.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <string.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_grapheme_table.h>
+#include <vtparse/vtparse_sequence_table.h>
+#include <vtparse/vtparse_table.h>
+#include <vtparse/vtparse_width_table.h>
+
+#define LINE(ptr) \
+	((unsigned long)(const void *)(ptr) / (unsigned long)VTPARSE_TABLE_ALIGNMENT)
+#define OFFSET(ptr) \
+	((unsigned long)(const void *)(ptr) % (unsigned long)VTPARSE_TABLE_ALIGNMENT)
+
+/* Returns the number of cache lines touched by the given memory region */
+static unsigned long n_lines(const void *ptr, unsigned long size) {
+	const unsigned char *p = (const unsigned char *)ptr;
+	return LINE(p + size - 1) - LINE(p) + 1U;
+}
+
+void test_table_state_table() {
+	const unsigned long lines_per_row = 256U / VTPARSE_TABLE_ALIGNMENT;
+	const vtparse_state_change_t *ground = STATE_TABLE[VTPARSE_STATE_GROUND - 1];
+	unsigned int s, c;
+
+	/* Each row starts at a cache line boundary */
+	for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+		EXPECT_EQ(0UL, OFFSET(STATE_TABLE[s]));
+		EXPECT_EQ(lines_per_row, n_lines(STATE_TABLE[s], 256U));
+	}
+
+	/* Every byte of the ground state row lies in the intended cache line */
+	for (c = 0; c < 256U; c++) {
+		EXPECT_EQ(LINE(ground) + c / VTPARSE_TABLE_ALIGNMENT, LINE(&ground[c]));
+	}
+}
+
+void test_table_actions() {
+	const vtparse_run_class_t *run_class =
+	    &RUN_CLASSES[VTPARSE_STATE_GROUND - 1];
+
+	/* Entry and exit actions are packed into a single cache line each */
+	EXPECT_EQ(1U, sizeof(ENTRY_ACTIONS[0]));
+	EXPECT_EQ(1U, sizeof(EXIT_ACTIONS[0]));
+	EXPECT_EQ(0UL, OFFSET(ENTRY_ACTIONS));
+	EXPECT_EQ(0UL, OFFSET(EXIT_ACTIONS));
+	EXPECT_EQ(1UL, n_lines(ENTRY_ACTIONS, sizeof(ENTRY_ACTIONS)));
+	EXPECT_EQ(1UL, n_lines(EXIT_ACTIONS, sizeof(EXIT_ACTIONS)));
+
+	/* The run class of the ground state does not straddle two lines */
+	EXPECT_EQ(0UL, OFFSET(RUN_CLASSES));
+	EXPECT_EQ(1UL, n_lines(run_class, sizeof(vtparse_run_class_t)));
+}
+
+void test_table_byte_classes() {
+	EXPECT_EQ(0UL, OFFSET(BYTE_CLASSES));
+	EXPECT_EQ(0UL, OFFSET(STRIDE2_TABLE));
+	EXPECT_EQ(0UL, OFFSET(STRIDE2_OPS));
+	EXPECT_EQ(256UL / VTPARSE_TABLE_ALIGNMENT,
+	          n_lines(BYTE_CLASSES, sizeof(BYTE_CLASSES)));
+}
+
+void test_table_other() {
+	/* The sequence DFA is consulted after each ESC */
+	EXPECT_EQ(0UL, OFFSET(SEQUENCE_CLASSES));
+	EXPECT_EQ(0UL, OFFSET(SEQUENCE_DFA));
+	EXPECT_EQ(0UL, OFFSET(SEQUENCE_ACCEPT));
+	EXPECT_EQ(1UL, n_lines(SEQUENCE_ACCEPT, sizeof(SEQUENCE_ACCEPT)));
+
+	/* Two-stage Unicode tables */
+	EXPECT_EQ(0UL, OFFSET(WIDTH_STAGE1));
+	EXPECT_EQ(0UL, OFFSET(WIDTH_STAGE2));
+	EXPECT_EQ(0UL, OFFSET(GRAPHEME_STAGE1));
+	EXPECT_EQ(0UL, OFFSET(GRAPHEME_STAGE2));
+	EXPECT_EQ(0UL, OFFSET(GRAPHEME_NO_BREAK));
+	EXPECT_EQ(1UL, n_lines(GRAPHEME_NO_BREAK, sizeof(GRAPHEME_NO_BREAK)));
+}
+
+void test_table_unicode_version() {
+	/* Column widths and grapheme clusters follow the same Unicode release */
+	EXPECT_EQ(0, strcmp(VTPARSE_WIDTH_UNICODE_VERSION,
+	                    VTPARSE_GRAPHEME_UNICODE_VERSION));
+}
+
+int main() {
+	RUN(test_table_state_table);
+	RUN(test_table_actions);
+	RUN(test_table_byte_classes);
+	RUN(test_table_other);
+	RUN(test_table_unicode_version);
+	DONE;
+}
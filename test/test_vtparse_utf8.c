@@ -0,0 +1,275 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_utf8.c
+ *
+ * Unit tests for the UTF-8 validator and decoder. Random input is validated
+ * with every instruction set supported by the CPU and split at random
+ * positions; all variants must agree with the scalar decoder. The same holds
+ * for the column width computed from the decoded code points.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_utf8.h>
+
+#define INPUT_LEN 20000U
+
+static int validate(const char *str, unsigned int *num_codepoints,
+                    unsigned int *error_offset) {
+	vtparse_utf8_t utf8;
+	vtparse_utf8_result_t res;
+	unsigned int len = 0;
+	while (str[len]) {
+		len++;
+	}
+	vtparse_utf8_init(&utf8);
+	vtparse_utf8_validate(&utf8, (const unsigned char *)str, len, &res);
+	*num_codepoints = res.num_codepoints;
+	*error_offset = res.error_offset;
+	return res.status;
+}
+
+void test_utf8_validate() {
+	unsigned int n, offs;
+
+	EXPECT_EQ(VTPARSE_UTF8_ASCII, validate("hello", &n, &offs));
+	EXPECT_EQ(5U, n);
+	EXPECT_EQ(VTPARSE_UTF8_VALID, validate("h\303\251llo", &n, &offs));
+	EXPECT_EQ(5U, n);
+	EXPECT_EQ(VTPARSE_UTF8_VALID,
+	          validate("\342\202\254\360\237\230\200", &n, &offs));
+	EXPECT_EQ(2U, n);
+
+	/* Overlong encodings, surrogates, code points beyond U+10FFFF */
+	EXPECT_EQ(VTPARSE_UTF8_INVALID, validate("ab\300\200", &n, &offs));
+	EXPECT_EQ(2U, offs);
+	EXPECT_EQ(4U, n);
+	EXPECT_EQ(VTPARSE_UTF8_INVALID, validate("a\340\200\200", &n, &offs));
+	EXPECT_EQ(1U, offs);
+	EXPECT_EQ(VTPARSE_UTF8_INVALID, validate("\355\240\200", &n, &offs));
+	EXPECT_EQ(0U, offs);
+	EXPECT_EQ(VTPARSE_UTF8_INVALID, validate("xy\364\220\200\200", &n, &offs));
+	EXPECT_EQ(2U, offs);
+
+	/* Truncated sequence followed by ASCII: one replacement character */
+	EXPECT_EQ(VTPARSE_UTF8_INVALID, validate("\342\202A", &n, &offs));
+	EXPECT_EQ(0U, offs);
+	EXPECT_EQ(2U, n);
+}
+
+void test_utf8_split() {
+	const unsigned char buf[] = "a\342\202\254b";
+	vtparse_utf8_t utf8;
+	vtparse_utf8_result_t res;
+	unsigned long cps[8];
+	unsigned int n, n_read;
+
+	/* A character split between ranges is carried over */
+	vtparse_utf8_init(&utf8);
+	EXPECT_EQ(VTPARSE_UTF8_VALID, vtparse_utf8_validate(&utf8, buf, 2U, &res));
+	EXPECT_EQ(1U, res.num_codepoints);
+	EXPECT_EQ(VTPARSE_UTF8_VALID,
+	          vtparse_utf8_validate(&utf8, buf + 2, 3U, &res));
+	EXPECT_EQ(2U, res.num_codepoints);
+
+	vtparse_utf8_init(&utf8);
+	n = vtparse_utf8_decode(&utf8, buf, 3U, cps, 8U, &n_read);
+	EXPECT_EQ(1U, n);
+	EXPECT_EQ(3U, n_read);
+	EXPECT_EQ((unsigned long)'a', cps[0]);
+	n = vtparse_utf8_decode(&utf8, buf + 3, 2U, cps, 8U, &n_read);
+	EXPECT_EQ(2U, n);
+	EXPECT_EQ(0x20ACUL, cps[0]);
+	EXPECT_EQ((unsigned long)'b', cps[1]);
+
+	/* A control character interrupting the character */
+	vtparse_utf8_init(&utf8);
+	vtparse_utf8_validate(&utf8, buf + 1, 2U, &res);
+	EXPECT_TRUE(vtparse_utf8_flush(&utf8));
+	EXPECT_FALSE(vtparse_utf8_flush(&utf8));
+}
+
+void test_utf8_width() {
+	/* Latin, combining acute accent, CJK, Hangul, emoji, fullwidth A */
+	const unsigned char buf[] =
+	    "a\314\201\344\275\240\352\260\200\360\237\230\200\357\274\241";
+	vtparse_utf8_t utf8;
+	unsigned int i, w;
+
+	EXPECT_EQ(1, vtparse_codepoint_width('a'));
+	EXPECT_EQ(0, vtparse_codepoint_width(0x0301UL));
+	EXPECT_EQ(0, vtparse_codepoint_width(0x200BUL));
+	EXPECT_EQ(0, vtparse_codepoint_width(0x1160UL));
+	EXPECT_EQ(1, vtparse_codepoint_width(0x00ADUL));
+	EXPECT_EQ(1, vtparse_codepoint_width(0x00E9UL));
+	EXPECT_EQ(2, vtparse_codepoint_width(0x4F60UL));
+	EXPECT_EQ(2, vtparse_codepoint_width(0xAC00UL));
+	EXPECT_EQ(2, vtparse_codepoint_width(0x1F600UL));
+	EXPECT_EQ(2, vtparse_codepoint_width(0xFF21UL));
+	EXPECT_EQ(2, vtparse_codepoint_width(0x20000UL));
+	EXPECT_EQ(2, vtparse_codepoint_width(0x1FAE8UL)); /* Unicode 15.0 */
+	EXPECT_EQ(2, vtparse_codepoint_width(0x3FFFDUL)); /* Reserved, wide */
+	EXPECT_EQ(1, vtparse_codepoint_width(0x50000UL)); /* Reserved */
+	EXPECT_EQ(1, vtparse_codepoint_width(VTPARSE_UTF8_REPLACEMENT));
+
+	vtparse_utf8_init(&utf8);
+	EXPECT_EQ(9U, vtparse_utf8_width(&utf8, buf, sizeof(buf) - 1U));
+
+	/* Byte by byte */
+	vtparse_utf8_init(&utf8);
+	for (i = 0, w = 0; i < sizeof(buf) - 1U; i++) {
+		w += vtparse_utf8_width(&utf8, buf + i, 1U);
+	}
+	EXPECT_EQ(9U, w);
+}
+
+static unsigned int rnd(unsigned int *seed) {
+	*seed = *seed * 1103515245U + 12345U;
+	return (*seed >> 16U) & 0x7FFFU;
+}
+
+/* Mostly valid UTF-8 with long ASCII runs and the occasional corrupted byte */
+static void make_input(unsigned char *buf, unsigned int *seed) {
+	static const char *chars[] = {"a", "Z", " ", "\303\251", "\342\202\254",
+	                              "\344\275\240", "\360\237\230\200",
+	                              "\357\277\277", "\364\217\277\277"};
+	unsigned int i = 0, j, r;
+	const char *c;
+	while (i < INPUT_LEN) {
+		r = rnd(seed);
+		if (r % 64U == 0U) {
+			buf[i++] = (unsigned char)(rnd(seed) & 0xFFU);
+		} else if (r % 4U == 0U) {
+			c = chars[rnd(seed) % (sizeof(chars) / sizeof(chars[0]))];
+			for (j = 0; c[j] && i < INPUT_LEN; j++) {
+				buf[i++] = (unsigned char)c[j];
+			}
+		} else {
+			for (j = rnd(seed) % 48U; j > 0U && i < INPUT_LEN; j--) {
+				buf[i++] = (unsigned char)('a' + j % 26U);
+			}
+		}
+	}
+}
+
+void test_utf8_random() {
+	static unsigned char buf[INPUT_LEN];
+	static unsigned long cps[INPUT_LEN];
+	vtparse_utf8_t utf8;
+	vtparse_utf8_result_t res;
+	unsigned int i, pos, len, n_ref, n, n_read, offs, offs_ref, seed = 4711U;
+	unsigned int width, width_ref;
+	int isa, status, status_ref, pending, ok = 1;
+
+	for (i = 0; i < 50U; i++) {
+		make_input(buf, &seed);
+		if (i % 2U) {
+			/* Ensure that some inputs are valid */
+			vtparse_utf8_init(&utf8);
+			n = vtparse_utf8_decode(&utf8, buf, INPUT_LEN, cps, INPUT_LEN,
+			                        &n_read);
+			for (pos = 0; pos < INPUT_LEN; pos++) {
+				buf[pos] = buf[pos] == 0xFFU ? 'x' : buf[pos];
+			}
+		}
+
+		/* Reference: scalar decoder, whole input */
+		vtparse_set_isa(VTPARSE_ISA_SCALAR);
+		vtparse_utf8_init(&utf8);
+		status_ref = vtparse_utf8_validate(&utf8, buf, INPUT_LEN, &res);
+		n_ref = res.num_codepoints + (unsigned int)vtparse_utf8_flush(&utf8);
+		offs_ref = res.error_offset;
+
+		vtparse_utf8_init(&utf8);
+		n = vtparse_utf8_decode(&utf8, buf, INPUT_LEN, cps, INPUT_LEN, &n_read);
+		ok = ok && (n_read == INPUT_LEN);
+		for (pos = 0, width_ref = 0; pos < n; pos++) {
+			width_ref += (unsigned int)vtparse_codepoint_width(cps[pos]);
+		}
+		pending = vtparse_utf8_flush(&utf8);
+		width_ref += (unsigned int)pending;
+		n += (unsigned int)pending;
+		ok = ok && (n == n_ref);
+
+		for (isa = VTPARSE_ISA_SCALAR; isa <= VTPARSE_ISA_AVX512; isa++) {
+			if (vtparse_set_isa(isa) != isa) {
+				continue;
+			}
+
+			/* Whole input */
+			vtparse_utf8_init(&utf8);
+			status = vtparse_utf8_validate(&utf8, buf, INPUT_LEN, &res);
+			ok = ok && status == status_ref &&
+			     res.num_codepoints + (unsigned int)vtparse_utf8_flush(&utf8) ==
+			         n_ref &&
+			     (status != VTPARSE_UTF8_INVALID || res.error_offset == offs_ref);
+
+			/* Random pieces */
+			vtparse_utf8_init(&utf8);
+			n = 0;
+			offs = INPUT_LEN;
+			for (pos = 0; pos < INPUT_LEN; pos += len) {
+				len = 1U + rnd(&seed) % 200U;
+				len = len > INPUT_LEN - pos ? INPUT_LEN - pos : len;
+				if (vtparse_utf8_validate(&utf8, buf + pos, len, &res) ==
+				        VTPARSE_UTF8_INVALID &&
+				    offs == INPUT_LEN) {
+					offs = pos + res.error_offset;
+				}
+				n += res.num_codepoints;
+			}
+			n += (unsigned int)vtparse_utf8_flush(&utf8);
+			ok = ok && n == n_ref;
+
+			/* Column width, whole input and in random pieces */
+			vtparse_utf8_init(&utf8);
+			width = vtparse_utf8_width(&utf8, buf, INPUT_LEN);
+			width += (unsigned int)vtparse_utf8_flush(&utf8);
+			ok = ok && width == width_ref;
+			vtparse_utf8_init(&utf8);
+			width = 0;
+			for (pos = 0; pos < INPUT_LEN; pos += len) {
+				len = 1U + rnd(&seed) % 200U;
+				len = len > INPUT_LEN - pos ? INPUT_LEN - pos : len;
+				width += vtparse_utf8_width(&utf8, buf + pos, len);
+			}
+			width += (unsigned int)vtparse_utf8_flush(&utf8);
+			ok = ok && width == width_ref;
+			/* An invalid sequence starting in an earlier piece is reported at
+			   the beginning of the piece it is detected in */
+			ok = ok && (status_ref != VTPARSE_UTF8_INVALID ||
+			            (offs >= offs_ref && offs <= offs_ref + 3U));
+		}
+	}
+	vtparse_set_isa(VTPARSE_ISA_AUTO);
+	EXPECT_TRUE(ok);
+}
+
+int main() {
+	RUN(test_utf8_validate);
+	RUN(test_utf8_split);
+	RUN(test_utf8_width);
+	RUN(test_utf8_random);
+	DONE;
+}
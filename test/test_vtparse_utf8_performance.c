@@ -0,0 +1,154 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file test_vtparse_utf8_performance.c
+ *
+ * Parses the given files and validates each PRINT span, as well as computes
+ * its column width, with every instruction set supported by the CPU. Reports
+ * the throughput relative to the number of printed bytes.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <foxen/unittest.h>
+
+#include <vtparse/vtparse_utf8.h>
+
+#define N_REPEAT 20
+#define MAX_SPANS (1U << 20U)
+
+static long long int nanotime() {
+	struct timespec tp;
+	clock_gettime(CLOCK_MONOTONIC, &tp);
+	return tp.tv_sec * 1000LL * 1000LL * 1000LL + tp.tv_nsec;
+}
+
+static unsigned char *read_file(const char *filename, unsigned int *len) {
+	unsigned char *buf = NULL, *new_buf;
+	size_t n;
+	FILE *f = fopen(filename, "rb");
+	*len = 0;
+	if (!f) {
+		return NULL;
+	}
+	do {
+		if (!(new_buf = realloc(buf, *len + 65536U))) {
+			break;
+		}
+		buf = new_buf;
+		n = fread(buf + *len, 1, 65536U, f);
+		*len += (unsigned int)n;
+	} while (n > 0);
+	fclose(f);
+	return buf;
+}
+
+int main(int argc, char *argv[]) {
+	static const char *names[] = {"scalar", "sse2", "avx2", "avx512"};
+	static const char *modes[] = {"validate", "width"};
+	static const unsigned char *spans[MAX_SPANS];
+	static unsigned int span_lens[MAX_SPANS];
+	unsigned char *input;
+	unsigned int input_len, pos, n_spans, n_bytes, i, n_result;
+	vtparse_t parser;
+	vtparse_utf8_t utf8;
+	vtparse_utf8_result_t res;
+	long long int t0, tsum;
+	int isa, mode, j, k;
+
+	if (argc <= 1) {
+		fprintf(stderr,
+		        "Usage ./test_vtparse_utf8_performance <INPUT FILE 1> ... "
+		        "<INPUT FILE N>\n");
+		return 1;
+	}
+
+	FX_PRINT_ARROW("Validating PRINT spans\n");
+	for (j = 1; j < argc; j++) {
+		input = read_file(argv[j], &input_len);
+		if (!input || input_len == 0U) {
+			FX_PRINT_ERR("Error while reading \"%s\"!\n", argv[j]);
+			return 1;
+		}
+
+		/* Collect the spans first, so only the validator is measured */
+		vtparse_init(&parser);
+		n_spans = 0;
+		n_bytes = 0;
+		pos = 0;
+		while (n_spans < MAX_SPANS) {
+			pos += vtparse_parse(&parser, input + pos, input_len - pos);
+			if (!vtparse_has_event(&parser)) {
+				break;
+			}
+			if (parser.action == VTPARSE_ACTION_PRINT) {
+				spans[n_spans] = parser.data_begin;
+				span_lens[n_spans] =
+				    (unsigned int)(parser.data_end - parser.data_begin);
+				n_bytes += span_lens[n_spans++];
+			}
+		}
+
+		for (isa = VTPARSE_ISA_SCALAR; isa <= VTPARSE_ISA_AVX512; isa++) {
+			if (vtparse_set_isa(isa) != isa) {
+				continue;
+			}
+			for (mode = 0; mode < 2; mode++) {
+				tsum = 0;
+				n_result = 0;
+				for (k = 0; k < N_REPEAT; k++) {
+					n_result = 0;
+					t0 = nanotime();
+					vtparse_utf8_init(&utf8);
+					for (i = 0; i < n_spans; i++) {
+						if (mode == 0) {
+							vtparse_utf8_validate(&utf8, spans[i], span_lens[i],
+							                      &res);
+							n_result += res.num_codepoints;
+						} else {
+							n_result +=
+							    vtparse_utf8_width(&utf8, spans[i], span_lens[i]);
+						}
+					}
+					tsum += nanotime() - t0;
+				}
+				fprintf(stdout,
+				        "      %-8s %-8s \"%s\": %.1f MiB/s, %u spans, %u bytes, "
+				        "%u %s\n",
+				        names[isa - VTPARSE_ISA_SCALAR], modes[mode], argv[j],
+				        (double)n_bytes * N_REPEAT / (1024.0 * 1024.0) /
+				            ((double)tsum * 1e-9),
+				        n_spans, n_bytes, n_result,
+				        mode == 0 ? "characters" : "columns");
+			}
+		}
+		vtparse_set_isa(VTPARSE_ISA_AUTO);
+		free(input);
+	}
+	FX_PRINT_OK("Done validating PRINT spans.\n");
+	return 0;
+}
@@ -30,6 +30,9 @@
  */
 
 #include <vtparse/vtparse.h>
+#include <vtparse/vtparse_dialect.h>
+#include <vtparse/vtparse_dispatch.h>
+#include <vtparse/vtparse_sequence_table.h>
 #include <vtparse/vtparse_table.h>
 
 /******************************************************************************
@@ -55,18 +58,218 @@ typedef enum vtparse_cycle {
  */
 #define STATE(state_change) ((state_change & 0xF0U) >> 4)
 
+/**
+ * Returns true if the given state change solely consists of an action that
+ * produces data, i.e. VTPARSE_ACTION_PRINT, VTPARSE_ACTION_PUT or
+ * VTPARSE_ACTION_OSC_PUT.
+ */
+#define IS_DATA_ACTION(state_change)                                   \
+	(((state_change) == VTPARSE_ACTION_PRINT) ||                       \
+	 ((state_change) == VTPARSE_ACTION_PUT) ||                         \
+	 ((state_change) == VTPARSE_ACTION_OSC_PUT))
+
+/**
+ * Returns true if the given character is kept inside VTPARSE_ACTION_PRINT
+ * ranges if VTPARSE_OPTION_LINE_SPANS is set.
+ */
+#define IS_LINE_CHAR(ch) (((ch) == '\n') || ((ch) == '\r') || ((ch) == '\t'))
+
+/**
+ * Inputs up to this length take the small-input fast path in vtparse_parse().
+ */
+#define VTPARSE_SMALL_INPUT_LEN 16U
+
+/**
+ * Keeps the compiler from inlining the given function.
+ */
+#if defined(__GNUC__)
+#define VTPARSE_NOINLINE __attribute__((noinline))
+#else
+#define VTPARSE_NOINLINE
+#endif
+
+/**
+ * Asks the compiler to inline the given function into all of its callers.
+ */
+#if defined(__GNUC__)
+#define VTPARSE_ALWAYS_INLINE __inline__ __attribute__((always_inline))
+#else
+#define VTPARSE_ALWAYS_INLINE
+#endif
+
+/**
+ * Consumes printable characters and line characters starting at buf[n_read]
+ * and counts the line feeds. Returns the index of the first character that
+ * does not belong to the range.
+ */
+static int vtparse_scan_line_span(const vtparse_state_change_t *row,
+                                  const unsigned char *buf, int n_read,
+                                  unsigned int buf_len, int *num_line_breaks) {
+	unsigned char ch;
+	while (n_read < (int)buf_len) {
+		ch = buf[n_read];
+		if (row[ch] != VTPARSE_ACTION_PRINT) {
+			if (!IS_LINE_CHAR(ch)) {
+				break;
+			}
+			*num_line_breaks += (ch == '\n');
+		}
+		n_read++;
+	}
+	return n_read;
+}
+
+/**
+ * Returns a pointer at the i-th parameter, which is either stored in the
+ * params array or in the arena.
+ */
+static int *vtparse_param_ptr(vtparse_t *parser, int i) {
+	if (i < (int)VTPARSE_MAX_PARAMS) {
+		return &parser->params[i];
+	}
+	return &parser->priv_.arena->params[i - VTPARSE_MAX_PARAMS];
+}
+
+/**
+ * Accumulates a single parameter character (a digit or ';') into the params
+ * array.
+ */
+static void vtparse_collect_param(vtparse_t *parser, char ch) {
+	const vtparse_arena_t *arena = parser->priv_.arena;
+	const int max_params =
+	    VTPARSE_MAX_PARAMS + (arena ? arena->max_params : 0U);
+
+	if (ch == ';') {
+		if (parser->num_params < max_params) {
+			parser->num_params += 1;
+			*vtparse_param_ptr(parser, parser->num_params - 1) = 0;
+		} else {
+			parser->error = 1;
+		}
+	} else if (!parser->error) {
+		/* the character is a digit */
+		int *current_param;
+
+		if (parser->num_params == 0) {
+			parser->num_params = 1;
+			parser->params[0] = 0;
+		}
+
+		current_param = vtparse_param_ptr(parser, parser->num_params - 1);
+		*current_param *= 10;
+		*current_param += (ch - '0');
+	}
+}
+
+/**
+ * Appends a character to the intermediate characters.
+ */
+static void vtparse_collect(vtparse_t *parser, char ch) {
+	const vtparse_arena_t *arena = parser->priv_.arena;
+	const int i = parser->num_intermediate_chars;
+
+	if (i < (int)VTPARSE_MAX_INTERMEDIATE_CHARS) {
+		parser->intermediate_chars[i] = ch;
+	} else if (arena && i < (int)(VTPARSE_MAX_INTERMEDIATE_CHARS +
+	                              arena->max_intermediate_chars)) {
+		arena->intermediate_chars[i - VTPARSE_MAX_INTERMEDIATE_CHARS] = ch;
+	} else {
+		parser->error = 1;
+		return;
+	}
+	parser->num_intermediate_chars++;
+}
+
+/**
+ * Runs the recognizer for frequent control sequences on the bytes following
+ * the ESC at buf[0]. Returns the length of the recognized sequence including
+ * the ESC, or zero if the input does not start with one of the sequences or
+ * ends before the sequence is complete.
+ */
+static unsigned int vtparse_sequence_match(const unsigned char *buf,
+                                           unsigned int len, int *sequence) {
+	unsigned int i, state = 1;
+	for (i = 1; i < len; i++) {
+		state = SEQUENCE_DFA[state][SEQUENCE_CLASSES[buf[i]]];
+		if (!state) {
+			return 0;
+		}
+		if (SEQUENCE_ACCEPT[state]) {
+			*sequence = SEQUENCE_ACCEPT[state];
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Collects the parameters and intermediate characters of a sequence found by
+ * vtparse_sequence_match() the way the state machine would. Returns the
+ * dispatch action of the sequence.
+ */
+static vtparse_action_t vtparse_sequence_take(vtparse_t *parser,
+                                              const unsigned char *buf,
+                                              unsigned int len, int sequence) {
+	vtparse_action_t action = VTPARSE_ACTION_ESC_DISPATCH;
+	unsigned int i = 1;
+	unsigned char ch;
+
+	if (buf[1] == '[') {
+		action = VTPARSE_ACTION_CSI_DISPATCH;
+		i = 2;
+	}
+	parser->num_intermediate_chars = 0;
+	parser->num_params = 0;
+	parser->error = 0;
+	for (; i < len - 1; i++) {
+		ch = buf[i];
+		if ((ch >= '0' && ch <= '9') || ch == ';') {
+			vtparse_collect_param(parser, ch);
+		} else {
+			vtparse_collect(parser, ch);
+		}
+	}
+	parser->ch = buf[len - 1];
+	parser->sequence = sequence;
+	return action;
+}
+
+/**
+ * Returns true if the event that is currently returned to the user carries
+ * raw parameter bytes, i.e. is a VTPARSE_ACTION_CSI_DISPATCH or
+ * VTPARSE_ACTION_HOOK event.
+ */
+#define HAS_RAW_PARAMS(parser)                               \
+	(((parser)->action == VTPARSE_ACTION_CSI_DISPATCH) ||    \
+	 ((parser)->action == VTPARSE_ACTION_HOOK))
+
+/**
+ * Called whenever vtparse_parse() returns to the user. Raw parameter bytes
+ * must not outlive the input buffer; decode them unless they belong to the
+ * event being returned.
+ */
+static unsigned int vtparse_return(vtparse_t *parser, int n_read) {
+	if (parser->param_begin &&
+	    !(vtparse_has_event(parser) && HAS_RAW_PARAMS(parser))) {
+		vtparse_decode_params(parser);
+	}
+	return n_read;
+}
+
 /**
  * Decide whether to pass an action to the user or to handle it internally.
+ * "pos" points at the input byte following the current character.
  */
 static int vtparse_execute_action(vtparse_t *parser, vtparse_action_t action,
-                                  char ch) {
+                                  char ch, const unsigned char *pos) {
 	switch (action) {
 		case VTPARSE_ACTION_PRINT:
 		case VTPARSE_ACTION_PUT:
 		case VTPARSE_ACTION_OSC_PUT:
-			parser->data_end++;
-			parser->action = action;
-			return 0;
+			/* Runs of data are handled in vtparse_parse_loop(); this is only
+			   reached for data actions that custom dialects combine with a
+			   change of state. These are reported as a single byte. */
+			return 1;
 
 		case VTPARSE_ACTION_EXECUTE:
 		case VTPARSE_ACTION_HOOK:
@@ -86,43 +289,35 @@ static int vtparse_execute_action(vtparse_t *parser, vtparse_action_t action,
 
 		case VTPARSE_ACTION_COLLECT:
 			/* Append the character to the intermediate params */
-			if (parser->num_intermediate_chars + 1 >
-			    VTPARSE_MAX_INTERMEDIATE_CHARS) {
-				parser->error = 1;
-			} else {
-				parser->intermediate_chars[parser->num_intermediate_chars++] =
-				    ch;
-			}
+			vtparse_collect(parser, ch);
 			return 0;
 
 		case VTPARSE_ACTION_PARAM:
-			/* process the param character */
-			if (ch == ';') {
-				if (parser->num_params + 1 < VTPARSE_MAX_PARAMS) {
-					parser->num_params += 1;
-					parser->params[parser->num_params - 1] = 0;
-				} else {
-					parser->error = 1;
-				}
-			} else if (!parser->error) {
-				/* the character is a digit */
-				int current_param;
-
-				if (parser->num_params == 0) {
-					parser->num_params = 1;
-					parser->params[0] = 0;
+			/* Just record the location of the raw parameter bytes if lazy
+			   parameter decoding is active and the bytes are contiguous.
+			   Parameter actions are always executed in the same
+			   vtparse_parse() call that read the character. */
+			if ((parser->priv_.options & VTPARSE_OPTION_LAZY_PARAMS) &&
+			    parser->num_params == 0 && !parser->error) {
+				if (!parser->param_begin) {
+					parser->param_begin = pos - 1;
+					parser->param_end = pos;
+					return 0;
+				} else if (parser->param_end == pos - 1) {
+					parser->param_end = pos;
+					return 0;
 				}
-
-				current_param = parser->num_params - 1;
-				parser->params[current_param] *= 10;
-				parser->params[current_param] += (ch - '0');
+				vtparse_decode_params(parser);
 			}
+			vtparse_collect_param(parser, ch);
 			return 0;
 
 		case VTPARSE_ACTION_CLEAR:
 			parser->num_intermediate_chars = 0;
 			parser->num_params = 0;
 			parser->error = 0;
+			parser->param_begin = 0;
+			parser->param_end = 0;
 			return 0;
 
 		default:
@@ -132,20 +327,96 @@ static int vtparse_execute_action(vtparse_t *parser, vtparse_action_t action,
 	}
 }
 
-static int vtparse_handle_action(vtparse_t *parser, vtparse_action_t action) {
+/* Transitions inlined by vtparse_parse_loop(), generated from a transition
+   frequency profile by tables/vtparse_gen_hot_transitions.rb */
+#ifndef VTPARSE_NO_HOT_TRANSITIONS
+
+/**
+ * Switches to the given state after an inlined transition, the same way the
+ * VTPARSE_CYCLE_ENTRY_ACTION_DONE cycle does.
+ */
+static void vtparse_hot_enter(vtparse_t *parser, int state,
+                              const unsigned char *pos) {
+	parser->priv_.state = state;
+	if (parser->data_begin == parser->data_end) {
+		parser->action = (vtparse_action_t)0;
+		parser->data_begin = pos;
+		parser->data_end = pos;
+	}
+}
+
+#include <vtparse/vtparse_hot_transitions.h>
+#endif
+
+#ifdef VTPARSE_STRIDE2
+/**
+ * Performs pairs of transitions that do not return to the user with a single
+ * lookup in the stride-2 table per pair, starting at buf[n_read]. Returns the
+ * index of the first byte that was not consumed.
+ */
+static int vtparse_parse_stride2(vtparse_t *parser, const unsigned char *buf,
+                                 int n_read, unsigned int buf_len) {
+	vtparse_private_t *priv = &parser->priv_;
+	const unsigned char *entry, *op, *pos;
+	const int n_start = n_read;
+	unsigned int i;
+
+	while (n_read + 1 < (int)buf_len) {
+		entry = STRIDE2_OPS[STRIDE2_TABLE[priv->state - 1]
+		                                 [BYTE_CLASSES[buf[n_read]]]
+		                                 [BYTE_CLASSES[buf[n_read + 1]]]];
+		if (!entry[0]) {
+			break;
+		}
+		for (i = 0, op = entry + 2; i < entry[1]; i++, op++) {
+			pos = buf + n_read + ((*op >> 4) & 1U) + 1;
+			if (ACTION(*op)) {
+				vtparse_execute_action(parser, (vtparse_action_t)ACTION(*op), pos[-1], pos);
+			}
+			if ((*op & 0x20U) && parser->data_begin == parser->data_end) {
+				/* Same as VTPARSE_CYCLE_ENTRY_ACTION_DONE */
+				parser->action = (vtparse_action_t)0;
+				parser->data_begin = pos;
+				parser->data_end = pos;
+			}
+		}
+		priv->state = entry[0];
+		n_read += 2;
+	}
+	if (n_read > n_start) {
+		parser->ch = buf[n_read - 1];
+	}
+	return n_read;
+}
+#endif
+
+static int vtparse_handle_action(vtparse_t *parser, vtparse_action_t action,
+                                 const unsigned char *pos) {
 	vtparse_private_t *priv = &parser->priv_;
 	int must_return = 0;
 
-	if (action && vtparse_execute_action(parser, action, parser->ch)) {
+	if (action && vtparse_execute_action(parser, action, parser->ch, pos)) {
 		/* Before we can return the actual action, we need to return some
 		   previously buffered data */
 		if (parser->data_end - parser->data_begin) {
 			return 1; /* Need to return to the user */
 		}
 
-		/* Return this action to the user */
-		parser->action = action;
-		must_return = 1;
+		/* Return this action to the user if the user is interested in it */
+		if (priv->event_mask & VTPARSE_EVENT_MASK(action)) {
+			parser->action = action;
+			must_return = 1;
+			if (IS_DATA_ACTION(action)) {
+				/* The byte may belong to the previous input buffer */
+				parser->data_begin = (const unsigned char *)&parser->ch;
+				parser->data_end = parser->data_begin + 1;
+			}
+		} else if (action == VTPARSE_ACTION_CSI_DISPATCH ||
+		           action == VTPARSE_ACTION_HOOK) {
+			/* Nobody is interested in the raw parameters */
+			parser->param_begin = 0;
+			parser->param_end = 0;
+		}
 	}
 
 	/* Go to the next cycle */
@@ -154,106 +425,187 @@ static int vtparse_handle_action(vtparse_t *parser, vtparse_action_t action) {
 	return must_return;
 }
 
-/******************************************************************************
- * Public C API                                                               *
- ******************************************************************************/
-
-void vtparse_init(vtparse_t *parser) {
-	unsigned int i;
-
-	/* Reset all non-array fields */
-	parser->action = 0;
-	parser->ch = 0;
-	parser->num_params = 0;
-	parser->num_intermediate_chars = 0;
-	parser->error = 0;
-	parser->data_begin = 0;
-	parser->data_end = 0;
-
-	/* Reset all arrays */
-	for (i = 0; i < VTPARSE_MAX_PARAMS; i++) {
-		parser->params[i] = 0;
-	}
-	for (i = 0; i < VTPARSE_MAX_INTERMEDIATE_CHARS; i++) {
-		parser->intermediate_chars[i] = 0;
-	}
-
-	/* Reset the private data */
-	parser->priv_.change = 0;
-	parser->priv_.cycle = VTPARSE_CYCLE_READ_CHAR;
-	parser->priv_.state = VTPARSE_STATE_GROUND;
-}
-
-unsigned int vtparse_parse(vtparse_t *parser, const unsigned char *buf,
-                           unsigned int buf_len) {
-	/* Number of characters read from the input */
+/**
+ * Runs the state machine starting at buf[n_read]. This is the main part of
+ * vtparse_parse(); it is kept out of line so the small-input fast path in
+ * vtparse_parse() does not pay for its stack frame.
+ */
+static VTPARSE_NOINLINE unsigned int vtparse_parse_loop(
+    vtparse_t *parser, const unsigned char *buf, unsigned int buf_len,
+    int n_read) {
 	unsigned char ch;
 	vtparse_state_change_t change;
-	int n_read = 0;
 
 	/* Convenient reference at the private data */
 	vtparse_private_t *priv = &parser->priv_;
 
-	/* Reset the "data" pointers in the parser instance to indicate that we have
-	   not processed any characters so far. */
-	parser->data_begin = buf;
-	parser->data_end = buf;
+	/* Tables of the dialect; the specialized fast paths below only apply to
+	   the built-in dialect */
+	const vtparse_dialect_t *dialect = priv->dialect;
+	const vtparse_state_change_t *table =
+	    dialect ? dialect->state_table[0] : STATE_TABLE[0];
+	const vtparse_run_class_t *run_classes =
+	    dialect ? dialect->run_classes : RUN_CLASSES;
 
 	while (1) {
 		switch (priv->cycle) {
 			/* Read the next character from the input and determine whether the
 			   state changes. Abort if we are at the end of the input buffer. */
 			case VTPARSE_CYCLE_READ_CHAR: {
+				unsigned int seq_len;
+				int sequence;
+
+#ifdef VTPARSE_STRIDE2
+				/* Consume two bytes per lookup while possible; leave an ESC
+				   in the ground state to the sequence recognizer */
+				if (!dialect && (priv->state != VTPARSE_STATE_GROUND ||
+				                 !(priv->options & VTPARSE_OPTION_SEQUENCES))) {
+					n_read = vtparse_parse_stride2(parser, buf, n_read, buf_len);
+				}
+#endif
+
 				/* Return if we have reached the end of the buffer */
-				if (n_read >= buf_len) {
+				if (n_read >= (int)buf_len) {
 					/* Switch to a different state to indicate that we actually
 					   have data waiting for the user */
-					if (n_read && parser->action) {
+					if (parser->data_begin != parser->data_end) {
 						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
 					}
-					return n_read;
+					return vtparse_return(parser, n_read);
 				}
 
 				/* Read the next character */
 				parser->ch = ch = buf[n_read++];
 
 				/* Determine which state change is required */
-				priv->change = change = STATE_TABLE[priv->state - 1][ch];
+				priv->change = change = table[((priv->state - 1) << 8) + ch];
+
+				/* Match frequent control sequences as a whole */
+				if (ch == 0x1B && (priv->options & VTPARSE_OPTION_SEQUENCES) &&
+				    priv->state == VTPARSE_STATE_GROUND && !dialect &&
+				    (seq_len = vtparse_sequence_match(buf + n_read - 1,
+				                                      buf_len - n_read + 1,
+				                                      &sequence))) {
+					/* Return pending data first; the ESC is read again in
+					   the next call */
+					if (parser->data_begin != parser->data_end) {
+						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+						return vtparse_return(parser, n_read - 1);
+					}
+					n_read += seq_len - 1;
+					change = vtparse_sequence_take(
+					    parser, buf + n_read - seq_len, seq_len, sequence);
+					if (priv->event_mask & VTPARSE_EVENT_MASK(change)) {
+						parser->action = (vtparse_action_t)change;
+						parser->data_begin = buf + n_read;
+						parser->data_end = buf + n_read;
+						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+						return vtparse_return(parser, n_read);
+					}
+					parser->sequence = VTPARSE_SEQUENCE_NONE;
+					break;
+				}
+
+#ifndef VTPARSE_NO_HOT_TRANSITIONS
+				/* Frequent transitions that do not return to the user skip
+				   the action cycles */
+				if (!dialect && vtparse_hot_transition(parser, ch, buf + n_read)) {
+					break;
+				}
+#endif
+
 				if (STATE(change)) {
 					priv->cycle = VTPARSE_CYCLE_EXIT_ACTION;
-				} else if (ACTION(change)) {
-					/* Fast path for printing (improves performance for
-					 * VTPARSE_ACTION_PRINT) by about x2.5 */
-					if (ACTION(change) == VTPARSE_ACTION_PRINT) {
-						parser->action = VTPARSE_ACTION_PRINT;
-						parser->data_end++;
+				} else if (IS_DATA_ACTION(change) ||
+				           (change == VTPARSE_ACTION_EXECUTE &&
+				            (priv->options & VTPARSE_OPTION_LINE_SPANS) &&
+				            priv->state == VTPARSE_STATE_GROUND &&
+				            IS_LINE_CHAR(ch))) {
+					/* Fast path for actions producing data: consume the entire
+					   run of characters triggering the same action at once */
+					const unsigned char *run = buf + n_read - 1;
+					const vtparse_state_change_t *row =
+					    table + ((priv->state - 1) << 8);
+					int num_line_breaks = 0;
+
+					/* Data is returned as a contiguous range; return pending
+					   data first if the run does not directly follow it. The
+					   current character is read again in the next call. */
+					if (parser->data_begin != parser->data_end &&
+					    parser->data_end != run) {
+						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+						return vtparse_return(parser, n_read - 1);
+					}
+					if (priv->state == VTPARSE_STATE_GROUND &&
+					    (priv->options & VTPARSE_OPTION_LINE_SPANS)) {
+						/* Keep line breaks inside the printed range */
+						change = VTPARSE_ACTION_PRINT;
+						num_line_breaks = (ch == '\n');
+						n_read = vtparse_scan_line_span(row, buf, n_read, buf_len,
+						                                &num_line_breaks);
+					} else if (buf_len - n_read >= VTPARSE_SCAN_MIN_LEN &&
+					           row[buf[n_read]] == change &&
+					           priv->kernels->scan_ground &&
+					           run_classes[priv->state - 1].num_ranges) {
+						/* Long run; hand over to the vectorized scanner */
+						n_read = (priv->state == VTPARSE_STATE_GROUND
+						              ? priv->kernels->scan_ground
+						              : priv->kernels->scan_string)(
+						    &run_classes[priv->state - 1], buf, n_read, buf_len);
 					} else {
-						priv->cycle = VTPARSE_CYCLE_ACTION;
+						while (n_read < (int)buf_len && row[buf[n_read]] == change) {
+							n_read++;
+						}
 					}
+					parser->ch = buf[n_read - 1];
+
+					/* Skip the data if the user is not interested in it */
+					if (priv->event_mask & VTPARSE_EVENT_MASK(change)) {
+						if (parser->data_begin == parser->data_end) {
+							parser->data_begin = run;
+							parser->num_line_breaks = 0;
+						}
+						parser->data_end = buf + n_read;
+						parser->num_line_breaks += num_line_breaks;
+						parser->action = (vtparse_action_t)change;
+					}
+				} else if (ACTION(change)) {
+					priv->cycle = VTPARSE_CYCLE_ACTION;
 				}
 				break;
 			}
 
 			/* Execute the exit action for the last state the parser was in */
 			case VTPARSE_CYCLE_EXIT_ACTION:
-				if (vtparse_handle_action(parser,
-				                          EXIT_ACTIONS[priv->state - 1])) {
-					return n_read; /* Return to the user if necessary */
+				if (vtparse_handle_action(
+				        parser,
+				        (vtparse_action_t)(dialect ? dialect->exit_actions
+				                                   : EXIT_ACTIONS)[priv->state - 1],
+				        buf + n_read)) {
+					/* Return to the user if necessary */
+					return vtparse_return(parser, n_read);
 				}
 				break;
 
 			/* Execute the action associated with the character read above */
 			case VTPARSE_CYCLE_ACTION:
-				if (vtparse_handle_action(parser, ACTION(priv->change))) {
-					return n_read; /* Return to the user if necessary */
+				if (vtparse_handle_action(parser,
+				                          (vtparse_action_t)ACTION(priv->change),
+				                          buf + n_read)) {
+					/* Return to the user if necessary */
+					return vtparse_return(parser, n_read);
 				}
 				break;
 
 			/* Execute the entry action if there was a state change */
 			case VTPARSE_CYCLE_ENTRY_ACTION:
 				if (vtparse_handle_action(
-				        parser, ENTRY_ACTIONS[STATE(priv->change) - 1])) {
-					return n_read; /* Return to the user if necessary */
+				        parser,
+				        (vtparse_action_t)(dialect ? dialect->entry_actions
+				                                   : ENTRY_ACTIONS)[STATE(priv->change) - 1],
+				        buf + n_read)) {
+					/* Return to the user if necessary */
+					return vtparse_return(parser, n_read);
 				}
 				break;
 
@@ -265,7 +617,7 @@ unsigned int vtparse_parse(vtparse_t *parser, const unsigned char *buf,
 				/* Set data_begin/data_end if there is no data waiting. This is
 				   relevant when recovering from error conditions. */
 				if (parser->data_begin == parser->data_end) {
-					parser->action = 0;
+					parser->action = (vtparse_action_t)0;
 					parser->data_begin = buf + n_read;
 					parser->data_end = buf + n_read;
 				}
@@ -281,14 +633,389 @@ unsigned int vtparse_parse(vtparse_t *parser, const unsigned char *buf,
 	return n_read;
 }
 
-int vtparse_has_event(const vtparse_t *parser) {
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API void vtparse_init(vtparse_t *parser) {
+	unsigned int i;
+
+	/* Reset all non-array fields */
+	parser->action = (vtparse_action_t)0;
+	parser->ch = 0;
+	parser->num_params = 0;
+	parser->num_intermediate_chars = 0;
+	parser->error = 0;
+	parser->sequence = VTPARSE_SEQUENCE_NONE;
+	parser->data_begin = 0;
+	parser->data_end = 0;
+	parser->num_line_breaks = 0;
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Reset all arrays */
+	for (i = 0; i < VTPARSE_MAX_PARAMS; i++) {
+		parser->params[i] = 0;
+	}
+	for (i = 0; i < VTPARSE_MAX_INTERMEDIATE_CHARS; i++) {
+		parser->intermediate_chars[i] = 0;
+	}
+
+	/* Reset the private data */
+	parser->priv_.event_mask = VTPARSE_EVENT_MASK_ALL;
+	parser->priv_.options = 0;
+	parser->priv_.arena = 0;
+	parser->priv_.kernels = vtparse_get_kernels();
+	parser->priv_.dialect = 0;
+	parser->priv_.max_bytes = VTPARSE_BUDGET_UNLIMITED;
+	parser->priv_.max_events = VTPARSE_BUDGET_UNLIMITED;
+	parser->priv_.used_bytes = 0;
+	parser->priv_.used_events = 0;
+	parser->priv_.change = 0;
+	parser->priv_.cycle = VTPARSE_CYCLE_READ_CHAR;
+	parser->priv_.state = VTPARSE_STATE_GROUND;
+}
+
+static VTPARSE_ALWAYS_INLINE unsigned int vtparse_parse_unbounded(
+    vtparse_t *parser, const unsigned char *buf, unsigned int buf_len) {
+	/* Number of characters read from the input */
+	int n_read = 0;
+
+	/* Convenient reference at the private data */
+	vtparse_private_t *priv = &parser->priv_;
+
+	/* Reset the "data" pointers in the parser instance to indicate that we have
+	   not processed any characters so far. */
+	parser->data_begin = buf;
+	parser->data_end = buf;
+
+	/* Raw parameter bytes are only valid until the next call */
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Only set by the sequence recognizer for the event it returns */
+	parser->sequence = VTPARSE_SEQUENCE_NONE;
+
+	/* Skip the round trip through the state machine loop after data was
+	   returned in the last call */
+	if (priv->cycle == VTPARSE_CYCLE_READ_CHAR_DONE) {
+		priv->cycle = VTPARSE_CYCLE_READ_CHAR;
+	}
+
+	/* Fast path for tiny inputs, such as echoed keystrokes: consume leading
+	   printable characters in the ground state without entering the loop. If
+	   the entire buffer is printable, return right away. */
+	if (buf_len <= VTPARSE_SMALL_INPUT_LEN &&
+	    priv->cycle == VTPARSE_CYCLE_READ_CHAR &&
+	    priv->state == VTPARSE_STATE_GROUND) {
+		const vtparse_state_change_t *row =
+		    priv->dialect ? priv->dialect->state_table[VTPARSE_STATE_GROUND - 1]
+		                  : STATE_TABLE[VTPARSE_STATE_GROUND - 1];
+		while (n_read < (int)buf_len && row[buf[n_read]] == VTPARSE_ACTION_PRINT) {
+			n_read++;
+		}
+		if (n_read > 0) {
+			parser->ch = buf[n_read - 1];
+			if (priv->event_mask & VTPARSE_EVENT_MASK(VTPARSE_ACTION_PRINT)) {
+				parser->action = VTPARSE_ACTION_PRINT;
+				parser->data_end = buf + n_read;
+				parser->num_line_breaks = 0;
+			}
+		}
+		if (n_read == (int)buf_len) {
+			if (parser->data_begin != parser->data_end) {
+				priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+			}
+			return n_read;
+		}
+
+		/* Likewise, directly return a leading control character (e.g. a
+		   backspace or line feed) that is executed in the ground state */
+		if (n_read == 0 &&
+		    row[buf[0]] == VTPARSE_ACTION_EXECUTE && !parser->error &&
+		    (priv->event_mask & VTPARSE_EVENT_MASK(VTPARSE_ACTION_EXECUTE)) &&
+		    !((priv->options & VTPARSE_OPTION_LINE_SPANS) &&
+		      IS_LINE_CHAR(buf[0]))) {
+			parser->ch = buf[0];
+			parser->action = VTPARSE_ACTION_EXECUTE;
+			priv->change = VTPARSE_ACTION_EXECUTE;
+			priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+			return 1U;
+		}
+	}
+
+	return vtparse_parse_loop(parser, buf, buf_len, n_read);
+}
+
+static VTPARSE_NOINLINE unsigned int vtparse_parse_bounded(
+    vtparse_t *parser, const unsigned char *buf, unsigned int buf_len) {
+	unsigned int n_read;
+	vtparse_private_t *priv = &parser->priv_;
+
+	/* Only hand the remaining number of bytes to the parser; once the event
+	   budget is exhausted, only drain the events pending for bytes that have
+	   already been consumed */
+	if (priv->max_bytes && buf_len > priv->max_bytes - priv->used_bytes) {
+		buf_len = priv->max_bytes - priv->used_bytes;
+	}
+	if (priv->max_events && priv->used_events >= priv->max_events) {
+		buf_len = 0;
+	}
+
+	n_read = vtparse_parse_unbounded(parser, buf, buf_len);
+	priv->used_bytes += n_read;
+	if (vtparse_has_event(parser)) {
+		priv->used_events++;
+	}
+	return n_read;
+}
+
+VTPARSE_API unsigned int vtparse_parse(vtparse_t *parser,
+                                       const unsigned char *buf,
+                                       unsigned int buf_len) {
+	if (parser->priv_.max_bytes | parser->priv_.max_events) {
+		return vtparse_parse_bounded(parser, buf, buf_len);
+	}
+	return vtparse_parse_unbounded(parser, buf, buf_len);
+}
+
+VTPARSE_API void vtparse_set_event_mask(vtparse_t *parser,
+                                        unsigned int event_mask) {
+	parser->priv_.event_mask = event_mask;
+}
+
+VTPARSE_API void vtparse_set_options(vtparse_t *parser, unsigned int options) {
+	parser->priv_.options = options;
+}
+
+VTPARSE_API void vtparse_set_arena(vtparse_t *parser,
+                                   const vtparse_arena_t *arena) {
+	parser->priv_.arena = arena;
+}
+
+VTPARSE_API void vtparse_set_dialect(vtparse_t *parser,
+                                     const vtparse_dialect_t *dialect) {
+	parser->priv_.dialect = dialect;
+}
+
+VTPARSE_API void vtparse_set_budget(vtparse_t *parser, unsigned int max_bytes,
+                                    unsigned int max_events) {
+	parser->priv_.max_bytes = max_bytes;
+	parser->priv_.max_events = max_events;
+	parser->priv_.used_bytes = 0;
+	parser->priv_.used_events = 0;
+}
+
+VTPARSE_API void vtparse_renew_budget(vtparse_t *parser) {
+	parser->priv_.used_bytes = 0;
+	parser->priv_.used_events = 0;
+}
+
+VTPARSE_API void vtparse_get_budget_used(const vtparse_t *parser,
+                                         unsigned int *bytes,
+                                         unsigned int *events) {
+	if (bytes) {
+		*bytes = parser->priv_.used_bytes;
+	}
+	if (events) {
+		*events = parser->priv_.used_events;
+	}
+}
+
+VTPARSE_API int vtparse_budget_exhausted(const vtparse_t *parser) {
+	const vtparse_private_t *priv = &parser->priv_;
+	return (priv->max_bytes && priv->used_bytes >= priv->max_bytes) ||
+	       (priv->max_events && priv->used_events >= priv->max_events);
+}
+
+VTPARSE_API int vtparse_get_param(const vtparse_t *parser, unsigned int i) {
+	if (i >= (unsigned int)parser->num_params) {
+		return 0;
+	} else if (i < VTPARSE_MAX_PARAMS) {
+		return parser->params[i];
+	}
+	return parser->priv_.arena->params[i - VTPARSE_MAX_PARAMS];
+}
+
+VTPARSE_API unsigned char vtparse_get_intermediate_char(const vtparse_t *parser,
+                                                       unsigned int i) {
+	if (i >= (unsigned int)parser->num_intermediate_chars) {
+		return 0;
+	} else if (i < VTPARSE_MAX_INTERMEDIATE_CHARS) {
+		return parser->intermediate_chars[i];
+	}
+	return parser->priv_.arena
+	    ->intermediate_chars[i - VTPARSE_MAX_INTERMEDIATE_CHARS];
+}
+
+VTPARSE_API void vtparse_decode_params(vtparse_t *parser) {
+	const unsigned char *p = parser->param_begin, *end = parser->param_end;
+	const vtparse_kernels_t *kernels = parser->priv_.kernels;
+	int n;
+
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Use the accelerated decoder for the common case of a short parameter
+	   list; fall back to the generic code if it spills into the arena */
+	if (kernels->decode_params && p < end && parser->num_params == 0 &&
+	    !parser->error) {
+		if ((n = kernels->decode_params(parser->params, p, end)) >= 0) {
+			parser->num_params = n;
+			return;
+		}
+	}
+	for (; p < end; p++) {
+		vtparse_collect_param(parser, *p);
+	}
+}
+
+VTPARSE_API int vtparse_has_event(const vtparse_t *parser) {
 	return parser->priv_.cycle != VTPARSE_CYCLE_READ_CHAR;
 }
 
-const char *vtparse_action_str(vtparse_action_t action) {
+VTPARSE_API void vtparse_compact_init(vtparse_compact_t *compact) {
+	unsigned int i;
+
+	compact->state = VTPARSE_STATE_GROUND;
+	compact->error = 0;
+	compact->num_params = 0;
+	compact->num_intermediate_chars = 0;
+	for (i = 0; i < VTPARSE_COMPACT_MAX_PARAMS; i++) {
+		compact->params[i] = 0;
+	}
+	for (i = 0; i < VTPARSE_MAX_INTERMEDIATE_CHARS; i++) {
+		compact->intermediate_chars[i] = 0;
+	}
+}
+
+VTPARSE_API int vtparse_suspend(const vtparse_t *parser,
+                                vtparse_compact_t *compact) {
+	return vtparse_suspend_spill(parser, compact, 0, 0U);
+}
+
+VTPARSE_API int vtparse_suspend_spill(const vtparse_t *parser,
+                                      vtparse_compact_t *compact,
+                                      unsigned short *spill,
+                                      unsigned int max_spill) {
+	int i, param;
+
+	/* We cannot store pending events */
+	if (vtparse_has_event(parser)) {
+		return 0;
+	}
+
+	/* Parameters and intermediate characters are only relevant while the
+	   state machine is not in the ground state; they are cleared upon entering
+	   one of the states collecting them. */
+	vtparse_compact_init(compact);
+	compact->state = parser->priv_.state;
+	if (compact->state == VTPARSE_STATE_GROUND) {
+		return 1;
+	}
+
+	/* Store the first parameters in the compact state and the remaining ones
+	   in the spill storage. Sequences that do not fit are dropped. */
+	compact->error = parser->error ? 1 : 0;
+	if (parser->num_params >
+	    (int)(VTPARSE_COMPACT_MAX_PARAMS + max_spill) ||
+	    parser->num_params > 0xFF) {
+		compact->error = 1;
+	} else {
+		for (i = 0; i < parser->num_params; i++) {
+			param = vtparse_get_param(parser, i);
+			if (param < 0 || param > 0xFFFF) {
+				compact->error = 1;
+				break;
+			} else if (i < (int)VTPARSE_COMPACT_MAX_PARAMS) {
+				compact->params[i] = param;
+			} else {
+				spill[i - VTPARSE_COMPACT_MAX_PARAMS] = param;
+			}
+		}
+		compact->num_params = compact->error ? 0 : parser->num_params;
+	}
+	if (parser->num_intermediate_chars >
+	    (int)VTPARSE_MAX_INTERMEDIATE_CHARS) {
+		compact->error = 1;
+	} else {
+		compact->num_intermediate_chars = parser->num_intermediate_chars;
+		for (i = 0; i < parser->num_intermediate_chars; i++) {
+			compact->intermediate_chars[i] = parser->intermediate_chars[i];
+		}
+	}
+	return 1;
+}
+
+VTPARSE_API void vtparse_resume(vtparse_t *parser,
+                                const vtparse_compact_t *compact) {
+	vtparse_resume_spill(parser, compact, 0);
+}
+
+VTPARSE_API void vtparse_resume_spill(vtparse_t *parser,
+                                      const vtparse_compact_t *compact,
+                                      const unsigned short *spill) {
+	const vtparse_arena_t *arena = parser->priv_.arena;
+	const int max_params =
+	    VTPARSE_MAX_PARAMS + (arena ? arena->max_params : 0U);
+	int i;
+
+	/* Reset the transient per-call fields */
+	parser->action = (vtparse_action_t)0;
+	parser->ch = 0;
+	parser->sequence = VTPARSE_SEQUENCE_NONE;
+	parser->data_begin = 0;
+	parser->data_end = 0;
+	parser->num_line_breaks = 0;
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Restore the partially parsed control sequence */
+	parser->error = compact->error;
+	parser->num_params = compact->num_params;
+	if (parser->num_params > max_params ||
+	    (parser->num_params > (int)VTPARSE_COMPACT_MAX_PARAMS && !spill)) {
+		parser->error = 1;
+		parser->num_params = 0;
+	}
+	for (i = 0; i < parser->num_params; i++) {
+		if (i < (int)VTPARSE_COMPACT_MAX_PARAMS) {
+			*vtparse_param_ptr(parser, i) = compact->params[i];
+		} else {
+			*vtparse_param_ptr(parser, i) =
+			    spill[i - VTPARSE_COMPACT_MAX_PARAMS];
+		}
+	}
+	parser->num_intermediate_chars = compact->num_intermediate_chars;
+	for (i = 0; i < compact->num_intermediate_chars; i++) {
+		parser->intermediate_chars[i] = compact->intermediate_chars[i];
+	}
+	parser->intermediate_chars[compact->num_intermediate_chars] = 0;
+
+	/* Restore the state machine */
+	parser->priv_.change = 0;
+	parser->priv_.cycle = VTPARSE_CYCLE_READ_CHAR;
+	parser->priv_.state = compact->state;
+}
+
+VTPARSE_API const char *vtparse_action_str(vtparse_action_t action) {
 	if (action > VTPARSE_ACTION_ERROR) {
 		return "<invalid>";
 	}
 	return ACTION_NAMES[action];
 }
 
+VTPARSE_API const char *vtparse_state_str(int state) {
+	if (state < 0 || state > VTPARSE_NUM_STATES) {
+		return "<invalid>";
+	}
+	return STATE_NAMES[state];
+}
+
+VTPARSE_API const char *vtparse_sequence_str(int sequence) {
+	if (sequence < 0 ||
+	    sequence >= (int)(sizeof(SEQUENCE_NAMES) / sizeof(SEQUENCE_NAMES[0]))) {
+		return "<invalid>";
+	}
+	return SEQUENCE_NAMES[sequence];
+}
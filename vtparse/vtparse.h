@@ -26,10 +26,21 @@
 #ifndef VTPARSE_VTPARSE_H
 #define VTPARSE_VTPARSE_H
 
+#include <vtparse/vtparse_sequence_table.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * Linkage of the public functions. This is empty for the regular library
+ * build; vtparse_amalgamated.h defines it as "static inline" such that the
+ * parser can be inlined into the calling code.
+ */
+#ifndef VTPARSE_API
+#define VTPARSE_API
+#endif
+
 /**
  * Maximum number of characters belonging to a control sequence apart from the
  * parameters.
@@ -41,6 +52,19 @@ extern "C" {
  */
 #define VTPARSE_MAX_PARAMS 16U
 
+/**
+ * Number of parameters of a partially parsed control sequence that are stored
+ * in a vtparse_compact_t instance itself. Further parameters are written to
+ * caller-owned spill storage, see vtparse_suspend_spill().
+ */
+#define VTPARSE_COMPACT_MAX_PARAMS 4U
+
+/**
+ * Size of the spill storage required to suspend any control sequence accepted
+ * by a vtparse_t instance without an arena.
+ */
+#define VTPARSE_COMPACT_MAX_SPILL (VTPARSE_MAX_PARAMS - VTPARSE_COMPACT_MAX_PARAMS)
+
 typedef enum {
 	VTPARSE_ACTION_CLEAR = 1,
 	VTPARSE_ACTION_COLLECT = 2,
@@ -59,6 +83,140 @@ typedef enum {
 	VTPARSE_ACTION_ERROR = 15,
 } vtparse_action_t;
 
+/**
+ * Returns the bit corresponding to the given action in the event mask passed
+ * to vtparse_set_event_mask().
+ */
+#define VTPARSE_EVENT_MASK(action) (1U << (action))
+
+/**
+ * Event mask selecting all events. This is the default.
+ */
+#define VTPARSE_EVENT_MASK_ALL 0xFFFFU
+
+/**
+ * Option flag for vtparse_set_options(). If set, line feeds, carriage returns
+ * and tabs in the ground state are not reported as VTPARSE_ACTION_EXECUTE, but
+ * are included in the VTPARSE_ACTION_PRINT data range instead. The number of
+ * line feeds in the range is stored in vtparse_t.num_line_breaks.
+ */
+#define VTPARSE_OPTION_LINE_SPANS 0x01U
+
+/**
+ * Option flag for vtparse_set_options(). If set, the parameters of control
+ * sequences are not decoded while parsing. Instead, param_begin and param_end
+ * point at the raw parameter bytes in the input buffer when a
+ * VTPARSE_ACTION_CSI_DISPATCH or VTPARSE_ACTION_HOOK event is returned. Call
+ * vtparse_decode_params() to fill the params array. Sequences whose parameter
+ * bytes are not contiguous, that straddle input buffers or that are preceded
+ * by pending data are decoded eagerly (param_begin is NULL in this case).
+ */
+#define VTPARSE_OPTION_LAZY_PARAMS 0x02U
+
+/**
+ * Option flag for vtparse_set_options(). If set, the most frequent control
+ * sequences (listed in tables/vtparse_sequences.txt, e.g. ESC[0m or
+ * ESC[<n>;<n>H) are matched as a whole by a precompiled recognizer directly
+ * after an ESC in the ground state, instead of being run through the state
+ * machine byte by byte. The resulting events are the same, but the "sequence"
+ * field of vtparse_t identifies the recognized sequence. Sequences that are
+ * not in the list or that straddle input buffers take the regular path and
+ * have their "sequence" field set to VTPARSE_SEQUENCE_NONE.
+ */
+#define VTPARSE_OPTION_SEQUENCES 0x04U
+
+/**
+ * Budget value for vtparse_set_budget() that disables the corresponding limit.
+ */
+#define VTPARSE_BUDGET_UNLIMITED 0U
+
+/**
+ * Instruction sets for vtparse_set_isa(). The SSE2, AVX2 and AVX-512 kernels
+ * are only available on x86-64 when compiling with GCC or clang.
+ */
+#define VTPARSE_ISA_AUTO 0
+#define VTPARSE_ISA_SCALAR 1
+#define VTPARSE_ISA_SSE2 2
+#define VTPARSE_ISA_AVX2 3
+#define VTPARSE_ISA_AVX512 4
+
+/**
+ * Compact, self-contained event record. Used by the pipeline module and by
+ * vtparse_parse_streams() to queue events for later consumption.
+ */
+typedef struct vtparse_event {
+	/**
+	 * Data span for the PRINT, PUT and OSC_PUT actions; points into the input
+	 * buffer. NULL for all other actions.
+	 */
+	unsigned char const *data;
+
+	/**
+	 * Number of bytes in the data span.
+	 */
+	unsigned int data_len;
+
+	/**
+	 * The action, see vtparse_action_t.
+	 */
+	unsigned char action;
+
+	/**
+	 * Final character of the control sequence, if any.
+	 */
+	unsigned char ch;
+
+	/**
+	 * Number of parameters and intermediate characters.
+	 */
+	unsigned char num_params;
+	unsigned char num_intermediate_chars;
+	unsigned char intermediate_chars[VTPARSE_MAX_INTERMEDIATE_CHARS];
+
+	/**
+	 * Copy of vtparse_t.error.
+	 */
+	unsigned char error;
+
+	/**
+	 * Reserved for internal use.
+	 */
+	unsigned char flags_;
+
+	/**
+	 * Parameters, clamped to 65535. Only the first VTPARSE_MAX_PARAMS
+	 * parameters are recorded.
+	 */
+	unsigned short params[VTPARSE_MAX_PARAMS];
+} vtparse_event_t;
+
+/**
+ * Caller-supplied storage for parameters and intermediate characters that do
+ * not fit into the arrays in vtparse_t. See vtparse_set_arena().
+ */
+typedef struct vtparse_arena {
+	/**
+	 * Storage for the parameters with index VTPARSE_MAX_PARAMS and above.
+	 */
+	int *params;
+
+	/**
+	 * Number of elements in the "params" array.
+	 */
+	unsigned int max_params;
+
+	/**
+	 * Storage for the intermediate characters with index
+	 * VTPARSE_MAX_INTERMEDIATE_CHARS and above.
+	 */
+	unsigned char *intermediate_chars;
+
+	/**
+	 * Number of elements in the "intermediate_chars" array.
+	 */
+	unsigned int max_intermediate_chars;
+} vtparse_arena_t;
+
 /**
  * Data used internally by vtparse. You should not modify the member variables
  * in this structure.
@@ -67,9 +225,18 @@ typedef struct vtparse_private {
 	int state;
 	int cycle;
 	unsigned char change;
+	unsigned int event_mask;
+	unsigned int options;
+	const vtparse_arena_t *arena;
+	const struct vtparse_kernels *kernels;
+	const struct vtparse_dialect *dialect;
+	unsigned int max_bytes;
+	unsigned int max_events;
+	unsigned int used_bytes;
+	unsigned int used_events;
 } vtparse_private_t;
 
-typedef struct vtparse {
+typedef struct vtparse_parser {
 	/**
 	 * Action defined by the control sequence or VTPARSE_ACTION_PRINT if the
 	 * given data is just text.
@@ -82,12 +249,16 @@ typedef struct vtparse {
 	char ch;
 
 	/**
-	 * Number of parameters stored in the "params" array.
+	 * Number of parameters stored in the "params" array. May be larger than
+	 * VTPARSE_MAX_PARAMS if an arena is set; use vtparse_get_param() in this
+	 * case.
 	 */
 	int num_params;
 
 	/**
-	 * Number of "intermediate" characters.
+	 * Number of "intermediate" characters. May be larger than
+	 * VTPARSE_MAX_INTERMEDIATE_CHARS if an arena is set; use
+	 * vtparse_get_intermediate_char() in this case.
 	 */
 	int num_intermediate_chars;
 
@@ -97,6 +268,13 @@ typedef struct vtparse {
 	 */
 	int error;
 
+	/**
+	 * Sequence recognized by the VTPARSE_OPTION_SEQUENCES option for the
+	 * current VTPARSE_ACTION_CSI_DISPATCH or VTPARSE_ACTION_ESC_DISPATCH event,
+	 * see vtparse_sequence_t. VTPARSE_SEQUENCE_NONE for all other events.
+	 */
+	int sequence;
+
 	/**
 	 * Pointer at the first byte that should be printed or put.
 	 */
@@ -107,6 +285,25 @@ typedef struct vtparse {
 	 */
 	unsigned char const *data_end;
 
+	/**
+	 * Number of line feeds between data_begin and data_end. Only non-zero if
+	 * the VTPARSE_OPTION_LINE_SPANS option is set.
+	 */
+	int num_line_breaks;
+
+	/**
+	 * Pointer at the first raw parameter byte of the current control
+	 * sequence if the VTPARSE_OPTION_LAZY_PARAMS option is set and the
+	 * parameters have not been decoded yet, NULL otherwise. Only valid until
+	 * the next call to vtparse_parse().
+	 */
+	unsigned char const *param_begin;
+
+	/**
+	 * Pointer one past the last raw parameter byte.
+	 */
+	unsigned char const *param_end;
+
 	/**
 	 * Parameters associated with the current CSI sequence.
 	 */
@@ -124,12 +321,77 @@ typedef struct vtparse {
 	vtparse_private_t priv_;
 } vtparse_t;
 
+/**
+ * Compact representation of the persistent parser state. In contrast to
+ * vtparse_t, which is rather large, this structure only occupies a few bytes
+ * and is meant to be kept per session when a large number of mostly idle
+ * streams must be parsed. Use vtparse_suspend() to store a parser in this
+ * structure and vtparse_resume() to materialize a (e.g. per-thread) vtparse_t
+ * instance from it before feeding new data into the parser.
+ */
+typedef struct vtparse_compact {
+	/**
+	 * First parameters of a partially parsed control sequence, including the
+	 * one currently being accumulated. Limited to 16 bit.
+	 */
+	unsigned short params[VTPARSE_COMPACT_MAX_PARAMS];
+
+	/**
+	 * State the state machine is currently in.
+	 */
+	unsigned char state;
+
+	/**
+	 * Non-zero if the partially parsed control sequence is erroneous or could
+	 * not be represented in this structure.
+	 */
+	unsigned char error;
+
+	/**
+	 * Number of parameters of the partially parsed control sequence. Parameters
+	 * beyond VTPARSE_COMPACT_MAX_PARAMS are stored in the spill storage.
+	 */
+	unsigned char num_params;
+
+	/**
+	 * Number of "intermediate" characters.
+	 */
+	unsigned char num_intermediate_chars;
+
+	/**
+	 * Intermediate characters of a partially parsed control sequence.
+	 */
+	unsigned char intermediate_chars[VTPARSE_MAX_INTERMEDIATE_CHARS];
+} vtparse_compact_t;
+
+/**
+ * Selects the instruction set used by the accelerated ground-state and string
+ * scanners and the parameter decoder for all parser instances initialized
+ * afterwards. By default, the widest instruction set supported by the CPU is
+ * selected when the first parser is initialized; the VTPARSE_FORCE_ISA
+ * environment variable ("scalar", "sse2", "avx2" or "avx512") overrides this
+ * choice. Parsers may be initialized on several threads at once; a parser
+ * initialized concurrently with this call may still use the previous
+ * selection.
+ *
+ * @param isa is one of the VTPARSE_ISA_* constants. VTPARSE_ISA_AUTO restores
+ * the default.
+ * @return the instruction set that is actually used, which may be narrower
+ * than the requested one if the latter is not supported.
+ */
+VTPARSE_API int vtparse_set_isa(int isa);
+
+/**
+ * Returns the instruction set selected by vtparse_set_isa().
+ */
+VTPARSE_API int vtparse_get_isa(void);
+
 /**
  * Resets the given parser instance to its initial state.
  *
  * @param parser is a pointer at the vtparse_t instance that should be reset.
  */
-void vtparse_init(vtparse_t *parser);
+VTPARSE_API void vtparse_init(vtparse_t *parser);
 
 /**
  * Parses the given byte sequence buffer. This function either returns when the
@@ -151,20 +413,248 @@ void vtparse_init(vtparse_t *parser);
  * vtparse_parse() with a zero-length input buffer to obtain any remaining
  * events.
  */
-unsigned int vtparse_parse(vtparse_t *parser, const unsigned char *buf,
-                           unsigned int buf_len);
+VTPARSE_API unsigned int vtparse_parse(vtparse_t *parser,
+                                       const unsigned char *buf,
+                                       unsigned int buf_len);
+
+/**
+ * Selects the events vtparse_parse() returns to the caller. Actions that are
+ * not part of the mask are consumed internally; data belonging to masked
+ * VTPARSE_ACTION_PRINT, VTPARSE_ACTION_PUT or VTPARSE_ACTION_OSC_PUT actions is
+ * skipped without being returned. The mask is retained by vtparse_resume(),
+ * but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param event_mask is a bitwise combination of VTPARSE_EVENT_MASK(action)
+ * for all actions that should be returned, e.g.
+ * VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_START) |
+ * VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_PUT) |
+ * VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_END).
+ */
+VTPARSE_API void vtparse_set_event_mask(vtparse_t *parser,
+                                        unsigned int event_mask);
+
+/**
+ * Sets the options of the given parser instance. The options are retained by
+ * vtparse_resume(), but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param options is a bitwise combination of VTPARSE_OPTION_* flags, e.g.
+ * VTPARSE_OPTION_LINE_SPANS.
+ */
+VTPARSE_API void vtparse_set_options(vtparse_t *parser, unsigned int options);
+
+/**
+ * Sets the arena parameters and intermediate characters spill into once the
+ * arrays in vtparse_t are full. The total number of parameters and
+ * intermediate characters is capped at the size of the arrays in vtparse_t
+ * plus the size of the arena; longer sequences are ignored. No memory is
+ * allocated by vtparse. The arena is retained by vtparse_resume(), but reset
+ * by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param arena points at the arena descriptor, which must remain valid as
+ * long as it is used by the parser. NULL disables the arena.
+ */
+VTPARSE_API void vtparse_set_arena(vtparse_t *parser,
+                                   const vtparse_arena_t *arena);
+
+/**
+ * Selects the dialect, i.e. the state transition tables, used by the given
+ * parser instance. Dialects are built at runtime with the functions in
+ * vtparse_dialect.h. The parser only stores a pointer at the dialect; the
+ * tables are looked up once per call to vtparse_parse(), such that a custom
+ * dialect does not add any work per input byte. However, the transitions
+ * inlined from the traffic profile, the stride-2 engine and the recognizer
+ * enabled by VTPARSE_OPTION_SEQUENCES are specialized for the built-in
+ * dialect and are not used with a custom dialect. The dialect is retained by
+ * vtparse_resume(), but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param dialect points at the dialect, which must remain valid and must not
+ * be modified as long as it is used by the parser. NULL selects the built-in
+ * dialect.
+ */
+VTPARSE_API void vtparse_set_dialect(vtparse_t *parser,
+                                     const struct vtparse_dialect *dialect);
+
+/**
+ * Limits the amount of work vtparse_parse() performs until the next call to
+ * vtparse_set_budget(). Once the budget is exhausted, vtparse_parse() does not
+ * consume any further input bytes; it only returns the events still pending
+ * for bytes that were already consumed and then reports that there is no
+ * event, even though the buffer was not fully consumed. The parser is at a
+ * resumable point at this stage: call vtparse_set_budget() again (e.g. when
+ * the session is scheduled the next time) and continue with the unconsumed
+ * part of the buffer. This allows a single-threaded event loop to round-robin
+ * many sessions without one of them monopolizing the loop. The budget is
+ * retained by vtparse_resume(), but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param max_bytes is the maximum number of input bytes to consume or
+ * VTPARSE_BUDGET_UNLIMITED.
+ * @param max_events is the maximum number of events to return or
+ * VTPARSE_BUDGET_UNLIMITED. May be exceeded by the events triggered by the
+ * last consumed byte (at most three, e.g. an exit, a transition and an entry
+ * action).
+ */
+VTPARSE_API void vtparse_set_budget(vtparse_t *parser, unsigned int max_bytes,
+                                    unsigned int max_events);
+
+/**
+ * Grants the same budget as the last call to vtparse_set_budget() again by
+ * resetting the counters reported by vtparse_get_budget_used(). Use this when
+ * a session is scheduled the next time.
+ *
+ * @param parser is the vtparse_t instance whose budget should be renewed.
+ */
+VTPARSE_API void vtparse_renew_budget(vtparse_t *parser);
+
+/**
+ * Reports the work performed by vtparse_parse() since the last call to
+ * vtparse_set_budget() or vtparse_renew_budget(). Counting only takes place
+ * while a budget is set.
+ *
+ * @param parser is the vtparse_t instance that should be queried.
+ * @param bytes if not NULL, receives the number of consumed input bytes.
+ * @param events if not NULL, receives the number of returned events.
+ */
+VTPARSE_API void vtparse_get_budget_used(const vtparse_t *parser,
+                                         unsigned int *bytes,
+                                         unsigned int *events);
+
+/**
+ * Returns true if the budget set with vtparse_set_budget() is exhausted, i.e.
+ * vtparse_parse() will not consume any further input bytes.
+ */
+VTPARSE_API int vtparse_budget_exhausted(const vtparse_t *parser);
+
+/**
+ * Returns the i-th parameter of the current control sequence, regardless of
+ * whether it is stored in vtparse_t or in the arena. Returns zero if i is
+ * out of range.
+ */
+VTPARSE_API int vtparse_get_param(const vtparse_t *parser, unsigned int i);
+
+/**
+ * Returns the i-th intermediate character of the current control sequence,
+ * regardless of whether it is stored in vtparse_t or in the arena. Returns
+ * zero if i is out of range.
+ */
+VTPARSE_API unsigned char vtparse_get_intermediate_char(const vtparse_t *parser,
+                                                       unsigned int i);
+
+/**
+ * Decodes the raw parameter bytes referenced by param_begin and param_end into
+ * the params array and updates num_params accordingly. Sets the error flag if
+ * there are more than VTPARSE_MAX_PARAMS parameters. Does nothing if the
+ * parameters already were decoded. Must be called before the next call to
+ * vtparse_parse().
+ *
+ * @param parser is the vtparse_t instance holding the event.
+ */
+VTPARSE_API void vtparse_decode_params(vtparse_t *parser);
 
 /**
  * Returns true if the given vtparse_t instance currently holds information
  * about an event that should be processed. If this function returns true, you
  * should call vtparse_parse()
  */
-int vtparse_has_event(const vtparse_t *parser);
+VTPARSE_API int vtparse_has_event(const vtparse_t *parser);
+
+/**
+ * Resets the given compact parser state to the initial state. This is
+ * equivalent to calling vtparse_init() followed by vtparse_suspend().
+ *
+ * @param compact is the vtparse_compact_t instance that should be reset.
+ */
+VTPARSE_API void vtparse_compact_init(vtparse_compact_t *compact);
+
+/**
+ * Stores the persistent state of the given parser in a vtparse_compact_t
+ * instance. This is only possible if there is no event waiting to be
+ * processed, i.e. vtparse_has_event() returns false. A partially parsed
+ * control sequence with more than VTPARSE_COMPACT_MAX_PARAMS parameters,
+ * parameters larger than 65535 or more than VTPARSE_MAX_INTERMEDIATE_CHARS
+ * intermediate characters is marked as erroneous and will be ignored, just
+ * like a sequence exceeding VTPARSE_MAX_PARAMS. Use vtparse_suspend_spill() to
+ * keep sequences with more parameters, such as truecolor SGR sequences.
+ *
+ * @param parser is the vtparse_t instance that should be stored.
+ * @param compact is the vtparse_compact_t instance the state is written to.
+ * @return Non-zero if the state was stored, zero if there still is an event
+ * waiting to be processed.
+ */
+VTPARSE_API int vtparse_suspend(const vtparse_t *parser,
+                                vtparse_compact_t *compact);
+
+/**
+ * Same as vtparse_suspend(), but writes parameters beyond
+ * VTPARSE_COMPACT_MAX_PARAMS to the given caller-owned spill storage instead
+ * of marking the sequence as erroneous. The spill storage belongs to the
+ * session and is only touched if the sequence has more than
+ * VTPARSE_COMPACT_MAX_PARAMS parameters, i.e. it may be allocated on demand or
+ * taken from a pool. VTPARSE_COMPACT_MAX_SPILL elements suffice for all
+ * sequences accepted by a parser without an arena.
+ *
+ * @param parser is the vtparse_t instance that should be stored.
+ * @param compact is the vtparse_compact_t instance the state is written to.
+ * @param spill points at storage for max_spill additional parameters. May be
+ * NULL if max_spill is zero.
+ * @param max_spill is the number of elements in the spill storage.
+ * @return Non-zero if the state was stored, zero if there still is an event
+ * waiting to be processed.
+ */
+VTPARSE_API int vtparse_suspend_spill(const vtparse_t *parser,
+                                      vtparse_compact_t *compact,
+                                      unsigned short *spill,
+                                      unsigned int max_spill);
+
+/**
+ * Materializes the parser state stored in the given vtparse_compact_t instance
+ * in a vtparse_t instance. Afterwards, vtparse_parse() can be used to continue
+ * parsing the stream the compact state belongs to. The vtparse_t instance may
+ * be a scratch instance that is shared between many streams, as long as the
+ * streams are parsed one after another. The scratch instance must have been
+ * initialized using vtparse_init() once; its configuration is not changed.
+ *
+ * @param parser is the vtparse_t instance the state should be written to.
+ * @param compact is the vtparse_compact_t instance that should be read.
+ */
+VTPARSE_API void vtparse_resume(vtparse_t *parser,
+                                const vtparse_compact_t *compact);
+
+/**
+ * Same as vtparse_resume(), but reads parameters beyond
+ * VTPARSE_COMPACT_MAX_PARAMS from the spill storage passed to
+ * vtparse_suspend_spill(). Parameters beyond VTPARSE_MAX_PARAMS are written to
+ * the arena of the parser; if there is no room, the sequence is marked as
+ * erroneous.
+ *
+ * @param parser is the vtparse_t instance the state should be written to.
+ * @param compact is the vtparse_compact_t instance that should be read.
+ * @param spill is the spill storage the state was suspended with. May be NULL
+ * if the state was stored using vtparse_suspend().
+ */
+VTPARSE_API void vtparse_resume_spill(vtparse_t *parser,
+                                      const vtparse_compact_t *compact,
+                                      const unsigned short *spill);
 
 /**
  * Returns a string representation of the given action enum.
  */
-const char *vtparse_action_str(vtparse_action_t action);
+VTPARSE_API const char *vtparse_action_str(vtparse_action_t action);
+
+/**
+ * Returns a string representation of the given state, see vtparse_state_t in
+ * vtparse_table.h.
+ */
+VTPARSE_API const char *vtparse_state_str(int state);
+
+/**
+ * Returns a string representation of the given sequence enum.
+ */
+VTPARSE_API const char *vtparse_sequence_str(int sequence);
 
 #ifdef __cplusplus
 }
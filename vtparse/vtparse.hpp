@@ -0,0 +1,397 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse.hpp
+ *
+ * Header-only C++17 interface to vtparse. Events are exposed as lightweight
+ * views on the vtparse_t instance instead of being copied: vtparse::event
+ * only holds a pointer at the parser, and its accessors return views on the
+ * fields of vtparse_t and on the input buffer. A view is valid until the
+ * parser is advanced to the next event. Events are either passed to a visitor
+ *
+ *     vtparse::parser p;
+ *     p.parse(buf, [](const vtparse::event &e) {
+ *         if (e.action() == VTPARSE_ACTION_PRINT) {
+ *             std::cout << e.data();
+ *         }
+ *     });
+ *
+ * or iterated over as a range:
+ *
+ *     for (const vtparse::event &e : p.events(buf)) {
+ *         ...
+ *     }
+ *
+ * Both compile down to the same loop around vtparse_parse() one would write
+ * in C, with the visitor being called directly.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_HPP
+#define VTPARSE_VTPARSE_HPP
+
+#include <climits>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus > 201703L && __has_include(<span>)
+#include <span>
+#endif
+
+#include <vtparse/vtparse.h>
+
+namespace vtparse {
+
+#if defined(__cpp_lib_span)
+/**
+ * View on the parameters of a control sequence.
+ */
+using param_span = std::span<const int>;
+#else
+/**
+ * View on the parameters of a control sequence; a minimal stand-in for
+ * std::span<const int>, which is only available in C++20.
+ */
+class param_span {
+public:
+	using element_type = const int;
+	using value_type = int;
+	using size_type = std::size_t;
+	using iterator = const int *;
+
+	constexpr param_span() noexcept : data_(nullptr), size_(0) {}
+	constexpr param_span(const int *data, std::size_t size) noexcept
+	    : data_(data), size_(size) {}
+
+	constexpr const int *data() const noexcept { return data_; }
+	constexpr std::size_t size() const noexcept { return size_; }
+	constexpr bool empty() const noexcept { return size_ == 0; }
+	constexpr const int *begin() const noexcept { return data_; }
+	constexpr const int *end() const noexcept { return data_ + size_; }
+	constexpr const int &operator[](std::size_t i) const noexcept {
+		return data_[i];
+	}
+
+private:
+	const int *data_;
+	std::size_t size_;
+};
+#endif
+
+/**
+ * View on the event currently held by a parser.
+ */
+class event {
+public:
+	explicit event(vtparse_t &parser) noexcept : parser_(&parser) {}
+
+	/**
+	 * Action of the event, e.g. VTPARSE_ACTION_PRINT.
+	 */
+	vtparse_action_t action() const noexcept { return parser_->action; }
+
+	/**
+	 * Returns true if the event carries a range of data, i.e. is a
+	 * VTPARSE_ACTION_PRINT, VTPARSE_ACTION_PUT or VTPARSE_ACTION_OSC_PUT event.
+	 */
+	bool has_data() const noexcept {
+		return parser_->data_begin != parser_->data_end;
+	}
+
+	/**
+	 * Data carried by the event; points into the input buffer.
+	 */
+	std::string_view data() const noexcept {
+		return std::string_view(
+		    reinterpret_cast<const char *>(parser_->data_begin),
+		    static_cast<std::size_t>(parser_->data_end - parser_->data_begin));
+	}
+
+	/**
+	 * Character that triggered the event, e.g. the final character of a
+	 * control sequence.
+	 */
+	unsigned char ch() const noexcept {
+		return static_cast<unsigned char>(parser_->ch);
+	}
+
+	/**
+	 * Parameters of a VTPARSE_ACTION_CSI_DISPATCH or VTPARSE_ACTION_HOOK
+	 * event. Parameters left undecoded by VTPARSE_OPTION_LAZY_PARAMS are
+	 * decoded on first access. Only the first VTPARSE_MAX_PARAMS parameters
+	 * are included; use param() to access those stored in an arena.
+	 */
+	param_span params() const noexcept {
+		if (parser_->param_begin) {
+			vtparse_decode_params(parser_);
+		}
+		return param_span(parser_->params, clamp(parser_->num_params,
+		                                         VTPARSE_MAX_PARAMS));
+	}
+
+	/**
+	 * Returns the i-th parameter, including those stored in an arena, or zero
+	 * if there is no such parameter.
+	 */
+	int param(unsigned int i) const noexcept {
+		if (parser_->param_begin) {
+			vtparse_decode_params(parser_);
+		}
+		return vtparse_get_param(parser_, i);
+	}
+
+	/**
+	 * Intermediate characters of the control sequence. Only the first
+	 * VTPARSE_MAX_INTERMEDIATE_CHARS characters are included.
+	 */
+	std::string_view intermediate_chars() const noexcept {
+		return std::string_view(
+		    reinterpret_cast<const char *>(parser_->intermediate_chars),
+		    clamp(parser_->num_intermediate_chars,
+		          VTPARSE_MAX_INTERMEDIATE_CHARS));
+	}
+
+	/**
+	 * Number of line feeds in data(), see VTPARSE_OPTION_LINE_SPANS.
+	 */
+	int num_line_breaks() const noexcept { return parser_->num_line_breaks; }
+
+	/**
+	 * Sequence recognized by VTPARSE_OPTION_SEQUENCES.
+	 */
+	int sequence() const noexcept { return parser_->sequence; }
+
+	/**
+	 * Returns true if the parser encountered an error condition.
+	 */
+	bool error() const noexcept { return parser_->error != 0; }
+
+	/**
+	 * Underlying parser instance.
+	 */
+	const vtparse_t &raw() const noexcept { return *parser_; }
+
+private:
+	static std::size_t clamp(int n, unsigned int max) noexcept {
+		return static_cast<std::size_t>(
+		    static_cast<unsigned int>(n) < max ? static_cast<unsigned int>(n)
+		                                       : max);
+	}
+
+	vtparse_t *parser_;
+};
+
+class parser;
+
+/**
+ * Range of the events produced by parsing a buffer; see parser::events(). The
+ * input is parsed lazily while iterating.
+ */
+class event_range {
+public:
+	struct sentinel {};
+
+	class iterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = event;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = event;
+
+		explicit iterator(event_range &range) noexcept : range_(&range) {}
+
+		event operator*() const noexcept { return event(*range_->parser_); }
+
+		iterator &operator++() noexcept {
+			range_->next();
+			return *this;
+		}
+
+		void operator++(int) noexcept { range_->next(); }
+
+		friend bool operator==(const iterator &it, sentinel) noexcept {
+			return it.done();
+		}
+		friend bool operator==(sentinel s, const iterator &it) noexcept {
+			return it == s;
+		}
+		friend bool operator!=(const iterator &it, sentinel s) noexcept {
+			return !(it == s);
+		}
+		friend bool operator!=(sentinel s, const iterator &it) noexcept {
+			return !(it == s);
+		}
+
+	private:
+		bool done() const noexcept { return range_->done_; }
+
+		event_range *range_;
+	};
+
+	event_range(vtparse_t &parser, const unsigned char *buf,
+	            std::size_t len) noexcept
+	    : parser_(&parser), buf_(buf), len_(len), pos_(0), done_(false) {}
+
+	/**
+	 * Parses up to the first event. Must only be called once.
+	 */
+	iterator begin() noexcept {
+		next();
+		return iterator(*this);
+	}
+
+	sentinel end() const noexcept { return sentinel(); }
+
+	/**
+	 * Number of bytes consumed so far. Smaller than the buffer size after
+	 * the iteration is complete if the budget of the parser is exhausted.
+	 */
+	std::size_t consumed() const noexcept { return pos_; }
+
+private:
+	friend class parser;
+
+	void next() noexcept {
+		while (true) {
+			pos_ += vtparse_parse(parser_, buf_ + pos_, chunk(len_ - pos_));
+			if (vtparse_has_event(parser_)) {
+				return;
+			}
+			if (pos_ == len_ || vtparse_budget_exhausted(parser_)) {
+				done_ = true;
+				return;
+			}
+		}
+	}
+
+	/* vtparse_parse() reads at most UINT_MAX bytes per call */
+	static unsigned int chunk(std::size_t n) noexcept {
+		return n > UINT_MAX ? UINT_MAX : static_cast<unsigned int>(n);
+	}
+
+	vtparse_t *parser_;
+	const unsigned char *buf_;
+	std::size_t len_;
+	std::size_t pos_;
+	bool done_;
+};
+
+/**
+ * Owns a vtparse_t instance. The configuration functions correspond to the
+ * vtparse_set_* functions of the C API.
+ */
+class parser {
+public:
+	parser() noexcept { vtparse_init(&parser_); }
+
+	/**
+	 * Resets the parser and its configuration, see vtparse_init().
+	 */
+	void reset() noexcept { vtparse_init(&parser_); }
+
+	void set_event_mask(unsigned int event_mask) noexcept {
+		vtparse_set_event_mask(&parser_, event_mask);
+	}
+
+	void set_options(unsigned int options) noexcept {
+		vtparse_set_options(&parser_, options);
+	}
+
+	void set_arena(const vtparse_arena_t *arena) noexcept {
+		vtparse_set_arena(&parser_, arena);
+	}
+
+	void set_dialect(const struct vtparse_dialect *dialect) noexcept {
+		vtparse_set_dialect(&parser_, dialect);
+	}
+
+	void set_budget(unsigned int max_bytes, unsigned int max_events) noexcept {
+		vtparse_set_budget(&parser_, max_bytes, max_events);
+	}
+
+	/**
+	 * Parses the given buffer and calls the visitor with a const reference to
+	 * a vtparse::event for each event. If the visitor returns a bool, parsing
+	 * stops once it returns false; the event it was called with is consumed.
+	 * Returns the number of bytes consumed, which is smaller than len if the
+	 * visitor stopped the parser or the budget is exhausted.
+	 */
+	template <typename Visitor>
+	std::size_t parse(const unsigned char *buf, std::size_t len,
+	                  Visitor &&visitor) {
+		std::size_t pos = 0;
+		while (true) {
+			pos += vtparse_parse(&parser_, buf + pos,
+			                     event_range::chunk(len - pos));
+			if (!vtparse_has_event(&parser_)) {
+				if (pos == len || vtparse_budget_exhausted(&parser_)) {
+					return pos;
+				}
+				continue;
+			}
+			if constexpr (std::is_same_v<
+			                  std::invoke_result_t<Visitor &, const event &>,
+			                  bool>) {
+				if (!visitor(static_cast<const event &>(event(parser_)))) {
+					return pos;
+				}
+			} else {
+				visitor(static_cast<const event &>(event(parser_)));
+			}
+		}
+	}
+
+	template <typename Visitor>
+	std::size_t parse(std::string_view buf, Visitor &&visitor) {
+		return parse(reinterpret_cast<const unsigned char *>(buf.data()),
+		             buf.size(), std::forward<Visitor>(visitor));
+	}
+
+	/**
+	 * Returns a range of the events produced by parsing the given buffer. The
+	 * buffer and the parser must outlive the range.
+	 */
+	event_range events(const unsigned char *buf, std::size_t len) noexcept {
+		return event_range(parser_, buf, len);
+	}
+
+	event_range events(std::string_view buf) noexcept {
+		return events(reinterpret_cast<const unsigned char *>(buf.data()),
+		              buf.size());
+	}
+
+	/**
+	 * Underlying vtparse_t instance, e.g. for vtparse_suspend().
+	 */
+	vtparse_t &raw() noexcept { return parser_; }
+	const vtparse_t &raw() const noexcept { return parser_; }
+
+private:
+	vtparse_t parser_;
+};
+
+}  // namespace vtparse
+
+#endif /* VTPARSE_VTPARSE_HPP */
@@ -0,0 +1,5927 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_amalgamated.h
+ *
+ * Single-include version of vtparse. Including this header pulls the entire
+ * parser, including the state transition tables, into the current translation
+ * unit. All functions are declared "static inline" and the tables are
+ * declared "static", so the compiler is free to inline vtparse_parse() into
+ * the consumer's event loop. The header compiles as C and C++. Do not link
+ * against the vtparse library when using this header, and include it in
+ * exactly those translation units that call into the parser. The header does
+ * not depend on any other vtparse file and can be copied into other projects.
+ *
+ * This file is generated by scripts/vtparse_amalgamate.sh from
+ * scripts/vtparse_amalgamated.h.in, which lists the inlined files; edit the
+ * latter and re-run the script instead of modifying this file.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_AMALGAMATED_H
+#define VTPARSE_VTPARSE_AMALGAMATED_H
+
+#if defined(VTPARSE_VTPARSE_H) || defined(VTPARSE_VTPARSE_TABLE_H) || \
+    defined(VTPARSE_VTPARSE_SEQUENCE_TABLE_H) ||                        \
+    defined(VTPARSE_VTPARSE_TABLE_DECL_H) ||                            \
+    defined(VTPARSE_VTPARSE_DIALECT_H)
+#error "vtparse_amalgamated.h must be included before any other vtparse header"
+#endif
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define VTPARSE_API static inline
+#elif defined(__GNUC__)
+#define VTPARSE_API static __inline__
+#else
+#define VTPARSE_API static
+#endif
+
+#define VTPARSE_INTERNAL VTPARSE_API
+#define VTPARSE_TABLE_DECL static
+#if defined(__GNUC__)
+#define VTPARSE_TABLE_DEF static __attribute__((unused))
+#else
+#define VTPARSE_TABLE_DEF static
+#endif
+
+/* --- vtparse/vtparse.h --- */
+
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * This code is based on https://github.com/haberman/vtparse which was released
+ * to the public domain.
+ */
+
+#ifndef VTPARSE_VTPARSE_H
+#define VTPARSE_VTPARSE_H
+
+/* --- vtparse/vtparse_sequence_table.h --- */
+
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_sequence_tables.rb to re-generate this file.            *
+ ******************************************************************************/
+
+#ifndef VTPARSE_VTPARSE_SEQUENCE_TABLE_H
+#define VTPARSE_VTPARSE_SEQUENCE_TABLE_H
+
+/* --- vtparse/vtparse_table_decl.h --- */
+
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_table_decl.h
+ *
+ * Storage class, visibility and alignment of the generated tables. Included
+ * by every generated table header, such that all tables are declared the same
+ * way regardless of which header is included first. The tables are not part
+ * of the API of the shared library.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_TABLE_DECL_H
+#define VTPARSE_VTPARSE_TABLE_DECL_H
+
+/**
+ * Storage class of the table declarations and definitions. The tables are
+ * hidden in the shared library; vtparse_amalgamated.h sets both to static.
+ */
+#ifndef VTPARSE_TABLE_DECL
+#if defined(__GNUC__) && !defined(_WIN32) && !defined(__CYGWIN__)
+#define VTPARSE_TABLE_DECL extern __attribute__((visibility("hidden")))
+#else
+#define VTPARSE_TABLE_DECL extern
+#endif
+#endif
+#ifndef VTPARSE_TABLE_DEF
+#define VTPARSE_TABLE_DEF
+#endif
+
+/**
+ * Tables consulted while parsing start at a cache line boundary, such that
+ * each row of STATE_TABLE occupies exactly four cache lines.
+ */
+#define VTPARSE_TABLE_ALIGNMENT 64
+#ifndef VTPARSE_TABLE_ALIGN
+#if defined(__GNUC__)
+#define VTPARSE_TABLE_ALIGN __attribute__((aligned(VTPARSE_TABLE_ALIGNMENT)))
+#elif defined(_MSC_VER)
+#define VTPARSE_TABLE_ALIGN __declspec(align(VTPARSE_TABLE_ALIGNMENT))
+#else
+#define VTPARSE_TABLE_ALIGN
+#endif
+#endif
+
+#endif /* VTPARSE_VTPARSE_TABLE_DECL_H */
+/* --- end of vtparse/vtparse_table_decl.h --- */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+   VTPARSE_SEQUENCE_NONE = 0,
+   VTPARSE_SEQUENCE_SGR_RESET = 1,
+   VTPARSE_SEQUENCE_ERASE_LINE = 2,
+   VTPARSE_SEQUENCE_CURSOR_HOME = 3,
+   VTPARSE_SEQUENCE_HIDE_CURSOR = 4,
+   VTPARSE_SEQUENCE_SHOW_CURSOR = 5,
+   VTPARSE_SEQUENCE_CURSOR_POSITION = 6,
+   VTPARSE_SEQUENCE_SGR_FG_256 = 7,
+   VTPARSE_SEQUENCE_SGR_BG_256 = 8,
+   VTPARSE_SEQUENCE_G0_ASCII = 9,
+} vtparse_sequence_t;
+
+/* DFA recognizing the sequences following an ESC. SEQUENCE_CLASSES maps
+   bytes to the columns of SEQUENCE_DFA; state 0 rejects the input and
+   state 1 is the initial state. SEQUENCE_ACCEPT holds the sequence
+   recognized upon entering a state, or VTPARSE_SEQUENCE_NONE. */
+#define VTPARSE_SEQUENCE_NUM_STATES 30
+#define VTPARSE_SEQUENCE_NUM_CLASSES 18
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_SEQUENCE_TABLE_H */
+
+/* --- end of vtparse/vtparse_sequence_table.h --- */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Linkage of the public functions. This is empty for the regular library
+ * build; vtparse_amalgamated.h defines it as "static inline" such that the
+ * parser can be inlined into the calling code.
+ */
+#ifndef VTPARSE_API
+#define VTPARSE_API
+#endif
+
+/**
+ * Maximum number of characters belonging to a control sequence apart from the
+ * parameters.
+ */
+#define VTPARSE_MAX_INTERMEDIATE_CHARS 2U
+
+/**
+ * Maximum number of parameters.
+ */
+#define VTPARSE_MAX_PARAMS 16U
+
+/**
+ * Number of parameters of a partially parsed control sequence that are stored
+ * in a vtparse_compact_t instance itself. Further parameters are written to
+ * caller-owned spill storage, see vtparse_suspend_spill().
+ */
+#define VTPARSE_COMPACT_MAX_PARAMS 4U
+
+/**
+ * Size of the spill storage required to suspend any control sequence accepted
+ * by a vtparse_t instance without an arena.
+ */
+#define VTPARSE_COMPACT_MAX_SPILL (VTPARSE_MAX_PARAMS - VTPARSE_COMPACT_MAX_PARAMS)
+
+typedef enum {
+	VTPARSE_ACTION_CLEAR = 1,
+	VTPARSE_ACTION_COLLECT = 2,
+	VTPARSE_ACTION_CSI_DISPATCH = 3,
+	VTPARSE_ACTION_ESC_DISPATCH = 4,
+	VTPARSE_ACTION_EXECUTE = 5,
+	VTPARSE_ACTION_HOOK = 6,
+	VTPARSE_ACTION_IGNORE = 7,
+	VTPARSE_ACTION_OSC_END = 8,
+	VTPARSE_ACTION_OSC_PUT = 9,
+	VTPARSE_ACTION_OSC_START = 10,
+	VTPARSE_ACTION_PARAM = 11,
+	VTPARSE_ACTION_PRINT = 12,
+	VTPARSE_ACTION_PUT = 13,
+	VTPARSE_ACTION_UNHOOK = 14,
+	VTPARSE_ACTION_ERROR = 15,
+} vtparse_action_t;
+
+/**
+ * Returns the bit corresponding to the given action in the event mask passed
+ * to vtparse_set_event_mask().
+ */
+#define VTPARSE_EVENT_MASK(action) (1U << (action))
+
+/**
+ * Event mask selecting all events. This is the default.
+ */
+#define VTPARSE_EVENT_MASK_ALL 0xFFFFU
+
+/**
+ * Option flag for vtparse_set_options(). If set, line feeds, carriage returns
+ * and tabs in the ground state are not reported as VTPARSE_ACTION_EXECUTE, but
+ * are included in the VTPARSE_ACTION_PRINT data range instead. The number of
+ * line feeds in the range is stored in vtparse_t.num_line_breaks.
+ */
+#define VTPARSE_OPTION_LINE_SPANS 0x01U
+
+/**
+ * Option flag for vtparse_set_options(). If set, the parameters of control
+ * sequences are not decoded while parsing. Instead, param_begin and param_end
+ * point at the raw parameter bytes in the input buffer when a
+ * VTPARSE_ACTION_CSI_DISPATCH or VTPARSE_ACTION_HOOK event is returned. Call
+ * vtparse_decode_params() to fill the params array. Sequences whose parameter
+ * bytes are not contiguous, that straddle input buffers or that are preceded
+ * by pending data are decoded eagerly (param_begin is NULL in this case).
+ */
+#define VTPARSE_OPTION_LAZY_PARAMS 0x02U
+
+/**
+ * Option flag for vtparse_set_options(). If set, the most frequent control
+ * sequences (listed in tables/vtparse_sequences.txt, e.g. ESC[0m or
+ * ESC[<n>;<n>H) are matched as a whole by a precompiled recognizer directly
+ * after an ESC in the ground state, instead of being run through the state
+ * machine byte by byte. The resulting events are the same, but the "sequence"
+ * field of vtparse_t identifies the recognized sequence. Sequences that are
+ * not in the list or that straddle input buffers take the regular path and
+ * have their "sequence" field set to VTPARSE_SEQUENCE_NONE.
+ */
+#define VTPARSE_OPTION_SEQUENCES 0x04U
+
+/**
+ * Budget value for vtparse_set_budget() that disables the corresponding limit.
+ */
+#define VTPARSE_BUDGET_UNLIMITED 0U
+
+/**
+ * Instruction sets for vtparse_set_isa(). The SSE2, AVX2 and AVX-512 kernels
+ * are only available on x86-64 when compiling with GCC or clang.
+ */
+#define VTPARSE_ISA_AUTO 0
+#define VTPARSE_ISA_SCALAR 1
+#define VTPARSE_ISA_SSE2 2
+#define VTPARSE_ISA_AVX2 3
+#define VTPARSE_ISA_AVX512 4
+
+/**
+ * Compact, self-contained event record. Used by the pipeline module and by
+ * vtparse_parse_streams() to queue events for later consumption.
+ */
+typedef struct vtparse_event {
+	/**
+	 * Data span for the PRINT, PUT and OSC_PUT actions; points into the input
+	 * buffer. NULL for all other actions.
+	 */
+	unsigned char const *data;
+
+	/**
+	 * Number of bytes in the data span.
+	 */
+	unsigned int data_len;
+
+	/**
+	 * The action, see vtparse_action_t.
+	 */
+	unsigned char action;
+
+	/**
+	 * Final character of the control sequence, if any.
+	 */
+	unsigned char ch;
+
+	/**
+	 * Number of parameters and intermediate characters.
+	 */
+	unsigned char num_params;
+	unsigned char num_intermediate_chars;
+	unsigned char intermediate_chars[VTPARSE_MAX_INTERMEDIATE_CHARS];
+
+	/**
+	 * Copy of vtparse_t.error.
+	 */
+	unsigned char error;
+
+	/**
+	 * Reserved for internal use.
+	 */
+	unsigned char flags_;
+
+	/**
+	 * Parameters, clamped to 65535. Only the first VTPARSE_MAX_PARAMS
+	 * parameters are recorded.
+	 */
+	unsigned short params[VTPARSE_MAX_PARAMS];
+} vtparse_event_t;
+
+/**
+ * Caller-supplied storage for parameters and intermediate characters that do
+ * not fit into the arrays in vtparse_t. See vtparse_set_arena().
+ */
+typedef struct vtparse_arena {
+	/**
+	 * Storage for the parameters with index VTPARSE_MAX_PARAMS and above.
+	 */
+	int *params;
+
+	/**
+	 * Number of elements in the "params" array.
+	 */
+	unsigned int max_params;
+
+	/**
+	 * Storage for the intermediate characters with index
+	 * VTPARSE_MAX_INTERMEDIATE_CHARS and above.
+	 */
+	unsigned char *intermediate_chars;
+
+	/**
+	 * Number of elements in the "intermediate_chars" array.
+	 */
+	unsigned int max_intermediate_chars;
+} vtparse_arena_t;
+
+/**
+ * Data used internally by vtparse. You should not modify the member variables
+ * in this structure.
+ */
+typedef struct vtparse_private {
+	int state;
+	int cycle;
+	unsigned char change;
+	unsigned int event_mask;
+	unsigned int options;
+	const vtparse_arena_t *arena;
+	const struct vtparse_kernels *kernels;
+	const struct vtparse_dialect *dialect;
+	unsigned int max_bytes;
+	unsigned int max_events;
+	unsigned int used_bytes;
+	unsigned int used_events;
+} vtparse_private_t;
+
+typedef struct vtparse_parser {
+	/**
+	 * Action defined by the control sequence or VTPARSE_ACTION_PRINT if the
+	 * given data is just text.
+	 */
+	vtparse_action_t action;
+
+	/**
+	 * Character that is currently being processed.
+	 */
+	char ch;
+
+	/**
+	 * Number of parameters stored in the "params" array. May be larger than
+	 * VTPARSE_MAX_PARAMS if an arena is set; use vtparse_get_param() in this
+	 * case.
+	 */
+	int num_params;
+
+	/**
+	 * Number of "intermediate" characters. May be larger than
+	 * VTPARSE_MAX_INTERMEDIATE_CHARS if an arena is set; use
+	 * vtparse_get_intermediate_char() in this case.
+	 */
+	int num_intermediate_chars;
+
+	/**
+	 * If non-zero, indicates that there was an error condition. You should
+	 * probably ignore this action.
+	 */
+	int error;
+
+	/**
+	 * Sequence recognized by the VTPARSE_OPTION_SEQUENCES option for the
+	 * current VTPARSE_ACTION_CSI_DISPATCH or VTPARSE_ACTION_ESC_DISPATCH event,
+	 * see vtparse_sequence_t. VTPARSE_SEQUENCE_NONE for all other events.
+	 */
+	int sequence;
+
+	/**
+	 * Pointer at the first byte that should be printed or put.
+	 */
+	unsigned char const *data_begin;
+
+	/**
+	 * Pointer at the last byte that should be printed or put.
+	 */
+	unsigned char const *data_end;
+
+	/**
+	 * Number of line feeds between data_begin and data_end. Only non-zero if
+	 * the VTPARSE_OPTION_LINE_SPANS option is set.
+	 */
+	int num_line_breaks;
+
+	/**
+	 * Pointer at the first raw parameter byte of the current control
+	 * sequence if the VTPARSE_OPTION_LAZY_PARAMS option is set and the
+	 * parameters have not been decoded yet, NULL otherwise. Only valid until
+	 * the next call to vtparse_parse().
+	 */
+	unsigned char const *param_begin;
+
+	/**
+	 * Pointer one past the last raw parameter byte.
+	 */
+	unsigned char const *param_end;
+
+	/**
+	 * Parameters associated with the current CSI sequence.
+	 */
+	int params[VTPARSE_MAX_PARAMS];
+
+	/**
+	 * Characters occuring after the escape sequence but before any parameters.
+	 */
+	unsigned char intermediate_chars[VTPARSE_MAX_INTERMEDIATE_CHARS + 1];
+
+	/**
+	 * priv_ contains private, implementation specific data. You should not rely
+	 * on any fields in this structure in your code.
+	 */
+	vtparse_private_t priv_;
+} vtparse_t;
+
+/**
+ * Compact representation of the persistent parser state. In contrast to
+ * vtparse_t, which is rather large, this structure only occupies a few bytes
+ * and is meant to be kept per session when a large number of mostly idle
+ * streams must be parsed. Use vtparse_suspend() to store a parser in this
+ * structure and vtparse_resume() to materialize a (e.g. per-thread) vtparse_t
+ * instance from it before feeding new data into the parser.
+ */
+typedef struct vtparse_compact {
+	/**
+	 * First parameters of a partially parsed control sequence, including the
+	 * one currently being accumulated. Limited to 16 bit.
+	 */
+	unsigned short params[VTPARSE_COMPACT_MAX_PARAMS];
+
+	/**
+	 * State the state machine is currently in.
+	 */
+	unsigned char state;
+
+	/**
+	 * Non-zero if the partially parsed control sequence is erroneous or could
+	 * not be represented in this structure.
+	 */
+	unsigned char error;
+
+	/**
+	 * Number of parameters of the partially parsed control sequence. Parameters
+	 * beyond VTPARSE_COMPACT_MAX_PARAMS are stored in the spill storage.
+	 */
+	unsigned char num_params;
+
+	/**
+	 * Number of "intermediate" characters.
+	 */
+	unsigned char num_intermediate_chars;
+
+	/**
+	 * Intermediate characters of a partially parsed control sequence.
+	 */
+	unsigned char intermediate_chars[VTPARSE_MAX_INTERMEDIATE_CHARS];
+} vtparse_compact_t;
+
+/**
+ * Selects the instruction set used by the accelerated ground-state and string
+ * scanners and the parameter decoder for all parser instances initialized
+ * afterwards. By default, the widest instruction set supported by the CPU is
+ * selected when the first parser is initialized; the VTPARSE_FORCE_ISA
+ * environment variable ("scalar", "sse2", "avx2" or "avx512") overrides this
+ * choice. Parsers may be initialized on several threads at once; a parser
+ * initialized concurrently with this call may still use the previous
+ * selection.
+ *
+ * @param isa is one of the VTPARSE_ISA_* constants. VTPARSE_ISA_AUTO restores
+ * the default.
+ * @return the instruction set that is actually used, which may be narrower
+ * than the requested one if the latter is not supported.
+ */
+VTPARSE_API int vtparse_set_isa(int isa);
+
+/**
+ * Returns the instruction set selected by vtparse_set_isa().
+ */
+VTPARSE_API int vtparse_get_isa(void);
+
+/**
+ * Resets the given parser instance to its initial state.
+ *
+ * @param parser is a pointer at the vtparse_t instance that should be reset.
+ */
+VTPARSE_API void vtparse_init(vtparse_t *parser);
+
+/**
+ * Parses the given byte sequence buffer. This function either returns when the
+ * end of the buffer has been reached or a command was found in the input
+ * stream. Use the vtparse_has_event() method to check whether there is an event
+ * waiting to be processed (this is always the case if buf_len was greater than
+ * zero).
+ *
+ * @param parser is the vtparse_t instance that should be used. Information
+ * about the command that was found will be written to this instance.
+ * @param buf is a pointer at the character buffer that should be processed.
+ * @param buf_len is the length of the buffer in bytes.
+ * @return The number of bytes that read from the given input buffer. To
+ * continue parsing, call vtparse_parse() again, but advance "buf" by this
+ * number of bytes (and correspondingly decrement buf_len). Note that a return
+ * value of zero does not mean that there is no event waiting. Call
+ * vtparse_has_event() to determine whether the currently is an event that can
+ * be processed. As long as this function returns true, you should re-call
+ * vtparse_parse() with a zero-length input buffer to obtain any remaining
+ * events.
+ */
+VTPARSE_API unsigned int vtparse_parse(vtparse_t *parser,
+                                       const unsigned char *buf,
+                                       unsigned int buf_len);
+
+/**
+ * Selects the events vtparse_parse() returns to the caller. Actions that are
+ * not part of the mask are consumed internally; data belonging to masked
+ * VTPARSE_ACTION_PRINT, VTPARSE_ACTION_PUT or VTPARSE_ACTION_OSC_PUT actions is
+ * skipped without being returned. The mask is retained by vtparse_resume(),
+ * but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param event_mask is a bitwise combination of VTPARSE_EVENT_MASK(action)
+ * for all actions that should be returned, e.g.
+ * VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_START) |
+ * VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_PUT) |
+ * VTPARSE_EVENT_MASK(VTPARSE_ACTION_OSC_END).
+ */
+VTPARSE_API void vtparse_set_event_mask(vtparse_t *parser,
+                                        unsigned int event_mask);
+
+/**
+ * Sets the options of the given parser instance. The options are retained by
+ * vtparse_resume(), but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param options is a bitwise combination of VTPARSE_OPTION_* flags, e.g.
+ * VTPARSE_OPTION_LINE_SPANS.
+ */
+VTPARSE_API void vtparse_set_options(vtparse_t *parser, unsigned int options);
+
+/**
+ * Sets the arena parameters and intermediate characters spill into once the
+ * arrays in vtparse_t are full. The total number of parameters and
+ * intermediate characters is capped at the size of the arrays in vtparse_t
+ * plus the size of the arena; longer sequences are ignored. No memory is
+ * allocated by vtparse. The arena is retained by vtparse_resume(), but reset
+ * by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param arena points at the arena descriptor, which must remain valid as
+ * long as it is used by the parser. NULL disables the arena.
+ */
+VTPARSE_API void vtparse_set_arena(vtparse_t *parser,
+                                   const vtparse_arena_t *arena);
+
+/**
+ * Selects the dialect, i.e. the state transition tables, used by the given
+ * parser instance. Dialects are built at runtime with the functions in
+ * vtparse_dialect.h. The parser only stores a pointer at the dialect; the
+ * tables are looked up once per call to vtparse_parse(), such that a custom
+ * dialect does not add any work per input byte. However, the transitions
+ * inlined from the traffic profile, the stride-2 engine and the recognizer
+ * enabled by VTPARSE_OPTION_SEQUENCES are specialized for the built-in
+ * dialect and are not used with a custom dialect. The dialect is retained by
+ * vtparse_resume(), but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param dialect points at the dialect, which must remain valid and must not
+ * be modified as long as it is used by the parser. NULL selects the built-in
+ * dialect.
+ */
+VTPARSE_API void vtparse_set_dialect(vtparse_t *parser,
+                                     const struct vtparse_dialect *dialect);
+
+/**
+ * Limits the amount of work vtparse_parse() performs until the next call to
+ * vtparse_set_budget(). Once the budget is exhausted, vtparse_parse() does not
+ * consume any further input bytes; it only returns the events still pending
+ * for bytes that were already consumed and then reports that there is no
+ * event, even though the buffer was not fully consumed. The parser is at a
+ * resumable point at this stage: call vtparse_set_budget() again (e.g. when
+ * the session is scheduled the next time) and continue with the unconsumed
+ * part of the buffer. This allows a single-threaded event loop to round-robin
+ * many sessions without one of them monopolizing the loop. The budget is
+ * retained by vtparse_resume(), but reset by vtparse_init().
+ *
+ * @param parser is the vtparse_t instance that should be configured.
+ * @param max_bytes is the maximum number of input bytes to consume or
+ * VTPARSE_BUDGET_UNLIMITED.
+ * @param max_events is the maximum number of events to return or
+ * VTPARSE_BUDGET_UNLIMITED. May be exceeded by the events triggered by the
+ * last consumed byte (at most three, e.g. an exit, a transition and an entry
+ * action).
+ */
+VTPARSE_API void vtparse_set_budget(vtparse_t *parser, unsigned int max_bytes,
+                                    unsigned int max_events);
+
+/**
+ * Grants the same budget as the last call to vtparse_set_budget() again by
+ * resetting the counters reported by vtparse_get_budget_used(). Use this when
+ * a session is scheduled the next time.
+ *
+ * @param parser is the vtparse_t instance whose budget should be renewed.
+ */
+VTPARSE_API void vtparse_renew_budget(vtparse_t *parser);
+
+/**
+ * Reports the work performed by vtparse_parse() since the last call to
+ * vtparse_set_budget() or vtparse_renew_budget(). Counting only takes place
+ * while a budget is set.
+ *
+ * @param parser is the vtparse_t instance that should be queried.
+ * @param bytes if not NULL, receives the number of consumed input bytes.
+ * @param events if not NULL, receives the number of returned events.
+ */
+VTPARSE_API void vtparse_get_budget_used(const vtparse_t *parser,
+                                         unsigned int *bytes,
+                                         unsigned int *events);
+
+/**
+ * Returns true if the budget set with vtparse_set_budget() is exhausted, i.e.
+ * vtparse_parse() will not consume any further input bytes.
+ */
+VTPARSE_API int vtparse_budget_exhausted(const vtparse_t *parser);
+
+/**
+ * Returns the i-th parameter of the current control sequence, regardless of
+ * whether it is stored in vtparse_t or in the arena. Returns zero if i is
+ * out of range.
+ */
+VTPARSE_API int vtparse_get_param(const vtparse_t *parser, unsigned int i);
+
+/**
+ * Returns the i-th intermediate character of the current control sequence,
+ * regardless of whether it is stored in vtparse_t or in the arena. Returns
+ * zero if i is out of range.
+ */
+VTPARSE_API unsigned char vtparse_get_intermediate_char(const vtparse_t *parser,
+                                                       unsigned int i);
+
+/**
+ * Decodes the raw parameter bytes referenced by param_begin and param_end into
+ * the params array and updates num_params accordingly. Sets the error flag if
+ * there are more than VTPARSE_MAX_PARAMS parameters. Does nothing if the
+ * parameters already were decoded. Must be called before the next call to
+ * vtparse_parse().
+ *
+ * @param parser is the vtparse_t instance holding the event.
+ */
+VTPARSE_API void vtparse_decode_params(vtparse_t *parser);
+
+/**
+ * Returns true if the given vtparse_t instance currently holds information
+ * about an event that should be processed. If this function returns true, you
+ * should call vtparse_parse()
+ */
+VTPARSE_API int vtparse_has_event(const vtparse_t *parser);
+
+/**
+ * Resets the given compact parser state to the initial state. This is
+ * equivalent to calling vtparse_init() followed by vtparse_suspend().
+ *
+ * @param compact is the vtparse_compact_t instance that should be reset.
+ */
+VTPARSE_API void vtparse_compact_init(vtparse_compact_t *compact);
+
+/**
+ * Stores the persistent state of the given parser in a vtparse_compact_t
+ * instance. This is only possible if there is no event waiting to be
+ * processed, i.e. vtparse_has_event() returns false. A partially parsed
+ * control sequence with more than VTPARSE_COMPACT_MAX_PARAMS parameters,
+ * parameters larger than 65535 or more than VTPARSE_MAX_INTERMEDIATE_CHARS
+ * intermediate characters is marked as erroneous and will be ignored, just
+ * like a sequence exceeding VTPARSE_MAX_PARAMS. Use vtparse_suspend_spill() to
+ * keep sequences with more parameters, such as truecolor SGR sequences.
+ *
+ * @param parser is the vtparse_t instance that should be stored.
+ * @param compact is the vtparse_compact_t instance the state is written to.
+ * @return Non-zero if the state was stored, zero if there still is an event
+ * waiting to be processed.
+ */
+VTPARSE_API int vtparse_suspend(const vtparse_t *parser,
+                                vtparse_compact_t *compact);
+
+/**
+ * Same as vtparse_suspend(), but writes parameters beyond
+ * VTPARSE_COMPACT_MAX_PARAMS to the given caller-owned spill storage instead
+ * of marking the sequence as erroneous. The spill storage belongs to the
+ * session and is only touched if the sequence has more than
+ * VTPARSE_COMPACT_MAX_PARAMS parameters, i.e. it may be allocated on demand or
+ * taken from a pool. VTPARSE_COMPACT_MAX_SPILL elements suffice for all
+ * sequences accepted by a parser without an arena.
+ *
+ * @param parser is the vtparse_t instance that should be stored.
+ * @param compact is the vtparse_compact_t instance the state is written to.
+ * @param spill points at storage for max_spill additional parameters. May be
+ * NULL if max_spill is zero.
+ * @param max_spill is the number of elements in the spill storage.
+ * @return Non-zero if the state was stored, zero if there still is an event
+ * waiting to be processed.
+ */
+VTPARSE_API int vtparse_suspend_spill(const vtparse_t *parser,
+                                      vtparse_compact_t *compact,
+                                      unsigned short *spill,
+                                      unsigned int max_spill);
+
+/**
+ * Materializes the parser state stored in the given vtparse_compact_t instance
+ * in a vtparse_t instance. Afterwards, vtparse_parse() can be used to continue
+ * parsing the stream the compact state belongs to. The vtparse_t instance may
+ * be a scratch instance that is shared between many streams, as long as the
+ * streams are parsed one after another. The scratch instance must have been
+ * initialized using vtparse_init() once; its configuration is not changed.
+ *
+ * @param parser is the vtparse_t instance the state should be written to.
+ * @param compact is the vtparse_compact_t instance that should be read.
+ */
+VTPARSE_API void vtparse_resume(vtparse_t *parser,
+                                const vtparse_compact_t *compact);
+
+/**
+ * Same as vtparse_resume(), but reads parameters beyond
+ * VTPARSE_COMPACT_MAX_PARAMS from the spill storage passed to
+ * vtparse_suspend_spill(). Parameters beyond VTPARSE_MAX_PARAMS are written to
+ * the arena of the parser; if there is no room, the sequence is marked as
+ * erroneous.
+ *
+ * @param parser is the vtparse_t instance the state should be written to.
+ * @param compact is the vtparse_compact_t instance that should be read.
+ * @param spill is the spill storage the state was suspended with. May be NULL
+ * if the state was stored using vtparse_suspend().
+ */
+VTPARSE_API void vtparse_resume_spill(vtparse_t *parser,
+                                      const vtparse_compact_t *compact,
+                                      const unsigned short *spill);
+
+/**
+ * Returns a string representation of the given action enum.
+ */
+VTPARSE_API const char *vtparse_action_str(vtparse_action_t action);
+
+/**
+ * Returns a string representation of the given state, see vtparse_state_t in
+ * vtparse_table.h.
+ */
+VTPARSE_API const char *vtparse_state_str(int state);
+
+/**
+ * Returns a string representation of the given sequence enum.
+ */
+VTPARSE_API const char *vtparse_sequence_str(int sequence);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_H* */
+/* --- end of vtparse/vtparse.h --- */
+/* --- vtparse/vtparse_table.h --- */
+
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_c_tables.rb to re-generate this file.                   *
+ ******************************************************************************/
+
+#ifndef VTPARSE_VTPARSE_TABLE_H
+#define VTPARSE_VTPARSE_TABLE_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+   VTPARSE_STATE_CSI_ENTRY = 1,
+   VTPARSE_STATE_CSI_IGNORE = 2,
+   VTPARSE_STATE_CSI_INTERMEDIATE = 3,
+   VTPARSE_STATE_CSI_PARAM = 4,
+   VTPARSE_STATE_DCS_ENTRY = 5,
+   VTPARSE_STATE_DCS_IGNORE = 6,
+   VTPARSE_STATE_DCS_INTERMEDIATE = 7,
+   VTPARSE_STATE_DCS_PARAM = 8,
+   VTPARSE_STATE_DCS_PASSTHROUGH = 9,
+   VTPARSE_STATE_ESCAPE = 10,
+   VTPARSE_STATE_ESCAPE_INTERMEDIATE = 11,
+   VTPARSE_STATE_GROUND = 12,
+   VTPARSE_STATE_OSC_STRING = 13,
+   VTPARSE_STATE_SOS_PM_APC_STRING = 14,
+} vtparse_state_t;
+
+#ifndef VTPARSE_VTPARSE_H
+
+typedef enum {
+   VTPARSE_ACTION_CLEAR = 1,
+   VTPARSE_ACTION_COLLECT = 2,
+   VTPARSE_ACTION_CSI_DISPATCH = 3,
+   VTPARSE_ACTION_ESC_DISPATCH = 4,
+   VTPARSE_ACTION_EXECUTE = 5,
+   VTPARSE_ACTION_HOOK = 6,
+   VTPARSE_ACTION_IGNORE = 7,
+   VTPARSE_ACTION_OSC_END = 8,
+   VTPARSE_ACTION_OSC_PUT = 9,
+   VTPARSE_ACTION_OSC_START = 10,
+   VTPARSE_ACTION_PARAM = 11,
+   VTPARSE_ACTION_PRINT = 12,
+   VTPARSE_ACTION_PUT = 13,
+   VTPARSE_ACTION_UNHOOK = 14,
+   VTPARSE_ACTION_ERROR = 15,
+} vtparse_action_t;
+
+
+#endif
+
+typedef unsigned char vtparse_state_change_t;
+
+/* Number of states; the states are numbered starting at one */
+#define VTPARSE_NUM_STATES 14
+
+/* Bytes continuing a run of the data action in a given state, as inclusive
+   ranges. num_ranges is zero if the state has no data action or the set
+   of bytes consists of too many ranges. */
+#define VTPARSE_MAX_RUN_RANGES 4
+typedef struct vtparse_run_class {
+   unsigned char action;
+   unsigned char num_ranges;
+   unsigned char lo[VTPARSE_MAX_RUN_RANGES];
+   unsigned char hi[VTPARSE_MAX_RUN_RANGES];
+} vtparse_run_class_t;
+
+/* Byte equivalence classes and the stride-2 transition table consuming two
+   bytes per lookup, see vtparse_gen_c_tables.rb. STRIDE2_OPS holds the state
+   after both bytes, the number of operations and the operations. */
+#define VTPARSE_NUM_CLASSES 25
+#define VTPARSE_MAX_STRIDE2_OPS 2
+
+/* ENTRY_ACTIONS and EXIT_ACTIONS hold one vtparse_action_t per byte */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_TABLE_H */
+
+/* --- end of vtparse/vtparse_table.h --- */
+
+/* --- vtparse/vtparse_table.c --- */
+
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_c_tables.rb to re-generate this file.                   *
+ ******************************************************************************/
+
+
+VTPARSE_TABLE_DEF const char *const ACTION_NAMES[] = {
+   "<no action>",
+   "CLEAR",
+   "COLLECT",
+   "CSI_DISPATCH",
+   "ESC_DISPATCH",
+   "EXECUTE",
+   "HOOK",
+   "IGNORE",
+   "OSC_END",
+   "OSC_PUT",
+   "OSC_START",
+   "PARAM",
+   "PRINT",
+   "PUT",
+   "UNHOOK",
+   "ERROR",
+};
+
+VTPARSE_TABLE_DEF const char *const STATE_NAMES[] = {
+   "<no state>",
+   "CSI_ENTRY",
+   "CSI_IGNORE",
+   "CSI_INTERMEDIATE",
+   "CSI_PARAM",
+   "DCS_ENTRY",
+   "DCS_IGNORE",
+   "DCS_INTERMEDIATE",
+   "DCS_PARAM",
+   "DCS_PASSTHROUGH",
+   "ESCAPE",
+   "ESCAPE_INTERMEDIATE",
+   "GROUND",
+   "OSC_STRING",
+   "SOS_PM_APC_STRING",
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const vtparse_state_change_t STATE_TABLE[14][256] = {
+  {  /* VTPARSE_STATE_CSI_ENTRY = 0 */
+/*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*48 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*49 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*50 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*51 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*52 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*53 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*54 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*55 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*56 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*57 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*58 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*59 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*60 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*61 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*62 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*63 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_PARAM           << 4),
+/*64 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*65 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*66 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*67 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*68 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*69 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*70 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*71 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*72 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*73 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*74 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*75 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*76 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*77 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*78 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*79 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*80 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*81 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*82 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*83 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*84 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*85 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*86 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*87 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*88 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*89 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*90 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*91 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*92 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*93 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*94 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*95 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*96 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*97 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*98 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*99 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*100*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*101*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*102*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*103*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*104*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*105*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*106*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*107*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*108*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*109*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*110*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*111*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*112*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*113*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*114*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*115*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*116*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*117*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*118*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*119*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*120*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*121*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*122*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*123*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*124*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*125*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*126*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_CSI_IGNORE = 1 */
+/*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*48 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*58 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*59 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*60 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*61 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*62 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*63 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*64 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*65 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*66 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*67 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*68 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*69 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*70 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*71 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*72 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*73 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*74 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*75 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*76 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*77 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*78 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*79 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*80 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*81 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*82 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*83 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*84 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*85 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*86 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*87 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*88 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*89 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*90 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*91 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*92 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*93 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*94 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*95 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*96 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*97 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*98 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*99 */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*100*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*101*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*102*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*103*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*104*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*105*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*106*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*107*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*108*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*109*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*110*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*111*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*112*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*113*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*114*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*115*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*116*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*117*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*118*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*119*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*120*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*121*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*122*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*123*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*124*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*125*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*126*/  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_CSI_INTERMEDIATE = 2 */
+/*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*48 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*49 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*50 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*51 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*52 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*53 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*54 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*55 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*56 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*57 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*58 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*59 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*60 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*61 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*62 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*63 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*64 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*65 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*66 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*67 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*68 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*69 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*70 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*71 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*72 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*73 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*74 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*75 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*76 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*77 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*78 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*79 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*80 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*81 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*82 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*83 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*84 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*85 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*86 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*87 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*88 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*89 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*90 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*91 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*92 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*93 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*94 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*95 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*96 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*97 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*98 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*99 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*100*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*101*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*102*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*103*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*104*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*105*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*106*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*107*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*108*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*109*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*110*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*111*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*112*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*113*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*114*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*115*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*116*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*117*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*118*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*119*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*120*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*121*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*122*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*123*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*124*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*125*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*126*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_CSI_PARAM = 3 */
+/*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_CSI_INTERMEDIATE    << 4),
+/*48 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*58 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*59 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*60 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*61 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*62 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*63 */  0                                 | (VTPARSE_STATE_CSI_IGNORE          << 4),
+/*64 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*65 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*66 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*67 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*68 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*69 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*70 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*71 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*72 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*73 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*74 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*75 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*76 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*77 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*78 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*79 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*80 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*81 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*82 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*83 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*84 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*85 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*86 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*87 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*88 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*89 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*90 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*91 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*92 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*93 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*94 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*95 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*96 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*97 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*98 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*99 */  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*100*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*101*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*102*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*103*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*104*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*105*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*106*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*107*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*108*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*109*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*110*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*111*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*112*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*113*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*114*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*115*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*116*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*117*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*118*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*119*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*120*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*121*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*122*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*123*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*124*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*125*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*126*/  VTPARSE_ACTION_CSI_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_DCS_ENTRY = 4 */
+/*0  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*48 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*49 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*50 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*51 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*52 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*53 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*54 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*55 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*56 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*57 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*58 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*59 */  VTPARSE_ACTION_PARAM              | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*60 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*61 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*62 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*63 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_PARAM           << 4),
+/*64 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*65 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*66 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*67 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*68 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*69 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*70 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*71 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*72 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*73 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*74 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*75 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*76 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*77 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*78 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*79 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*80 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*81 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*82 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*83 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*84 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*85 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*86 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*87 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*88 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*89 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*90 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*91 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*92 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*93 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*94 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*95 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*96 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*97 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*98 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*99 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*100*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*101*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*102*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*103*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*104*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*105*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*106*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*107*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*108*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*109*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*110*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*111*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*112*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*113*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*114*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*115*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*116*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*117*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*118*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*119*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*120*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*121*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*122*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*123*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*124*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*125*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*126*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_DCS_IGNORE = 5 */
+/*0  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*48 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*58 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*59 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*60 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*61 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*62 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*63 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*64 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*65 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*66 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*67 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*68 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*69 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*70 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*71 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*72 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*73 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*74 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*75 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*76 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*77 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*78 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*79 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*80 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*81 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*82 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*83 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*84 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*85 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*86 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*87 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*88 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*89 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*90 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*91 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*92 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*93 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*94 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*95 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*96 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*97 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*98 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*99 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*100*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*101*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*102*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*103*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*104*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*105*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*106*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*107*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*108*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*109*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*110*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*111*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*112*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*113*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*114*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*115*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*116*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*117*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*118*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*119*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*120*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*121*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*122*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*123*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*124*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*125*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*126*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_DCS_INTERMEDIATE = 6 */
+/*0  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*48 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*49 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*50 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*51 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*52 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*53 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*54 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*55 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*56 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*57 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*58 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*59 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*60 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*61 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*62 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*63 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*64 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*65 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*66 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*67 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*68 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*69 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*70 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*71 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*72 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*73 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*74 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*75 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*76 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*77 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*78 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*79 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*80 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*81 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*82 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*83 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*84 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*85 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*86 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*87 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*88 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*89 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*90 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*91 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*92 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*93 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*94 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*95 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*96 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*97 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*98 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*99 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*100*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*101*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*102*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*103*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*104*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*105*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*106*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*107*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*108*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*109*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*110*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*111*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*112*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*113*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*114*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*115*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*116*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*117*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*118*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*119*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*120*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*121*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*122*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*123*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*124*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*125*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*126*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_DCS_PARAM = 7 */
+/*0  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_DCS_INTERMEDIATE    << 4),
+/*48 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*58 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*59 */  VTPARSE_ACTION_PARAM              | (0                                 << 4),
+/*60 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*61 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*62 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*63 */  0                                 | (VTPARSE_STATE_DCS_IGNORE          << 4),
+/*64 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*65 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*66 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*67 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*68 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*69 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*70 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*71 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*72 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*73 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*74 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*75 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*76 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*77 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*78 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*79 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*80 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*81 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*82 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*83 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*84 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*85 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*86 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*87 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*88 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*89 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*90 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*91 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*92 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*93 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*94 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*95 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*96 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*97 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*98 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*99 */  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*100*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*101*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*102*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*103*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*104*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*105*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*106*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*107*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*108*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*109*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*110*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*111*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*112*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*113*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*114*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*115*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*116*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*117*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*118*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*119*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*120*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*121*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*122*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*123*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*124*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*125*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*126*/  0                                 | (VTPARSE_STATE_DCS_PASSTHROUGH     << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_DCS_PASSTHROUGH = 8 */
+/*0  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*48 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*58 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*59 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*60 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*61 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*62 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*63 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*64 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*65 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*66 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*67 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*68 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*69 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*70 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*71 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*72 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*73 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*74 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*75 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*76 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*77 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*78 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*79 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*80 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*81 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*82 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*83 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*84 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*85 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*86 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*87 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*88 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*89 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*90 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*91 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*92 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*93 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*94 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*95 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*96 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*97 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*98 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*99 */  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*100*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*101*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*102*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*103*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*104*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*105*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*106*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*107*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*108*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*109*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*110*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*111*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*112*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*113*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*114*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*115*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*116*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*117*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*118*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*119*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*120*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*121*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*122*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*123*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*124*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*125*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*126*/  VTPARSE_ACTION_PUT                | (0                                 << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_ESCAPE = 9 */
+/*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (VTPARSE_STATE_ESCAPE_INTERMEDIATE << 4),
+/*48 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*49 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*50 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*51 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*52 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*53 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*54 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*55 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*56 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*57 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*58 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*59 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*60 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*61 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*62 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*63 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*64 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*65 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*66 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*67 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*68 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*69 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*70 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*71 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*72 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*73 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*74 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*75 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*76 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*77 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*78 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*79 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*80 */  0                                 | (VTPARSE_STATE_DCS_ENTRY           << 4),
+/*81 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*82 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*83 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*84 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*85 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*86 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*87 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*88 */  0                                 | (VTPARSE_STATE_SOS_PM_APC_STRING   << 4),
+/*89 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*90 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*91 */  0                                 | (VTPARSE_STATE_CSI_ENTRY           << 4),
+/*92 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*93 */  0                                 | (VTPARSE_STATE_OSC_STRING          << 4),
+/*94 */  0                                 | (VTPARSE_STATE_SOS_PM_APC_STRING   << 4),
+/*95 */  0                                 | (VTPARSE_STATE_SOS_PM_APC_STRING   << 4),
+/*96 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*97 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*98 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*99 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*100*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*101*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*102*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*103*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*104*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*105*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*106*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*107*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*108*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*109*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*110*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*111*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*112*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*113*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*114*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*115*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*116*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*117*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*118*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*119*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*120*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*121*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*122*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*123*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*124*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*125*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*126*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_ESCAPE_INTERMEDIATE = 10 */
+/*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_COLLECT            | (0                                 << 4),
+/*48 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*49 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*50 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*51 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*52 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*53 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*54 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*55 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*56 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*57 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*58 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*59 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*60 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*61 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*62 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*63 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*64 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*65 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*66 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*67 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*68 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*69 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*70 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*71 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*72 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*73 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*74 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*75 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*76 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*77 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*78 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*79 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*80 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*81 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*82 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*83 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*84 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*85 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*86 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*87 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*88 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*89 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*90 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*91 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*92 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*93 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*94 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*95 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*96 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*97 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*98 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*99 */  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*100*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*101*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*102*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*103*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*104*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*105*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*106*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*107*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*108*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*109*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*110*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*111*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*112*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*113*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*114*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*115*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*116*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*117*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*118*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*119*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*120*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*121*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*122*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*123*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*124*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*125*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*126*/  VTPARSE_ACTION_ESC_DISPATCH       | (VTPARSE_STATE_GROUND              << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_GROUND = 11 */
+/*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*48 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*58 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*59 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*60 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*61 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*62 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*63 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*64 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*65 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*66 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*67 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*68 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*69 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*70 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*71 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*72 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*73 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*74 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*75 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*76 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*77 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*78 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*79 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*80 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*81 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*82 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*83 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*84 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*85 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*86 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*87 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*88 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*89 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*90 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*91 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*92 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*93 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*94 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*95 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*96 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*97 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*98 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*99 */  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*100*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*101*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*102*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*103*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*104*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*105*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*106*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*107*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*108*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*109*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*110*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*111*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*112*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*113*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*114*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*115*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*116*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*117*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*118*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*119*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*120*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*121*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*122*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*123*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*124*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*125*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*126*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*127*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*128*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*129*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*130*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*131*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*132*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*133*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*134*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*135*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*136*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*137*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*138*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*139*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*140*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*141*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*142*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*143*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*144*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*145*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*146*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*147*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*148*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*149*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*150*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*151*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*152*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*153*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*154*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*155*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*156*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*157*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*158*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*159*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*160*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*161*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*162*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*163*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*164*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*165*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*166*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*167*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*168*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*169*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*170*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*171*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*172*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*173*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*174*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*175*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*176*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*177*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*178*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*179*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*180*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*181*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*182*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*183*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*184*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*185*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*186*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*187*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*188*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*189*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*190*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*191*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*192*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*193*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*194*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*195*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*196*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*197*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*198*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*199*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*200*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*201*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*202*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*203*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*204*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*205*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*206*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*207*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*208*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*209*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*210*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*211*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*212*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*213*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*214*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*215*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*216*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*217*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*218*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*219*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*220*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*221*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*222*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*223*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*224*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*225*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*226*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*227*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*228*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*229*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*230*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*231*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*232*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*233*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*234*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*235*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*236*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*237*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*238*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*239*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*240*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*241*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*242*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*243*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*244*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*245*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*246*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+/*247*/  VTPARSE_ACTION_PRINT              | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_OSC_STRING = 12 */
+/*0  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*7  */  0                                 | (VTPARSE_STATE_GROUND              << 4),
+/*8  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*48 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*58 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*59 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*60 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*61 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*62 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*63 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*64 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*65 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*66 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*67 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*68 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*69 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*70 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*71 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*72 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*73 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*74 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*75 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*76 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*77 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*78 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*79 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*80 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*81 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*82 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*83 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*84 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*85 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*86 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*87 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*88 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*89 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*90 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*91 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*92 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*93 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*94 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*95 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*96 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*97 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*98 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*99 */  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*100*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*101*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*102*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*103*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*104*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*105*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*106*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*107*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*108*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*109*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*110*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*111*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*112*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*113*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*114*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*115*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*116*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*117*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*118*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*119*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*120*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*121*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*122*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*123*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*124*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*125*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*126*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+/*127*/  VTPARSE_ACTION_OSC_PUT            | (0                                 << 4),
+  },
+  {  /* VTPARSE_STATE_SOS_PM_APC_STRING = 13 */
+/*0  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*1  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*2  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*3  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*4  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*5  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*6  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*7  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*8  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*9  */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*10 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*11 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*12 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*13 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*14 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*15 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*16 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*17 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*18 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*19 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*20 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*21 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*22 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*23 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*24 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*25 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*26 */  VTPARSE_ACTION_EXECUTE            | (VTPARSE_STATE_GROUND              << 4),
+/*27 */  0                                 | (VTPARSE_STATE_ESCAPE              << 4),
+/*28 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*29 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*30 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*31 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*32 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*33 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*34 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*35 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*36 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*37 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*38 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*39 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*40 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*41 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*42 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*43 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*44 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*45 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*46 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*47 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*48 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*49 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*50 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*51 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*52 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*53 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*54 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*55 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*56 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*57 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*58 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*59 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*60 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*61 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*62 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*63 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*64 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*65 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*66 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*67 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*68 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*69 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*70 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*71 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*72 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*73 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*74 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*75 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*76 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*77 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*78 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*79 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*80 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*81 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*82 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*83 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*84 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*85 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*86 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*87 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*88 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*89 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*90 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*91 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*92 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*93 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*94 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*95 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*96 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*97 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*98 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*99 */  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*100*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*101*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*102*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*103*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*104*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*105*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*106*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*107*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*108*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*109*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*110*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*111*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*112*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*113*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*114*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*115*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*116*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*117*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*118*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*119*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*120*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*121*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*122*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*123*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*124*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*125*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*126*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+/*127*/  VTPARSE_ACTION_IGNORE             | (0                                 << 4),
+  },
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char ENTRY_ACTIONS[] = {
+   VTPARSE_ACTION_CLEAR, /* CSI_ENTRY */
+   0  /* none for CSI_IGNORE */,
+   0  /* none for CSI_INTERMEDIATE */,
+   0  /* none for CSI_PARAM */,
+   VTPARSE_ACTION_CLEAR, /* DCS_ENTRY */
+   0  /* none for DCS_IGNORE */,
+   0  /* none for DCS_INTERMEDIATE */,
+   0  /* none for DCS_PARAM */,
+   VTPARSE_ACTION_HOOK, /* DCS_PASSTHROUGH */
+   VTPARSE_ACTION_CLEAR, /* ESCAPE */
+   0  /* none for ESCAPE_INTERMEDIATE */,
+   0  /* none for GROUND */,
+   VTPARSE_ACTION_OSC_START, /* OSC_STRING */
+   0  /* none for SOS_PM_APC_STRING */,
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char EXIT_ACTIONS[] = {
+   0  /* none for CSI_ENTRY */,
+   0  /* none for CSI_IGNORE */,
+   0  /* none for CSI_INTERMEDIATE */,
+   0  /* none for CSI_PARAM */,
+   0  /* none for DCS_ENTRY */,
+   0  /* none for DCS_IGNORE */,
+   0  /* none for DCS_INTERMEDIATE */,
+   0  /* none for DCS_PARAM */,
+   VTPARSE_ACTION_UNHOOK, /* DCS_PASSTHROUGH */
+   0  /* none for ESCAPE */,
+   0  /* none for ESCAPE_INTERMEDIATE */,
+   0  /* none for GROUND */,
+   VTPARSE_ACTION_OSC_END, /* OSC_STRING */
+   0  /* none for SOS_PM_APC_STRING */,
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const vtparse_run_class_t RUN_CLASSES[] = {
+   {0, 0, {0}, {0}}, /* CSI_ENTRY */
+   {0, 0, {0}, {0}}, /* CSI_IGNORE */
+   {0, 0, {0}, {0}}, /* CSI_INTERMEDIATE */
+   {0, 0, {0}, {0}}, /* CSI_PARAM */
+   {0, 0, {0}, {0}}, /* DCS_ENTRY */
+   {0, 0, {0}, {0}}, /* DCS_IGNORE */
+   {0, 0, {0}, {0}}, /* DCS_INTERMEDIATE */
+   {0, 0, {0}, {0}}, /* DCS_PARAM */
+   {VTPARSE_ACTION_PUT, 3, {0x00, 0x19, 0x1c}, {0x17, 0x19, 0x7e}}, /* DCS_PASSTHROUGH */
+   {0, 0, {0}, {0}}, /* ESCAPE */
+   {0, 0, {0}, {0}}, /* ESCAPE_INTERMEDIATE */
+   {VTPARSE_ACTION_PRINT, 1, {0x20}, {0xf7}}, /* GROUND */
+   {VTPARSE_ACTION_OSC_PUT, 1, {0x20}, {0x7f}}, /* OSC_STRING */
+   {0, 0, {0}, {0}}, /* SOS_PM_APC_STRING */
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char BYTE_CLASSES[] = {
+/*00*/  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/*10*/  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  3,  4,  0,  0,  0,  0,
+/*20*/  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+/*30*/  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  7,  8,  9,  9,  9,  9,
+/*40*/ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+/*50*/ 11, 12, 12, 12, 12, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+/*60*/ 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+/*70*/ 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22,
+/*80*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*90*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*a0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*b0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*c0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*d0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*e0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*f0*/ 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24,
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_TABLE[14][VTPARSE_NUM_CLASSES][VTPARSE_NUM_CLASSES] = {
+  {  /* VTPARSE_STATE_CSI_ENTRY = 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 7, 8, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,10,10,10}, /* 5 */
+    { 0, 0, 0, 0,11,12,13,14,13,14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,15,15,15}, /* 6 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 7 */
+    { 0, 0, 0, 0,11,12,13,14,13,14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,15,15,15}, /* 8 */
+    { 0, 0, 0, 0, 7,19,20, 9,20, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,21,21,21}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,23,24,25,24,26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,27,27,27}, /* 22 */
+    { 0, 0, 0, 0,22,23,24,25,24,26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,27,27,27}, /* 23 */
+    { 0, 0, 0, 0,22,23,24,25,24,26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,27,27,27}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_CSI_IGNORE = 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 5 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 6 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 7 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 8 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 9 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 10 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 11 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 12 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 13 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 14 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 15 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 16 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 17 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 18 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 19 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 20 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 21 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 22 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 23 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_CSI_INTERMEDIATE = 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0,31,32,33,33,33,33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,34,34,34}, /* 5 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 6 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 7 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 8 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,35,25,25,25,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,36,36,36}, /* 22 */
+    { 0, 0, 0, 0,22,35,25,25,25,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,36,36,36}, /* 23 */
+    { 0, 0, 0, 0,22,35,25,25,25,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,36,36,36}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_CSI_PARAM = 3 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 7, 8, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,10,10,10}, /* 5 */
+    { 0, 0, 0, 0,37,38,39,40,39,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,41,41,41}, /* 6 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 7 */
+    { 0, 0, 0, 0,37,38,39,40,39,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,41,41,41}, /* 8 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,23,42,25,42,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,43,43,43}, /* 22 */
+    { 0, 0, 0, 0,22,23,42,25,42,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,43,43,43}, /* 23 */
+    { 0, 0, 0, 0,22,23,42,25,42,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,43,43,43}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_ENTRY = 4 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 0 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {49,49, 0, 0, 7,50,51,51,51,51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,49,49,49}, /* 5 */
+    {52,52, 0, 0,11,53,54,55,54,55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,52,52,52}, /* 6 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 7 */
+    {52,52, 0, 0,11,53,54,55,54,55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,52,52,52}, /* 8 */
+    {57,57, 0, 0, 7,58,59,51,59,51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,57,57,57}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 22 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 23 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_IGNORE = 5 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 0 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 5 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 6 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 7 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 8 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 9 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 10 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 11 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 12 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 13 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 14 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 15 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 16 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 17 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 18 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 19 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 20 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 21 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 22 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 23 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_INTERMEDIATE = 6 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 0 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {63,63, 0, 0,31,64,65,65,65,65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,63,63,63}, /* 5 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 6 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 7 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 8 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 22 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 23 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_PARAM = 7 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 0 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {49,49, 0, 0, 7,50,51,51,51,51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,49,49,49}, /* 5 */
+    {68,68, 0, 0,37,69,70,71,70,71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,68,68,68}, /* 6 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 7 */
+    {68,68, 0, 0,37,69,70,71,70,71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,68,68,68}, /* 8 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 22 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 23 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_PASSTHROUGH = 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 4 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,72,72,72}, /* 22 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,72,72,72}, /* 23 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,72,72,72}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_ESCAPE = 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 7,73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,74,74,74}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    {75,75, 0, 0, 1,76,77,78,77,79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,75,75,75}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    {80,80, 0, 0,16,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 1,81,82,83,82,84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,85,85,85}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    {80,80, 0, 0,16,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80}, /* 19 */
+    {80,80, 0, 0,16,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,86, 0, 0, 0, 0, 0,87, 0,88, 0, 0,89, 0, 0,88,88, 0,90,90,90}, /* 22 */
+    { 0, 0, 0, 0,22,86, 0, 0, 0, 0, 0,87, 0,88, 0, 0,89, 0, 0,88,88, 0,90,90,90}, /* 23 */
+    { 0, 0, 0, 0,22,86, 0, 0, 0, 0, 0,87, 0,88, 0, 0,89, 0, 0,88,88, 0,90,90,90}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_ESCAPE_INTERMEDIATE = 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0,31,91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,92,92,92}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,94,94,94}, /* 22 */
+    { 0, 0, 0, 0,22,93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,94,94,94}, /* 23 */
+    { 0, 0, 0, 0,22,93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,94,94,94}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_GROUND = 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 22 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 23 */
+    { 0, 0, 0, 0,22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,95}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_OSC_STRING = 12 */
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,96,96}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 4 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 22 */
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,96,96}, /* 23 */
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,96,96}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_SOS_PM_APC_STRING = 13 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 0 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 5 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 6 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 7 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 8 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 9 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 10 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 11 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 12 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 13 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 14 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 15 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 16 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 17 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 18 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 19 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 20 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 21 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 22 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 23 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 24 */
+  },
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_OPS[98][VTPARSE_MAX_STRIDE2_OPS + 2] = {
+   {0x00, 0x00},
+   {0x0a, 0x02, 0x21, 0x31},
+   {0x0b, 0x02, 0x21, 0x32},
+   {0x05, 0x02, 0x21, 0x31},
+   {0x0e, 0x02, 0x21, 0x30},
+   {0x01, 0x02, 0x21, 0x31},
+   {0x0a, 0x01, 0x21},
+   {0x0a, 0x02, 0x22, 0x31},
+   {0x03, 0x02, 0x22, 0x12},
+   {0x02, 0x02, 0x22, 0x30},
+   {0x03, 0x01, 0x22},
+   {0x0a, 0x02, 0x2b, 0x31},
+   {0x03, 0x02, 0x2b, 0x32},
+   {0x04, 0x02, 0x2b, 0x1b},
+   {0x02, 0x02, 0x2b, 0x30},
+   {0x04, 0x01, 0x2b},
+   {0x0a, 0x02, 0x20, 0x31},
+   {0x02, 0x01, 0x20},
+   {0x0c, 0x02, 0x20, 0x30},
+   {0x03, 0x02, 0x22, 0x32},
+   {0x04, 0x02, 0x22, 0x1b},
+   {0x04, 0x01, 0x22},
+   {0x0a, 0x01, 0x31},
+   {0x03, 0x01, 0x32},
+   {0x04, 0x01, 0x3b},
+   {0x02, 0x01, 0x30},
+   {0x04, 0x01, 0x32},
+   {0x01, 0x00},
+   {0x02, 0x00},
+   {0x0c, 0x01, 0x30},
+   {0x0c, 0x01, 0x20},
+   {0x0a, 0x02, 0x02, 0x31},
+   {0x03, 0x02, 0x02, 0x12},
+   {0x02, 0x02, 0x02, 0x30},
+   {0x03, 0x01, 0x02},
+   {0x03, 0x01, 0x12},
+   {0x03, 0x00},
+   {0x0a, 0x02, 0x0b, 0x31},
+   {0x03, 0x02, 0x0b, 0x32},
+   {0x04, 0x02, 0x0b, 0x1b},
+   {0x02, 0x02, 0x0b, 0x30},
+   {0x04, 0x01, 0x0b},
+   {0x04, 0x01, 0x1b},
+   {0x04, 0x00},
+   {0x05, 0x00},
+   {0x07, 0x01, 0x32},
+   {0x08, 0x01, 0x3b},
+   {0x06, 0x01, 0x30},
+   {0x08, 0x01, 0x32},
+   {0x07, 0x01, 0x22},
+   {0x07, 0x02, 0x22, 0x12},
+   {0x06, 0x02, 0x22, 0x30},
+   {0x08, 0x01, 0x2b},
+   {0x07, 0x02, 0x2b, 0x32},
+   {0x08, 0x02, 0x2b, 0x1b},
+   {0x06, 0x02, 0x2b, 0x30},
+   {0x06, 0x01, 0x20},
+   {0x08, 0x01, 0x22},
+   {0x07, 0x02, 0x22, 0x32},
+   {0x08, 0x02, 0x22, 0x1b},
+   {0x06, 0x00},
+   {0x07, 0x00},
+   {0x07, 0x01, 0x12},
+   {0x07, 0x01, 0x02},
+   {0x07, 0x02, 0x02, 0x12},
+   {0x06, 0x02, 0x02, 0x30},
+   {0x08, 0x00},
+   {0x08, 0x01, 0x1b},
+   {0x08, 0x01, 0x0b},
+   {0x07, 0x02, 0x0b, 0x32},
+   {0x08, 0x02, 0x0b, 0x1b},
+   {0x06, 0x02, 0x0b, 0x30},
+   {0x09, 0x00},
+   {0x0b, 0x02, 0x22, 0x12},
+   {0x0b, 0x01, 0x22},
+   {0x05, 0x01, 0x21},
+   {0x07, 0x02, 0x21, 0x32},
+   {0x08, 0x02, 0x21, 0x3b},
+   {0x06, 0x02, 0x21, 0x30},
+   {0x08, 0x02, 0x21, 0x32},
+   {0x0e, 0x01, 0x20},
+   {0x03, 0x02, 0x21, 0x32},
+   {0x04, 0x02, 0x21, 0x3b},
+   {0x02, 0x02, 0x21, 0x30},
+   {0x04, 0x02, 0x21, 0x32},
+   {0x01, 0x01, 0x21},
+   {0x0b, 0x01, 0x32},
+   {0x05, 0x01, 0x31},
+   {0x0e, 0x01, 0x30},
+   {0x01, 0x01, 0x31},
+   {0x0a, 0x00},
+   {0x0b, 0x02, 0x02, 0x12},
+   {0x0b, 0x01, 0x02},
+   {0x0b, 0x01, 0x12},
+   {0x0b, 0x00},
+   {0x0c, 0x00},
+   {0x0d, 0x00},
+   {0x0e, 0x00},
+};
+/* --- end of vtparse/vtparse_table.c --- */
+/* --- vtparse/vtparse_sequence_table.c --- */
+
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_sequence_tables.rb to re-generate this file.            *
+ ******************************************************************************/
+
+
+VTPARSE_TABLE_DEF const char *const SEQUENCE_NAMES[] = {
+   "<no sequence>",
+   "SGR_RESET",
+   "ERASE_LINE",
+   "CURSOR_HOME",
+   "HIDE_CURSOR",
+   "SHOW_CURSOR",
+   "CURSOR_POSITION",
+   "SGR_FG_256",
+   "SGR_BG_256",
+   "G0_ASCII",
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_CLASSES[] = {
+/*00*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*10*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*20*/  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/*30*/  2,  3,  4,  5,  6,  7,  3,  3,  8,  3,  0,  9,  0,  0,  0, 10,
+/*40*/  0,  0, 11,  0,  0,  0,  0,  0, 12,  0,  0, 13,  0,  0,  0,  0,
+/*50*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,
+/*60*/  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 16, 17,  0,  0,
+/*70*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*80*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*90*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*a0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*b0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*c0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*d0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*e0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*f0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_DFA[][18] = {
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 0 */
+   { 0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0}, /* 1 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0}, /* 2 */
+   { 0,  0,  5,  6,  6,  7,  8,  6,  6,  9, 10,  0, 11, 12,  0,  0,  0, 13}, /* 3 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 4 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6,  9,  0,  0,  0,  0,  0,  0,  0, 14}, /* 5 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6,  9,  0,  0,  0,  0,  0,  0,  0,  0}, /* 6 */
+   { 0,  0,  6,  6,  6,  6,  6,  6, 15,  9,  0,  0,  0,  0,  0,  0,  0,  0}, /* 7 */
+   { 0,  0,  6,  6,  6,  6,  6,  6, 16,  9,  0,  0,  0,  0,  0,  0,  0,  0}, /* 8 */
+   { 0,  0,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0, 17,  0,  0,  0,  0,  0}, /* 9 */
+   { 0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 10 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 11 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 12 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 13 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 14 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6, 19,  0,  0,  0,  0,  0,  0,  0,  0}, /* 15 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6, 20,  0,  0,  0,  0,  0,  0,  0,  0}, /* 16 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 17 */
+   { 0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 18 */
+   { 0,  0,  9,  9,  9,  9,  9, 22,  9,  0,  0,  0, 17,  0,  0,  0,  0,  0}, /* 19 */
+   { 0,  0,  9,  9,  9,  9,  9, 23,  9,  0,  0,  0, 17,  0,  0,  0,  0,  0}, /* 20 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24, 25,  0}, /* 21 */
+   { 0,  0,  9,  9,  9,  9,  9,  9,  9, 26,  0,  0, 17,  0,  0,  0,  0,  0}, /* 22 */
+   { 0,  0,  9,  9,  9,  9,  9,  9,  9, 27,  0,  0, 17,  0,  0,  0,  0,  0}, /* 23 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 24 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 25 */
+   { 0,  0, 26, 26, 26, 26, 26, 26, 26,  0,  0,  0,  0,  0,  0,  0,  0, 28}, /* 26 */
+   { 0,  0, 27, 27, 27, 27, 27, 27, 27,  0,  0,  0,  0,  0,  0,  0,  0, 29}, /* 27 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 28 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 29 */
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_ACCEPT[] = {
+   VTPARSE_SEQUENCE_NONE, /* 0 */
+   VTPARSE_SEQUENCE_NONE, /* 1 */
+   VTPARSE_SEQUENCE_NONE, /* 2 */
+   VTPARSE_SEQUENCE_NONE, /* 3 */
+   VTPARSE_SEQUENCE_G0_ASCII, /* 4 */
+   VTPARSE_SEQUENCE_NONE, /* 5 */
+   VTPARSE_SEQUENCE_NONE, /* 6 */
+   VTPARSE_SEQUENCE_NONE, /* 7 */
+   VTPARSE_SEQUENCE_NONE, /* 8 */
+   VTPARSE_SEQUENCE_NONE, /* 9 */
+   VTPARSE_SEQUENCE_NONE, /* 10 */
+   VTPARSE_SEQUENCE_CURSOR_HOME, /* 11 */
+   VTPARSE_SEQUENCE_ERASE_LINE, /* 12 */
+   VTPARSE_SEQUENCE_SGR_RESET, /* 13 */
+   VTPARSE_SEQUENCE_SGR_RESET, /* 14 */
+   VTPARSE_SEQUENCE_NONE, /* 15 */
+   VTPARSE_SEQUENCE_NONE, /* 16 */
+   VTPARSE_SEQUENCE_CURSOR_POSITION, /* 17 */
+   VTPARSE_SEQUENCE_NONE, /* 18 */
+   VTPARSE_SEQUENCE_NONE, /* 19 */
+   VTPARSE_SEQUENCE_NONE, /* 20 */
+   VTPARSE_SEQUENCE_NONE, /* 21 */
+   VTPARSE_SEQUENCE_NONE, /* 22 */
+   VTPARSE_SEQUENCE_NONE, /* 23 */
+   VTPARSE_SEQUENCE_SHOW_CURSOR, /* 24 */
+   VTPARSE_SEQUENCE_HIDE_CURSOR, /* 25 */
+   VTPARSE_SEQUENCE_NONE, /* 26 */
+   VTPARSE_SEQUENCE_NONE, /* 27 */
+   VTPARSE_SEQUENCE_SGR_FG_256, /* 28 */
+   VTPARSE_SEQUENCE_SGR_BG_256, /* 29 */
+};
+/* --- end of vtparse/vtparse_sequence_table.c --- */
+/* --- vtparse/vtparse_dispatch.c --- */
+
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dispatch.c
+ *
+ * Instruction set specific kernels and the runtime selection among them. The
+ * kernels are compiled with per-function target attributes, so the library
+ * itself can be built for the baseline instruction set; the CPU is queried
+ * using cpuid (via __builtin_cpu_supports()) the first time a parser is
+ * initialized.
+ *
+ * The scan kernels test whether a byte belongs to a run class by checking the
+ * byte ranges listed in RUN_CLASSES, which are generated together with the
+ * state transition table. A byte x lies in the range [lo, hi] if
+ * (x - lo) mod 256 <= hi - lo, which maps to an unsigned minimum and a
+ * comparison in SSE2 and AVX2.
+ *
+ * @author Andreas Stöckel
+ */
+
+/* --- vtparse/vtparse_dispatch.h --- */
+
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dispatch.h
+ *
+ * Internal interface between the parser and the instruction set specific
+ * kernels. The kernels are selected once for the running CPU; each parser
+ * instance stores a pointer at the kernel table in effect when vtparse_init()
+ * was called.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_DISPATCH_H
+#define VTPARSE_VTPARSE_DISPATCH_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Defined if the compiler supports per-function target attributes and the
+ * x86 intrinsics, i.e. if the SSE2, AVX2 and AVX-512 kernels are built.
+ */
+#if defined(__GNUC__) && defined(__x86_64__) && \
+    (__GNUC__ >= 5 || defined(__clang__))
+#define VTPARSE_DISPATCH_X86 1
+#endif
+
+/**
+ * Storage class of the functions declared in this header. They are shared
+ * between the translation units of the library but hidden in the shared
+ * library, just like the generated tables; vtparse_amalgamated.h sets this to
+ * VTPARSE_API.
+ */
+#ifndef VTPARSE_INTERNAL
+#if defined(__GNUC__) && !defined(_WIN32) && !defined(__CYGWIN__)
+#define VTPARSE_INTERNAL __attribute__((visibility("hidden")))
+#else
+#define VTPARSE_INTERNAL
+#endif
+#endif
+
+/**
+ * Atomic access to the pointers at the selected kernels, which are set lazily
+ * by the first parser and may be read from several threads at once. Falls
+ * back to plain accesses for compilers without the GCC atomic builtins.
+ */
+#if defined(__GNUC__)
+#define VTPARSE_ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define VTPARSE_ATOMIC_STORE(ptr, value) \
+	__atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define VTPARSE_ATOMIC_INIT(ptr, expected, value)                 \
+	__atomic_compare_exchange_n((ptr), (expected), (value), 0, \
+	                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define VTPARSE_ATOMIC_LOAD(ptr) (*(ptr))
+#define VTPARSE_ATOMIC_STORE(ptr, value) (*(ptr) = (value))
+#define VTPARSE_ATOMIC_INIT(ptr, expected, value) (*(ptr) = (value), 1)
+#endif
+
+/**
+ * Minimum number of remaining input bytes for which the parser calls a scan
+ * kernel instead of its inline loop.
+ */
+#define VTPARSE_SCAN_MIN_LEN 16U
+
+/**
+ * Returns the index of the first byte in buf[pos] to buf[buf_len - 1] that is
+ * not contained in the given run class, or buf_len if there is no such byte.
+ * cls->num_ranges must be larger than zero.
+ */
+typedef unsigned int (*vtparse_scan_kernel_t)(const vtparse_run_class_t *cls,
+                                              const unsigned char *buf,
+                                              unsigned int pos,
+                                              unsigned int buf_len);
+
+/**
+ * Decodes the raw parameter bytes p to end - 1 (digits and ';', at least one
+ * byte) into params, as if they were passed to an empty parameter list one
+ * after another. Returns the number of parameters, or -1 if there are more
+ * than VTPARSE_MAX_PARAMS parameters (params is clobbered in this case).
+ */
+typedef int (*vtparse_decode_params_kernel_t)(int *params,
+                                              const unsigned char *p,
+                                              const unsigned char *end);
+
+/**
+ * Validates UTF-8 starting at buf[pos], which must be the first byte of a
+ * character. Returns the end of a prefix of buf[pos] to buf[buf_len - 1] that
+ * consists of complete, valid characters and adds the number of characters in
+ * the prefix to *num_codepoints. The kernel may stop before the first invalid
+ * or truncated character; the caller continues with the scalar decoder.
+ */
+typedef unsigned int (*vtparse_utf8_kernel_t)(const unsigned char *buf,
+                                              unsigned int pos,
+                                              unsigned int buf_len,
+                                              unsigned int *num_codepoints);
+
+/**
+ * Set of kernels for one instruction set. NULL entries select the portable
+ * code inlined into the parser.
+ */
+typedef struct vtparse_kernels {
+	int isa;
+
+	/**
+	 * Scanner for runs of VTPARSE_ACTION_PRINT in the ground state.
+	 */
+	vtparse_scan_kernel_t scan_ground;
+
+	/**
+	 * Scanner for runs of VTPARSE_ACTION_PUT and VTPARSE_ACTION_OSC_PUT in the
+	 * DCS and OSC string states.
+	 */
+	vtparse_scan_kernel_t scan_string;
+
+	/**
+	 * Decoder for raw parameter bytes, see VTPARSE_OPTION_LAZY_PARAMS.
+	 */
+	vtparse_decode_params_kernel_t decode_params;
+
+	/**
+	 * UTF-8 validator used by vtparse_utf8_validate().
+	 */
+	vtparse_utf8_kernel_t validate_utf8;
+} vtparse_kernels_t;
+
+/**
+ * Returns the widest instruction set supported by the CPU (and the compiler).
+ */
+VTPARSE_INTERNAL int vtparse_cpu_isa(void);
+
+/**
+ * Returns the kernel table for the instruction set selected by
+ * vtparse_set_isa(). Upon the first call, selects the widest instruction set
+ * supported by the CPU, unless overridden by the VTPARSE_FORCE_ISA
+ * environment variable.
+ */
+VTPARSE_INTERNAL const vtparse_kernels_t *vtparse_get_kernels(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_DISPATCH_H */
+/* --- end of vtparse/vtparse_dispatch.h --- */
+
+#ifdef VTPARSE_DISPATCH_X86
+#include <immintrin.h>
+#if defined(__STDC_HOSTED__) && __STDC_HOSTED__ && !defined(VTPARSE_NO_GETENV)
+#include <stdlib.h>
+#define VTPARSE_DISPATCH_GETENV 1
+#endif
+#endif
+
+/******************************************************************************
+ * Kernels                                                                    *
+ ******************************************************************************/
+
+static const vtparse_kernels_t VTPARSE_KERNELS_SCALAR = {
+    VTPARSE_ISA_SCALAR, 0, 0, 0, 0};
+
+#ifdef VTPARSE_DISPATCH_X86
+
+/**
+ * Scalar tail of the scan kernels.
+ */
+static unsigned int vtparse_scan_tail(const vtparse_run_class_t *cls,
+                                      const unsigned char *buf,
+                                      unsigned int pos, unsigned int buf_len) {
+	unsigned int r;
+	unsigned char x;
+	for (; pos < buf_len; pos++) {
+		x = buf[pos];
+		for (r = 0; r < cls->num_ranges; r++) {
+			if ((unsigned char)(x - cls->lo[r]) <=
+			    (unsigned char)(cls->hi[r] - cls->lo[r])) {
+				break;
+			}
+		}
+		if (r == cls->num_ranges) {
+			break;
+		}
+	}
+	return pos;
+}
+
+/**
+ * Returns the start of the last character in buf[start] to buf[end - 1] if
+ * the character is truncated, end otherwise. Only called for input that has
+ * been validated up to a possibly truncated last character; decrements
+ * *num_codepoints if the character is cut off.
+ */
+static unsigned int vtparse_utf8_complete_end(const unsigned char *buf,
+                                              unsigned int start,
+                                              unsigned int end,
+                                              unsigned int *num_codepoints) {
+	unsigned int i = end, len;
+	unsigned char c;
+	while (i > start && end - i < 4U) {
+		c = buf[--i];
+		if (c < 0x80U) {
+			break;
+		}
+		if (c >= 0xC0U) {
+			len = (c >= 0xF0U) ? 4U : ((c >= 0xE0U) ? 3U : 2U);
+			if (i + len > end) {
+				(*num_codepoints)--;
+				return i;
+			}
+			break;
+		}
+	}
+	return end;
+}
+
+/*
+ * SSE2
+ */
+
+/* Plain SSE2 lacks the byte shuffle required for the lookup tables of the
+   full validator; this kernel only skips over ASCII */
+__attribute__((target("sse2"))) static unsigned int vtparse_validate_utf8_sse2(
+    const unsigned char *buf, unsigned int pos, unsigned int buf_len,
+    unsigned int *num_codepoints) {
+	unsigned int mask, start = pos;
+	for (; pos + 16U <= buf_len; pos += 16U) {
+		mask = (unsigned int)_mm_movemask_epi8(
+		    _mm_loadu_si128((const __m128i *)(buf + pos)));
+		if (mask) {
+			pos += (unsigned int)__builtin_ctz(mask);
+			break;
+		}
+	}
+	*num_codepoints += pos - start;
+	return pos;
+}
+
+__attribute__((target("sse2"))) static unsigned int vtparse_scan_string_sse2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m128i lo[VTPARSE_MAX_RUN_RANGES], width[VTPARSE_MAX_RUN_RANGES];
+	__m128i x, d, in;
+	unsigned int r, mask;
+
+	for (r = 0; r < cls->num_ranges; r++) {
+		lo[r] = _mm_set1_epi8((char)cls->lo[r]);
+		width[r] = _mm_set1_epi8((char)(cls->hi[r] - cls->lo[r]));
+	}
+	for (; pos + 16U <= buf_len; pos += 16U) {
+		x = _mm_loadu_si128((const __m128i *)(buf + pos));
+		in = _mm_setzero_si128();
+		for (r = 0; r < cls->num_ranges; r++) {
+			d = _mm_sub_epi8(x, lo[r]);
+			in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(d, width[r]), d));
+		}
+		mask = ~(unsigned int)_mm_movemask_epi8(in) & 0xFFFFU;
+		if (mask) {
+			return pos + (unsigned int)__builtin_ctz(mask);
+		}
+	}
+	return vtparse_scan_tail(cls, buf, pos, buf_len);
+}
+
+__attribute__((target("sse2"))) static unsigned int vtparse_scan_ground_sse2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m128i lo, width, d0, d1;
+	unsigned int mask;
+
+	if (cls->num_ranges != 1U) {
+		return vtparse_scan_string_sse2(cls, buf, pos, buf_len);
+	}
+	lo = _mm_set1_epi8((char)cls->lo[0]);
+	width = _mm_set1_epi8((char)(cls->hi[0] - cls->lo[0]));
+	for (; pos + 32U <= buf_len; pos += 32U) {
+		d0 = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(buf + pos)), lo);
+		d1 = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(buf + pos + 16U)),
+		                  lo);
+		mask = (unsigned int)_mm_movemask_epi8(
+		           _mm_cmpeq_epi8(_mm_min_epu8(d0, width), d0)) |
+		       ((unsigned int)_mm_movemask_epi8(
+		            _mm_cmpeq_epi8(_mm_min_epu8(d1, width), d1))
+		        << 16U);
+		if (~mask) {
+			return pos + (unsigned int)__builtin_ctz(~mask);
+		}
+	}
+	return vtparse_scan_string_sse2(cls, buf, pos, buf_len);
+}
+
+__attribute__((target("sse2"))) static int vtparse_decode_params_sse2(
+    int *params, const unsigned char *p, const unsigned char *end) {
+	const __m128i semicolon = _mm_set1_epi8(';');
+	unsigned char chunk[16];
+	const unsigned char *src;
+	unsigned int len, mask, i, k;
+	int n = (*p == ';') ? 0 : 1, value = 0;
+
+	while (p < end) {
+		/* Never read past the end of the input buffer */
+		len = (unsigned int)(end - p);
+		if (len >= 16U) {
+			src = p;
+			len = 16U;
+		} else {
+			for (i = 0; i < 16U; i++) {
+				chunk[i] = (i < len) ? p[i] : 0U;
+			}
+			src = chunk;
+		}
+
+		/* Accumulate the digits between the separators */
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+		    _mm_loadu_si128((const __m128i *)src), semicolon));
+		i = 0;
+		while (mask) {
+			k = (unsigned int)__builtin_ctz(mask);
+			mask &= mask - 1U;
+			for (; i < k; i++) {
+				value = value * 10 + (src[i] - '0');
+			}
+			if (n > 0) {
+				params[n - 1] = value;
+			}
+			if (++n > (int)VTPARSE_MAX_PARAMS) {
+				return -1;
+			}
+			value = 0;
+			i = k + 1U;
+		}
+		for (; i < len; i++) {
+			value = value * 10 + (src[i] - '0');
+		}
+		p += len;
+	}
+	params[n - 1] = value;
+	return n;
+}
+
+/*
+ * AVX2
+ */
+
+__attribute__((target("avx2"))) static unsigned int vtparse_scan_string_avx2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m256i lo[VTPARSE_MAX_RUN_RANGES], width[VTPARSE_MAX_RUN_RANGES];
+	__m256i x, d, in;
+	unsigned int r, mask;
+
+	for (r = 0; r < cls->num_ranges; r++) {
+		lo[r] = _mm256_set1_epi8((char)cls->lo[r]);
+		width[r] = _mm256_set1_epi8((char)(cls->hi[r] - cls->lo[r]));
+	}
+	for (; pos + 32U <= buf_len; pos += 32U) {
+		x = _mm256_loadu_si256((const __m256i *)(buf + pos));
+		in = _mm256_setzero_si256();
+		for (r = 0; r < cls->num_ranges; r++) {
+			d = _mm256_sub_epi8(x, lo[r]);
+			in = _mm256_or_si256(
+			    in, _mm256_cmpeq_epi8(_mm256_min_epu8(d, width[r]), d));
+		}
+		mask = ~(unsigned int)_mm256_movemask_epi8(in);
+		if (mask) {
+			return pos + (unsigned int)__builtin_ctz(mask);
+		}
+	}
+	/* The compiler omits this before the tail call; without it, each SSE
+	   instruction in the callee pays for the dirty upper register halves */
+	_mm256_zeroupper();
+	return vtparse_scan_string_sse2(cls, buf, pos, buf_len);
+}
+
+__attribute__((target("avx2"))) static unsigned int vtparse_scan_ground_avx2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m256i lo, width, d0, d1;
+	unsigned int mask0, mask1;
+
+	if (cls->num_ranges != 1U) {
+		return vtparse_scan_string_avx2(cls, buf, pos, buf_len);
+	}
+	lo = _mm256_set1_epi8((char)cls->lo[0]);
+	width = _mm256_set1_epi8((char)(cls->hi[0] - cls->lo[0]));
+	for (; pos + 64U <= buf_len; pos += 64U) {
+		d0 = _mm256_sub_epi8(_mm256_loadu_si256((const __m256i *)(buf + pos)),
+		                     lo);
+		d1 = _mm256_sub_epi8(
+		    _mm256_loadu_si256((const __m256i *)(buf + pos + 32U)), lo);
+		mask0 = ~(unsigned int)_mm256_movemask_epi8(
+		    _mm256_cmpeq_epi8(_mm256_min_epu8(d0, width), d0));
+		mask1 = ~(unsigned int)_mm256_movemask_epi8(
+		    _mm256_cmpeq_epi8(_mm256_min_epu8(d1, width), d1));
+		if (mask0) {
+			return pos + (unsigned int)__builtin_ctz(mask0);
+		} else if (mask1) {
+			return pos + 32U + (unsigned int)__builtin_ctz(mask1);
+		}
+	}
+	return vtparse_scan_string_avx2(cls, buf, pos, buf_len);
+}
+
+/*
+ * UTF-8 validation following the lookup algorithm by Keiser and Lemire
+ * ("Validating UTF-8 in less than one instruction per byte", 2021). Three
+ * 16-entry tables indexed by the high and low nibble of the previous byte and
+ * the high nibble of the current byte flag all invalid two-byte combinations;
+ * the expected positions of third and fourth bytes are checked separately.
+ */
+
+#define UTF8_TOO_SHORT (1 << 0)
+#define UTF8_TOO_LONG (1 << 1)
+#define UTF8_OVERLONG_3 (1 << 2)
+#define UTF8_TOO_LARGE (1 << 3)
+#define UTF8_SURROGATE (1 << 4)
+#define UTF8_OVERLONG_2 (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4 (1 << 6)
+#define UTF8_TWO_CONTS (1 << 7)
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+__attribute__((target("avx2"))) static __m256i vtparse_utf8_prev_avx2(
+    __m256i in, __m256i prev_in, int n) {
+	__m256i x = _mm256_permute2x128_si256(prev_in, in, 0x21);
+	switch (n) {
+		case 1:
+			return _mm256_alignr_epi8(in, x, 15);
+		case 2:
+			return _mm256_alignr_epi8(in, x, 14);
+		default:
+			return _mm256_alignr_epi8(in, x, 13);
+	}
+}
+
+__attribute__((target("avx2"))) static unsigned int vtparse_validate_utf8_avx2(
+    const unsigned char *buf, unsigned int pos, unsigned int buf_len,
+    unsigned int *num_codepoints) {
+	const __m256i byte_1_high_tbl = _mm256_setr_epi8(
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_2, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+	    (char)(UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_OVERLONG_4),
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_2, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+	    (char)(UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_OVERLONG_4));
+	const __m256i byte_1_low_tbl = _mm256_setr_epi8(
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4),
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_2), (char)UTF8_CARRY,
+	    (char)UTF8_CARRY, (char)(UTF8_CARRY | UTF8_TOO_LARGE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_SURROGATE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4),
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_2), (char)UTF8_CARRY,
+	    (char)UTF8_CARRY, (char)(UTF8_CARRY | UTF8_TOO_LARGE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_SURROGATE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000));
+	const __m256i byte_2_high_tbl = _mm256_setr_epi8(
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	const __m256i not_cont = _mm256_set1_epi8(-65); /* 0xBF */
+	const __m256i third = _mm256_set1_epi8((char)(0xE0 - 0x80));
+	const __m256i fourth = _mm256_set1_epi8((char)(0xF0 - 0x80));
+	const __m256i msb = _mm256_set1_epi8((char)0x80);
+	__m256i in, prev_in = _mm256_setzero_si256(), prev1, sc, must23, err;
+	unsigned int start = pos;
+	int tail_ascii = 1;
+
+	for (; pos + 32U <= buf_len; pos += 32U) {
+		in = _mm256_loadu_si256((const __m256i *)(buf + pos));
+
+		/* ASCII blocks are valid unless the previous block ended inside a
+		   multibyte character */
+		if (!_mm256_movemask_epi8(in) && tail_ascii) {
+			*num_codepoints += 32U;
+			prev_in = in;
+			continue;
+		}
+
+		prev1 = vtparse_utf8_prev_avx2(in, prev_in, 1);
+		sc = _mm256_and_si256(
+		    _mm256_and_si256(
+		        _mm256_shuffle_epi8(
+		            byte_1_high_tbl,
+		            _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+		        _mm256_shuffle_epi8(byte_1_low_tbl,
+		                            _mm256_and_si256(prev1, nibble))),
+		    _mm256_shuffle_epi8(
+		        byte_2_high_tbl,
+		        _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+		must23 = _mm256_or_si256(
+		    _mm256_subs_epu8(vtparse_utf8_prev_avx2(in, prev_in, 2), third),
+		    _mm256_subs_epu8(vtparse_utf8_prev_avx2(in, prev_in, 3), fourth));
+		err = _mm256_xor_si256(_mm256_and_si256(must23, msb), sc);
+		if (!_mm256_testz_si256(err, err)) {
+			break;
+		}
+
+		*num_codepoints += (unsigned int)__builtin_popcount(
+		    (unsigned int)_mm256_movemask_epi8(_mm256_cmpgt_epi8(in, not_cont)));
+		tail_ascii = buf[pos + 31U] < 0x80U;
+		prev_in = in;
+	}
+
+	/* Spans are short; skip another 16 bytes of ASCII before handing the
+	   rest to the scalar decoder */
+	if (pos + 32U > buf_len && pos + 16U <= buf_len && tail_ascii &&
+	    !_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(buf + pos)))) {
+		*num_codepoints += 16U;
+		pos += 16U;
+	}
+	return vtparse_utf8_complete_end(buf, start, pos, num_codepoints);
+}
+
+/*
+ * AVX-512 (requires AVX512BW for byte-granular operations). Masked loads
+ * handle the tail without touching memory past the end of the buffer.
+ */
+
+__attribute__((target("avx512f,avx512bw"))) static unsigned int
+vtparse_scan_string_avx512(const vtparse_run_class_t *cls,
+                           const unsigned char *buf, unsigned int pos,
+                           unsigned int buf_len) {
+	__m512i lo[VTPARSE_MAX_RUN_RANGES], width[VTPARSE_MAX_RUN_RANGES], x;
+	__mmask64 valid, in;
+	unsigned int r;
+
+	for (r = 0; r < cls->num_ranges; r++) {
+		lo[r] = _mm512_set1_epi8((char)cls->lo[r]);
+		width[r] = _mm512_set1_epi8((char)(cls->hi[r] - cls->lo[r]));
+	}
+	for (; pos < buf_len; pos += 64U) {
+		valid = (buf_len - pos >= 64U)
+		            ? ~(__mmask64)0
+		            : (((__mmask64)1 << (buf_len - pos)) - 1U);
+		x = _mm512_maskz_loadu_epi8(valid, buf + pos);
+		in = 0;
+		for (r = 0; r < cls->num_ranges; r++) {
+			in |= _mm512_cmple_epu8_mask(_mm512_sub_epi8(x, lo[r]), width[r]);
+		}
+		in = ~in & valid;
+		if (in) {
+			return pos + (unsigned int)__builtin_ctzll(in);
+		}
+	}
+	return buf_len;
+}
+
+__attribute__((target("avx512f,avx512bw"))) static unsigned int
+vtparse_scan_ground_avx512(const vtparse_run_class_t *cls,
+                           const unsigned char *buf, unsigned int pos,
+                           unsigned int buf_len) {
+	__m512i lo, width;
+	__mmask64 in;
+
+	if (cls->num_ranges != 1U) {
+		return vtparse_scan_string_avx512(cls, buf, pos, buf_len);
+	}
+	lo = _mm512_set1_epi8((char)cls->lo[0]);
+	width = _mm512_set1_epi8((char)(cls->hi[0] - cls->lo[0]));
+	for (; pos + 64U <= buf_len; pos += 64U) {
+		in = _mm512_cmple_epu8_mask(
+		    _mm512_sub_epi8(_mm512_loadu_si512((const void *)(buf + pos)), lo),
+		    width);
+		if (~in) {
+			return pos + (unsigned int)__builtin_ctzll(~in);
+		}
+	}
+	return vtparse_scan_string_avx512(cls, buf, pos, buf_len);
+}
+
+/* The parameter lists are typically far shorter than a single SSE2 register,
+   hence the SSE2 parameter decoder is used for the wider instruction sets as
+   well. Likewise, the AVX2 UTF-8 validator is used on AVX-512 machines. */
+
+static const vtparse_kernels_t VTPARSE_KERNELS_SSE2 = {
+    VTPARSE_ISA_SSE2, vtparse_scan_ground_sse2, vtparse_scan_string_sse2,
+    vtparse_decode_params_sse2, vtparse_validate_utf8_sse2};
+
+static const vtparse_kernels_t VTPARSE_KERNELS_AVX2 = {
+    VTPARSE_ISA_AVX2, vtparse_scan_ground_avx2, vtparse_scan_string_avx2,
+    vtparse_decode_params_sse2, vtparse_validate_utf8_avx2};
+
+static const vtparse_kernels_t VTPARSE_KERNELS_AVX512 = {
+    VTPARSE_ISA_AVX512, vtparse_scan_ground_avx512, vtparse_scan_string_avx512,
+    vtparse_decode_params_sse2, vtparse_validate_utf8_avx2};
+
+#endif /* VTPARSE_DISPATCH_X86 */
+
+/******************************************************************************
+ * Selection                                                                  *
+ ******************************************************************************/
+
+/* Kernels selected by vtparse_set_isa() or lazily by vtparse_get_kernels();
+   only accessed through the VTPARSE_ATOMIC_* macros */
+static const vtparse_kernels_t *vtparse_kernels = 0;
+
+VTPARSE_INTERNAL int vtparse_cpu_isa(void) {
+#ifdef VTPARSE_DISPATCH_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") &&
+	    __builtin_cpu_supports("avx512bw")) {
+		return VTPARSE_ISA_AVX512;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		return VTPARSE_ISA_AVX2;
+	}
+	return VTPARSE_ISA_SSE2; /* Part of the x86-64 baseline */
+#else
+	return VTPARSE_ISA_SCALAR;
+#endif
+}
+
+#ifdef VTPARSE_DISPATCH_GETENV
+static int vtparse_streq(const char *a, const char *b) {
+	while (*a && *a == *b) {
+		a++, b++;
+	}
+	return *a == *b;
+}
+#endif
+
+/**
+ * Reads the VTPARSE_FORCE_ISA environment variable. Returns
+ * VTPARSE_ISA_AUTO if the variable is not set or invalid.
+ */
+static int vtparse_forced_isa(void) {
+#ifdef VTPARSE_DISPATCH_GETENV
+	const char *s = getenv("VTPARSE_FORCE_ISA");
+	if (s) {
+		if (vtparse_streq(s, "scalar")) {
+			return VTPARSE_ISA_SCALAR;
+		} else if (vtparse_streq(s, "sse2")) {
+			return VTPARSE_ISA_SSE2;
+		} else if (vtparse_streq(s, "avx2")) {
+			return VTPARSE_ISA_AVX2;
+		} else if (vtparse_streq(s, "avx512")) {
+			return VTPARSE_ISA_AVX512;
+		}
+	}
+#endif
+	return VTPARSE_ISA_AUTO;
+}
+
+/**
+ * Returns the kernel table for the given VTPARSE_ISA_* constant.
+ */
+static const vtparse_kernels_t *vtparse_select_kernels(int isa) {
+	const int supported = vtparse_cpu_isa();
+
+	if (isa == VTPARSE_ISA_AUTO) {
+		isa = vtparse_forced_isa();
+	}
+	if (isa == VTPARSE_ISA_AUTO || isa > supported) {
+		isa = supported;
+	}
+	switch (isa) {
+#ifdef VTPARSE_DISPATCH_X86
+		case VTPARSE_ISA_AVX512:
+			return &VTPARSE_KERNELS_AVX512;
+		case VTPARSE_ISA_AVX2:
+			return &VTPARSE_KERNELS_AVX2;
+		case VTPARSE_ISA_SSE2:
+			return &VTPARSE_KERNELS_SSE2;
+#endif
+		default:
+			return &VTPARSE_KERNELS_SCALAR;
+	}
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API int vtparse_set_isa(int isa) {
+	const vtparse_kernels_t *kernels = vtparse_select_kernels(isa);
+	VTPARSE_ATOMIC_STORE(&vtparse_kernels, kernels);
+	return kernels->isa;
+}
+
+VTPARSE_API int vtparse_get_isa(void) {
+	return vtparse_get_kernels()->isa;
+}
+
+VTPARSE_INTERNAL const vtparse_kernels_t *vtparse_get_kernels(void) {
+	const vtparse_kernels_t *kernels = VTPARSE_ATOMIC_LOAD(&vtparse_kernels);
+	const vtparse_kernels_t *expected = 0;
+	if (!kernels) {
+		/* Threads racing here all select the same kernels; a concurrent
+		   vtparse_set_isa() takes precedence */
+		kernels = vtparse_select_kernels(VTPARSE_ISA_AUTO);
+		if (!VTPARSE_ATOMIC_INIT(&vtparse_kernels, &expected, kernels)) {
+			kernels = expected;
+		}
+	}
+	return kernels;
+}
+/* --- end of vtparse/vtparse_dispatch.c --- */
+/* --- vtparse/vtparse_dialect.c --- */
+
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dialect.c
+ *
+ * Builds custom dialects from a list of rules. The rules are expanded into a
+ * state transition table with one entry per state and byte, exactly like
+ * tables/vtparse_gen_c_tables.rb does for the built-in dialect, and the run
+ * classes used by the vectorized scanners are derived from the table.
+ *
+ * @author Andreas Stöckel
+ */
+
+/* --- vtparse/vtparse_dialect.h --- */
+
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dialect.h
+ *
+ * Custom dialects of the state machine built at runtime. A dialect consists of
+ * the same tables that tables/vtparse_gen_c_tables.rb generates for the
+ * built-in dialect, and is described by a list of rules in the spirit of the
+ * $states hash in tables/vtparse_tables.rb: each rule assigns an action and a
+ * target state to a range of bytes read in a given state, or sets the entry or
+ * exit action of a state. The rules are applied in order on top of a copy of
+ * the built-in dialect; later rules override earlier ones. A dialect uses the
+ * same states and actions as the built-in one, only the transitions between
+ * them differ. Attach a dialect to a parser with vtparse_set_dialect().
+ *
+ * Example, a parser that ignores device control strings:
+ *
+ *     static const vtparse_dialect_rule_t rules[] = {
+ *         VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x50, 0x50, 0,
+ *                      VTPARSE_STATE_SOS_PM_APC_STRING),
+ *         VTPARSE_RULE_END};
+ *     vtparse_dialect_t dialect;
+ *
+ *     vtparse_dialect_init(&dialect);
+ *     vtparse_dialect_apply(&dialect, rules);
+ *     vtparse_set_dialect(&parser, &dialect);
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_DIALECT_H
+#define VTPARSE_VTPARSE_DIALECT_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Kinds of vtparse_dialect_rule_t entries.
+ */
+#define VTPARSE_RULE_KIND_END 0
+#define VTPARSE_RULE_KIND_TRANSITION 1
+#define VTPARSE_RULE_KIND_ON_ENTRY 2
+#define VTPARSE_RULE_KIND_ON_EXIT 3
+
+/**
+ * State of a rule that applies to all states, like the "anywhere" transitions
+ * in tables/vtparse_tables.rb.
+ */
+#define VTPARSE_DIALECT_ANYWHERE 0
+
+/**
+ * A single rule of a dialect description.
+ */
+typedef struct vtparse_dialect_rule {
+	/**
+	 * One of the VTPARSE_RULE_KIND_* constants.
+	 */
+	unsigned char kind;
+
+	/**
+	 * State the rule applies to (VTPARSE_STATE_*) or VTPARSE_DIALECT_ANYWHERE.
+	 */
+	unsigned char state;
+
+	/**
+	 * Inclusive range of bytes the transition is taken for.
+	 */
+	unsigned char first, last;
+
+	/**
+	 * Action (VTPARSE_ACTION_*) or zero for no action.
+	 */
+	unsigned char action;
+
+	/**
+	 * Target state (VTPARSE_STATE_*) or zero to stay in the current state
+	 * without running the exit and entry actions.
+	 */
+	unsigned char target;
+} vtparse_dialect_rule_t;
+
+/**
+ * Initializers for vtparse_dialect_rule_t. A list of rules is terminated by
+ * VTPARSE_RULE_END.
+ */
+#define VTPARSE_RULE(state, first, last, action, target) \
+	{VTPARSE_RULE_KIND_TRANSITION, (state), (first), (last), (action), (target)}
+#define VTPARSE_RULE_ON_ENTRY(state, action) \
+	{VTPARSE_RULE_KIND_ON_ENTRY, (state), 0, 0, (action), 0}
+#define VTPARSE_RULE_ON_EXIT(state, action) \
+	{VTPARSE_RULE_KIND_ON_EXIT, (state), 0, 0, (action), 0}
+#define VTPARSE_RULE_END {VTPARSE_RULE_KIND_END, 0, 0, 0, 0, 0}
+
+/**
+ * Example dialects, see vtparse_dialect_preset().
+ */
+typedef enum {
+	/**
+	 * Recognizes the 8-bit C1 control characters 0x80 to 0x9F (e.g. 0x9B as
+	 * CSI) anywhere, like a DEC terminal in 8-bit mode, and prints 0xA0 to
+	 * 0xFF as single-byte characters in the ground state. Not suitable for
+	 * UTF-8 encoded input.
+	 */
+	VTPARSE_DIALECT_C1 = 1,
+
+	/**
+	 * Treats device control strings like SOS, PM and APC strings, i.e. ignores
+	 * them until the string terminator, for untrusted input. The parser never
+	 * reports VTPARSE_ACTION_HOOK, VTPARSE_ACTION_PUT or
+	 * VTPARSE_ACTION_UNHOOK.
+	 */
+	VTPARSE_DIALECT_NO_DCS = 2,
+
+	/**
+	 * Understands the passthrough of tmux, which wraps a sequence into a
+	 * device control string ("ESC P tmux; ... ESC \") and doubles each ESC in
+	 * it. A doubled ESC is reported as VTPARSE_ACTION_PUT of a single ESC
+	 * instead of ending the string. The string terminator of a device control
+	 * string is consumed with it and not reported as VTPARSE_ACTION_ESC_DISPATCH,
+	 * and CAN and SUB terminate the string without VTPARSE_ACTION_EXECUTE.
+	 * Meant to be applied on its own.
+	 */
+	VTPARSE_DIALECT_TMUX = 3
+} vtparse_dialect_preset_t;
+
+/**
+ * Tables of a dialect in the layout used by the parser; see vtparse_table.h
+ * for the meaning of the individual tables. Do not modify these directly;
+ * use vtparse_dialect_apply(), which also keeps the derived tables in sync.
+ */
+typedef struct vtparse_dialect {
+	vtparse_state_change_t state_table[VTPARSE_NUM_STATES][256];
+	unsigned char entry_actions[VTPARSE_NUM_STATES];
+	unsigned char exit_actions[VTPARSE_NUM_STATES];
+	vtparse_run_class_t run_classes[VTPARSE_NUM_STATES];
+} vtparse_dialect_t;
+
+/**
+ * Initializes the given dialect with a copy of the built-in dialect.
+ */
+VTPARSE_API void vtparse_dialect_init(vtparse_dialect_t *dialect);
+
+/**
+ * Applies a list of rules to the given dialect. Start the list with
+ * VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x00, 0xFF, 0, 0) and entry and exit
+ * rules for VTPARSE_DIALECT_ANYWHERE to describe a dialect from scratch.
+ *
+ * Actions producing data (VTPARSE_ACTION_PRINT, VTPARSE_ACTION_PUT and
+ * VTPARSE_ACTION_OSC_PUT) are reported as ranges of the input buffer. If such
+ * an action is combined with a change of state or is an entry or exit action,
+ * it is reported as a range of a single byte pointing at vtparse_t.ch instead.
+ *
+ * @param dialect is the dialect to modify.
+ * @param rules points at the rules, terminated by VTPARSE_RULE_END.
+ * @return a non-zero value on success, zero if one of the rules refers to an
+ * invalid state or action or has an empty range of bytes. The dialect is not
+ * modified in this case.
+ */
+VTPARSE_API int vtparse_dialect_apply(vtparse_dialect_t *dialect,
+                                      const vtparse_dialect_rule_t *rules);
+
+/**
+ * Returns the rules of one of the example dialects, to be passed to
+ * vtparse_dialect_apply(), or NULL if the given preset does not exist.
+ */
+VTPARSE_API const vtparse_dialect_rule_t *vtparse_dialect_preset(
+    vtparse_dialect_preset_t preset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_DIALECT_H */
+/* --- end of vtparse/vtparse_dialect.h --- */
+
+/******************************************************************************
+ * Example dialects                                                           *
+ ******************************************************************************/
+
+/* The C1 control characters as commented out in tables/vtparse_tables.rb */
+static const vtparse_dialect_rule_t vtparse_dialect_c1_rules[] = {
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x80, 0x8F, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x90, 0x90, 0,
+                 VTPARSE_STATE_DCS_ENTRY),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x91, 0x97, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x98, 0x98, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x99, 0x9A, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9B, 0x9B, 0,
+                 VTPARSE_STATE_CSI_ENTRY),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9C, 0x9C, 0, VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9D, 0x9D, 0,
+                 VTPARSE_STATE_OSC_STRING),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9E, 0x9F, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0xA0, 0xFF, VTPARSE_ACTION_PRINT, 0),
+    VTPARSE_RULE_END};
+
+/* Device control strings are ignored after their final byte, however they
+   were started */
+static const vtparse_dialect_rule_t vtparse_dialect_no_dcs_rules[] = {
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x40, 0x7E, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x40, 0x7E, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x40, 0x7E, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE_END};
+
+static const vtparse_dialect_rule_t vtparse_dialect_tmux_rules[] = {
+    /* Hook in the transitions into DCS_PASSTHROUGH and unhook in those out
+       of it instead of in its entry and exit actions, such that an escaped
+       ESC can leave and re-enter the state */
+    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_DCS_PASSTHROUGH, 0),
+    VTPARSE_RULE_ON_EXIT(VTPARSE_STATE_DCS_PASSTHROUGH, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x40, 0x7E, VTPARSE_ACTION_HOOK,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x40, 0x7E,
+                 VTPARSE_ACTION_HOOK, VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x40, 0x7E, VTPARSE_ACTION_HOOK,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x18, 0x18,
+                 VTPARSE_ACTION_UNHOOK, VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x1A, 0x1A,
+                 VTPARSE_ACTION_UNHOOK, VTPARSE_STATE_GROUND),
+
+    /* DCS_IGNORE behaves exactly like SOS_PM_APC_STRING; use the latter for
+       malformed device control strings and DCS_IGNORE for an ESC read in
+       DCS_PASSTHROUGH */
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x3A, 0x3A, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x30, 0x3F, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x3A, 0x3A, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x3C, 0x3F, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x1B, 0x1B, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+
+    /* ESC ESC is an escaped ESC and ESC \ terminates the string. Any other
+       byte terminates the string as well and starts the sequence it
+       introduces if this does not require an action. */
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x00, 0xFF, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x1B, 0x1B, VTPARSE_ACTION_PUT,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x50, 0x50, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_DCS_ENTRY),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x58, 0x58, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x5B, 0x5B, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_CSI_ENTRY),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x5D, 0x5D, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_OSC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x5E, 0x5F, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE_END};
+
+/******************************************************************************
+ * Internal functions                                                         *
+ ******************************************************************************/
+
+/**
+ * Returns true if the given rule refers to valid states and actions.
+ */
+static int vtparse_dialect_rule_valid(const vtparse_dialect_rule_t *rule) {
+	if (rule->kind > VTPARSE_RULE_KIND_ON_EXIT ||
+	    rule->state > VTPARSE_NUM_STATES ||
+	    rule->action >= VTPARSE_ACTION_ERROR) {
+		return 0;
+	}
+	if (rule->kind == VTPARSE_RULE_KIND_TRANSITION) {
+		return rule->first <= rule->last && rule->target <= VTPARSE_NUM_STATES;
+	}
+	return 1;
+}
+
+/**
+ * Applies a single valid rule to the state with the given index.
+ */
+static void vtparse_dialect_apply_rule(vtparse_dialect_t *dialect,
+                                       const vtparse_dialect_rule_t *rule,
+                                       unsigned int s) {
+	unsigned int c;
+
+	switch (rule->kind) {
+		case VTPARSE_RULE_KIND_TRANSITION:
+			for (c = rule->first; c <= rule->last; c++) {
+				dialect->state_table[s][c] =
+				    (vtparse_state_change_t)(rule->action | (rule->target << 4));
+			}
+			break;
+		case VTPARSE_RULE_KIND_ON_ENTRY:
+			dialect->entry_actions[s] = (unsigned char)rule->action;
+			break;
+		case VTPARSE_RULE_KIND_ON_EXIT:
+			dialect->exit_actions[s] = (unsigned char)rule->action;
+			break;
+	}
+}
+
+/**
+ * Returns true if the given state change solely consists of an action that
+ * produces data.
+ */
+static int vtparse_dialect_is_data(vtparse_state_change_t change) {
+	return change == VTPARSE_ACTION_PRINT || change == VTPARSE_ACTION_PUT ||
+	       change == VTPARSE_ACTION_OSC_PUT;
+}
+
+/**
+ * Derives the run class of the state with the given index from the state
+ * transition table, like run_class() in tables/vtparse_gen_c_tables.rb. The
+ * vectorized scanners are disabled for states with more than one data action
+ * or too many ranges.
+ */
+static void vtparse_dialect_run_class(vtparse_dialect_t *dialect,
+                                      unsigned int s) {
+	vtparse_run_class_t *cls = &dialect->run_classes[s];
+	vtparse_state_change_t change;
+	unsigned int c, n = 0;
+	int in_range = 0;
+
+	cls->action = 0;
+	cls->num_ranges = 0;
+	for (c = 0; c < VTPARSE_MAX_RUN_RANGES; c++) {
+		cls->lo[c] = 0;
+		cls->hi[c] = 0;
+	}
+	for (c = 0; c < 256U; c++) {
+		change = dialect->state_table[s][c];
+		if (!vtparse_dialect_is_data(change)) {
+			in_range = 0;
+			continue;
+		}
+		if (cls->action && cls->action != change) {
+			cls->num_ranges = 0;
+			return;
+		}
+		cls->action = change;
+		if (!in_range) {
+			if (n == VTPARSE_MAX_RUN_RANGES) {
+				cls->num_ranges = 0;
+				return;
+			}
+			cls->lo[n++] = (unsigned char)c;
+			in_range = 1;
+		}
+		cls->hi[n - 1] = (unsigned char)c;
+		cls->num_ranges = (unsigned char)n;
+	}
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API void vtparse_dialect_init(vtparse_dialect_t *dialect) {
+	unsigned int s, c;
+
+	for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+		for (c = 0; c < 256U; c++) {
+			dialect->state_table[s][c] = STATE_TABLE[s][c];
+		}
+		dialect->entry_actions[s] = ENTRY_ACTIONS[s];
+		dialect->exit_actions[s] = EXIT_ACTIONS[s];
+		dialect->run_classes[s] = RUN_CLASSES[s];
+	}
+}
+
+VTPARSE_API int vtparse_dialect_apply(vtparse_dialect_t *dialect,
+                                      const vtparse_dialect_rule_t *rules) {
+	const vtparse_dialect_rule_t *rule;
+	unsigned int s;
+
+	/* Validate all rules first, such that the dialect stays intact */
+	for (rule = rules; rule->kind != VTPARSE_RULE_KIND_END; rule++) {
+		if (!vtparse_dialect_rule_valid(rule)) {
+			return 0;
+		}
+	}
+
+	/* Expand the rules into the tables */
+	for (rule = rules; rule->kind != VTPARSE_RULE_KIND_END; rule++) {
+		if (rule->state == VTPARSE_DIALECT_ANYWHERE) {
+			for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+				vtparse_dialect_apply_rule(dialect, rule, s);
+			}
+		} else {
+			vtparse_dialect_apply_rule(dialect, rule, rule->state - 1U);
+		}
+	}
+
+	/* Update the tables derived from the state transition table */
+	for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+		vtparse_dialect_run_class(dialect, s);
+	}
+	return 1;
+}
+
+VTPARSE_API const vtparse_dialect_rule_t *vtparse_dialect_preset(
+    vtparse_dialect_preset_t preset) {
+	switch (preset) {
+		case VTPARSE_DIALECT_C1:
+			return vtparse_dialect_c1_rules;
+		case VTPARSE_DIALECT_NO_DCS:
+			return vtparse_dialect_no_dcs_rules;
+		case VTPARSE_DIALECT_TMUX:
+			return vtparse_dialect_tmux_rules;
+	}
+	return 0;
+}
+/* --- end of vtparse/vtparse_dialect.c --- */
+/* --- vtparse/vtparse.c --- */
+
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse.c
+ *
+ * Code implementing the actual parser state machine by wrapping the
+ * auto-generated state-transition tables. This code is based on
+ * https://github.com/haberman/vtparse which was released to the public domain.
+ *
+ * @author Joshua Haberman
+ * @author Andreas Stöckel
+ */
+
+
+/******************************************************************************
+ * Private implementation details                                             *
+ ******************************************************************************/
+
+typedef enum vtparse_cycle {
+	VTPARSE_CYCLE_READ_CHAR = 0,
+	VTPARSE_CYCLE_EXIT_ACTION = 1,
+	VTPARSE_CYCLE_ACTION = 2,
+	VTPARSE_CYCLE_ENTRY_ACTION = 3,
+	VTPARSE_CYCLE_ENTRY_ACTION_DONE = 4,
+	VTPARSE_CYCLE_READ_CHAR_DONE = 5
+} vtparse_cycle_t;
+
+/**
+ * Extracts the action stored in the vtparse.state variable.
+ */
+#define ACTION(state_change) ((state_change & 0x0FU) >> 0)
+
+/**
+ * Extracts the state stored in the vtparse.state variable.
+ */
+#define STATE(state_change) ((state_change & 0xF0U) >> 4)
+
+/**
+ * Returns true if the given state change solely consists of an action that
+ * produces data, i.e. VTPARSE_ACTION_PRINT, VTPARSE_ACTION_PUT or
+ * VTPARSE_ACTION_OSC_PUT.
+ */
+#define IS_DATA_ACTION(state_change)                                   \
+	(((state_change) == VTPARSE_ACTION_PRINT) ||                       \
+	 ((state_change) == VTPARSE_ACTION_PUT) ||                         \
+	 ((state_change) == VTPARSE_ACTION_OSC_PUT))
+
+/**
+ * Returns true if the given character is kept inside VTPARSE_ACTION_PRINT
+ * ranges if VTPARSE_OPTION_LINE_SPANS is set.
+ */
+#define IS_LINE_CHAR(ch) (((ch) == '\n') || ((ch) == '\r') || ((ch) == '\t'))
+
+/**
+ * Inputs up to this length take the small-input fast path in vtparse_parse().
+ */
+#define VTPARSE_SMALL_INPUT_LEN 16U
+
+/**
+ * Keeps the compiler from inlining the given function.
+ */
+#if defined(__GNUC__)
+#define VTPARSE_NOINLINE __attribute__((noinline))
+#else
+#define VTPARSE_NOINLINE
+#endif
+
+/**
+ * Asks the compiler to inline the given function into all of its callers.
+ */
+#if defined(__GNUC__)
+#define VTPARSE_ALWAYS_INLINE __inline__ __attribute__((always_inline))
+#else
+#define VTPARSE_ALWAYS_INLINE
+#endif
+
+/**
+ * Consumes printable characters and line characters starting at buf[n_read]
+ * and counts the line feeds. Returns the index of the first character that
+ * does not belong to the range.
+ */
+static int vtparse_scan_line_span(const vtparse_state_change_t *row,
+                                  const unsigned char *buf, int n_read,
+                                  unsigned int buf_len, int *num_line_breaks) {
+	unsigned char ch;
+	while (n_read < (int)buf_len) {
+		ch = buf[n_read];
+		if (row[ch] != VTPARSE_ACTION_PRINT) {
+			if (!IS_LINE_CHAR(ch)) {
+				break;
+			}
+			*num_line_breaks += (ch == '\n');
+		}
+		n_read++;
+	}
+	return n_read;
+}
+
+/**
+ * Returns a pointer at the i-th parameter, which is either stored in the
+ * params array or in the arena.
+ */
+static int *vtparse_param_ptr(vtparse_t *parser, int i) {
+	if (i < (int)VTPARSE_MAX_PARAMS) {
+		return &parser->params[i];
+	}
+	return &parser->priv_.arena->params[i - VTPARSE_MAX_PARAMS];
+}
+
+/**
+ * Accumulates a single parameter character (a digit or ';') into the params
+ * array.
+ */
+static void vtparse_collect_param(vtparse_t *parser, char ch) {
+	const vtparse_arena_t *arena = parser->priv_.arena;
+	const int max_params =
+	    VTPARSE_MAX_PARAMS + (arena ? arena->max_params : 0U);
+
+	if (ch == ';') {
+		if (parser->num_params < max_params) {
+			parser->num_params += 1;
+			*vtparse_param_ptr(parser, parser->num_params - 1) = 0;
+		} else {
+			parser->error = 1;
+		}
+	} else if (!parser->error) {
+		/* the character is a digit */
+		int *current_param;
+
+		if (parser->num_params == 0) {
+			parser->num_params = 1;
+			parser->params[0] = 0;
+		}
+
+		current_param = vtparse_param_ptr(parser, parser->num_params - 1);
+		*current_param *= 10;
+		*current_param += (ch - '0');
+	}
+}
+
+/**
+ * Appends a character to the intermediate characters.
+ */
+static void vtparse_collect(vtparse_t *parser, char ch) {
+	const vtparse_arena_t *arena = parser->priv_.arena;
+	const int i = parser->num_intermediate_chars;
+
+	if (i < (int)VTPARSE_MAX_INTERMEDIATE_CHARS) {
+		parser->intermediate_chars[i] = ch;
+	} else if (arena && i < (int)(VTPARSE_MAX_INTERMEDIATE_CHARS +
+	                              arena->max_intermediate_chars)) {
+		arena->intermediate_chars[i - VTPARSE_MAX_INTERMEDIATE_CHARS] = ch;
+	} else {
+		parser->error = 1;
+		return;
+	}
+	parser->num_intermediate_chars++;
+}
+
+/**
+ * Runs the recognizer for frequent control sequences on the bytes following
+ * the ESC at buf[0]. Returns the length of the recognized sequence including
+ * the ESC, or zero if the input does not start with one of the sequences or
+ * ends before the sequence is complete.
+ */
+static unsigned int vtparse_sequence_match(const unsigned char *buf,
+                                           unsigned int len, int *sequence) {
+	unsigned int i, state = 1;
+	for (i = 1; i < len; i++) {
+		state = SEQUENCE_DFA[state][SEQUENCE_CLASSES[buf[i]]];
+		if (!state) {
+			return 0;
+		}
+		if (SEQUENCE_ACCEPT[state]) {
+			*sequence = SEQUENCE_ACCEPT[state];
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Collects the parameters and intermediate characters of a sequence found by
+ * vtparse_sequence_match() the way the state machine would. Returns the
+ * dispatch action of the sequence.
+ */
+static vtparse_action_t vtparse_sequence_take(vtparse_t *parser,
+                                              const unsigned char *buf,
+                                              unsigned int len, int sequence) {
+	vtparse_action_t action = VTPARSE_ACTION_ESC_DISPATCH;
+	unsigned int i = 1;
+	unsigned char ch;
+
+	if (buf[1] == '[') {
+		action = VTPARSE_ACTION_CSI_DISPATCH;
+		i = 2;
+	}
+	parser->num_intermediate_chars = 0;
+	parser->num_params = 0;
+	parser->error = 0;
+	for (; i < len - 1; i++) {
+		ch = buf[i];
+		if ((ch >= '0' && ch <= '9') || ch == ';') {
+			vtparse_collect_param(parser, ch);
+		} else {
+			vtparse_collect(parser, ch);
+		}
+	}
+	parser->ch = buf[len - 1];
+	parser->sequence = sequence;
+	return action;
+}
+
+/**
+ * Returns true if the event that is currently returned to the user carries
+ * raw parameter bytes, i.e. is a VTPARSE_ACTION_CSI_DISPATCH or
+ * VTPARSE_ACTION_HOOK event.
+ */
+#define HAS_RAW_PARAMS(parser)                               \
+	(((parser)->action == VTPARSE_ACTION_CSI_DISPATCH) ||    \
+	 ((parser)->action == VTPARSE_ACTION_HOOK))
+
+/**
+ * Called whenever vtparse_parse() returns to the user. Raw parameter bytes
+ * must not outlive the input buffer; decode them unless they belong to the
+ * event being returned.
+ */
+static unsigned int vtparse_return(vtparse_t *parser, int n_read) {
+	if (parser->param_begin &&
+	    !(vtparse_has_event(parser) && HAS_RAW_PARAMS(parser))) {
+		vtparse_decode_params(parser);
+	}
+	return n_read;
+}
+
+/**
+ * Decide whether to pass an action to the user or to handle it internally.
+ * "pos" points at the input byte following the current character.
+ */
+static int vtparse_execute_action(vtparse_t *parser, vtparse_action_t action,
+                                  char ch, const unsigned char *pos) {
+	switch (action) {
+		case VTPARSE_ACTION_PRINT:
+		case VTPARSE_ACTION_PUT:
+		case VTPARSE_ACTION_OSC_PUT:
+			/* Runs of data are handled in vtparse_parse_loop(); this is only
+			   reached for data actions that custom dialects combine with a
+			   change of state. These are reported as a single byte. */
+			return 1;
+
+		case VTPARSE_ACTION_EXECUTE:
+		case VTPARSE_ACTION_HOOK:
+		case VTPARSE_ACTION_OSC_START:
+		case VTPARSE_ACTION_OSC_END:
+		case VTPARSE_ACTION_UNHOOK:
+		case VTPARSE_ACTION_CSI_DISPATCH:
+		case VTPARSE_ACTION_ESC_DISPATCH:
+			if (parser->error) {
+				parser->error = 0;
+				return 0;
+			}
+			return 1;
+
+		case VTPARSE_ACTION_IGNORE:
+			return 0;
+
+		case VTPARSE_ACTION_COLLECT:
+			/* Append the character to the intermediate params */
+			vtparse_collect(parser, ch);
+			return 0;
+
+		case VTPARSE_ACTION_PARAM:
+			/* Just record the location of the raw parameter bytes if lazy
+			   parameter decoding is active and the bytes are contiguous.
+			   Parameter actions are always executed in the same
+			   vtparse_parse() call that read the character. */
+			if ((parser->priv_.options & VTPARSE_OPTION_LAZY_PARAMS) &&
+			    parser->num_params == 0 && !parser->error) {
+				if (!parser->param_begin) {
+					parser->param_begin = pos - 1;
+					parser->param_end = pos;
+					return 0;
+				} else if (parser->param_end == pos - 1) {
+					parser->param_end = pos;
+					return 0;
+				}
+				vtparse_decode_params(parser);
+			}
+			vtparse_collect_param(parser, ch);
+			return 0;
+
+		case VTPARSE_ACTION_CLEAR:
+			parser->num_intermediate_chars = 0;
+			parser->num_params = 0;
+			parser->error = 0;
+			parser->param_begin = 0;
+			parser->param_end = 0;
+			return 0;
+
+		default:
+			/* This line should never be reached */
+			parser->error = 1;
+			return 0;
+	}
+}
+
+/* Transitions inlined by vtparse_parse_loop(), generated from a transition
+   frequency profile by tables/vtparse_gen_hot_transitions.rb */
+#ifndef VTPARSE_NO_HOT_TRANSITIONS
+
+/**
+ * Switches to the given state after an inlined transition, the same way the
+ * VTPARSE_CYCLE_ENTRY_ACTION_DONE cycle does.
+ */
+static void vtparse_hot_enter(vtparse_t *parser, int state,
+                              const unsigned char *pos) {
+	parser->priv_.state = state;
+	if (parser->data_begin == parser->data_end) {
+		parser->action = (vtparse_action_t)0;
+		parser->data_begin = pos;
+		parser->data_end = pos;
+	}
+}
+
+/* --- vtparse/vtparse_hot_transitions.h --- */
+
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_hot_transitions.rb to re-generate this file.            *
+ ******************************************************************************/
+
+/* Included by vtparse.c only. Generated from the profile of
+   3042488 bytes in vtparse_profile.txt; the inlined transitions
+   cover 81.70% of the profiled bytes. */
+
+#ifndef VTPARSE_VTPARSE_HOT_TRANSITIONS_H
+#define VTPARSE_VTPARSE_HOT_TRANSITIONS_H
+
+/**
+ * Performs the transition for the character ch just read at pos[-1] if it
+ * is one of the inlined transitions. Returns zero if the transition must be
+ * performed by the generic code.
+ */
+static int vtparse_hot_transition(vtparse_t *parser, unsigned char ch,
+                                  const unsigned char *pos) {
+	switch (parser->priv_.state) {
+		case VTPARSE_STATE_CSI_PARAM: /* 55.47% */
+			if ((ch >= 0x30 && ch <= 0x39) ||
+			    ch == 0x3b) { /* 55.47% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_PARAM, ch, pos);
+				return 1;
+			}
+			break;
+		case VTPARSE_STATE_GROUND: /* 8.77% */
+			if (ch == 0x1b) { /* 8.77% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_CLEAR, ch, pos);
+				vtparse_hot_enter(parser, VTPARSE_STATE_ESCAPE, pos);
+				return 1;
+			}
+			break;
+		case VTPARSE_STATE_ESCAPE: /* 8.77% */
+			if (ch == 0x5b) { /* 8.77% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_CLEAR, ch, pos);
+				vtparse_hot_enter(parser, VTPARSE_STATE_CSI_ENTRY, pos);
+				return 1;
+			}
+			break;
+		case VTPARSE_STATE_CSI_ENTRY: /* 8.69% */
+			if (ch >= 0x30 && ch <= 0x39) { /* 8.69% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_PARAM, ch, pos);
+				vtparse_hot_enter(parser, VTPARSE_STATE_CSI_PARAM, pos);
+				return 1;
+			}
+			break;
+	}
+	return 0;
+}
+
+#endif /* VTPARSE_VTPARSE_HOT_TRANSITIONS_H */
+/* --- end of vtparse/vtparse_hot_transitions.h --- */
+#endif
+
+#ifdef VTPARSE_STRIDE2
+/**
+ * Performs pairs of transitions that do not return to the user with a single
+ * lookup in the stride-2 table per pair, starting at buf[n_read]. Returns the
+ * index of the first byte that was not consumed.
+ */
+static int vtparse_parse_stride2(vtparse_t *parser, const unsigned char *buf,
+                                 int n_read, unsigned int buf_len) {
+	vtparse_private_t *priv = &parser->priv_;
+	const unsigned char *entry, *op, *pos;
+	const int n_start = n_read;
+	unsigned int i;
+
+	while (n_read + 1 < (int)buf_len) {
+		entry = STRIDE2_OPS[STRIDE2_TABLE[priv->state - 1]
+		                                 [BYTE_CLASSES[buf[n_read]]]
+		                                 [BYTE_CLASSES[buf[n_read + 1]]]];
+		if (!entry[0]) {
+			break;
+		}
+		for (i = 0, op = entry + 2; i < entry[1]; i++, op++) {
+			pos = buf + n_read + ((*op >> 4) & 1U) + 1;
+			if (ACTION(*op)) {
+				vtparse_execute_action(parser, (vtparse_action_t)ACTION(*op), pos[-1], pos);
+			}
+			if ((*op & 0x20U) && parser->data_begin == parser->data_end) {
+				/* Same as VTPARSE_CYCLE_ENTRY_ACTION_DONE */
+				parser->action = (vtparse_action_t)0;
+				parser->data_begin = pos;
+				parser->data_end = pos;
+			}
+		}
+		priv->state = entry[0];
+		n_read += 2;
+	}
+	if (n_read > n_start) {
+		parser->ch = buf[n_read - 1];
+	}
+	return n_read;
+}
+#endif
+
+static int vtparse_handle_action(vtparse_t *parser, vtparse_action_t action,
+                                 const unsigned char *pos) {
+	vtparse_private_t *priv = &parser->priv_;
+	int must_return = 0;
+
+	if (action && vtparse_execute_action(parser, action, parser->ch, pos)) {
+		/* Before we can return the actual action, we need to return some
+		   previously buffered data */
+		if (parser->data_end - parser->data_begin) {
+			return 1; /* Need to return to the user */
+		}
+
+		/* Return this action to the user if the user is interested in it */
+		if (priv->event_mask & VTPARSE_EVENT_MASK(action)) {
+			parser->action = action;
+			must_return = 1;
+			if (IS_DATA_ACTION(action)) {
+				/* The byte may belong to the previous input buffer */
+				parser->data_begin = (const unsigned char *)&parser->ch;
+				parser->data_end = parser->data_begin + 1;
+			}
+		} else if (action == VTPARSE_ACTION_CSI_DISPATCH ||
+		           action == VTPARSE_ACTION_HOOK) {
+			/* Nobody is interested in the raw parameters */
+			parser->param_begin = 0;
+			parser->param_end = 0;
+		}
+	}
+
+	/* Go to the next cycle */
+	priv->cycle = (!STATE(priv->change)) ? VTPARSE_CYCLE_READ_CHAR_DONE
+	                                     : (priv->cycle + 1);
+	return must_return;
+}
+
+/**
+ * Runs the state machine starting at buf[n_read]. This is the main part of
+ * vtparse_parse(); it is kept out of line so the small-input fast path in
+ * vtparse_parse() does not pay for its stack frame.
+ */
+static VTPARSE_NOINLINE unsigned int vtparse_parse_loop(
+    vtparse_t *parser, const unsigned char *buf, unsigned int buf_len,
+    int n_read) {
+	unsigned char ch;
+	vtparse_state_change_t change;
+
+	/* Convenient reference at the private data */
+	vtparse_private_t *priv = &parser->priv_;
+
+	/* Tables of the dialect; the specialized fast paths below only apply to
+	   the built-in dialect */
+	const vtparse_dialect_t *dialect = priv->dialect;
+	const vtparse_state_change_t *table =
+	    dialect ? dialect->state_table[0] : STATE_TABLE[0];
+	const vtparse_run_class_t *run_classes =
+	    dialect ? dialect->run_classes : RUN_CLASSES;
+
+	while (1) {
+		switch (priv->cycle) {
+			/* Read the next character from the input and determine whether the
+			   state changes. Abort if we are at the end of the input buffer. */
+			case VTPARSE_CYCLE_READ_CHAR: {
+				unsigned int seq_len;
+				int sequence;
+
+#ifdef VTPARSE_STRIDE2
+				/* Consume two bytes per lookup while possible; leave an ESC
+				   in the ground state to the sequence recognizer */
+				if (!dialect && (priv->state != VTPARSE_STATE_GROUND ||
+				                 !(priv->options & VTPARSE_OPTION_SEQUENCES))) {
+					n_read = vtparse_parse_stride2(parser, buf, n_read, buf_len);
+				}
+#endif
+
+				/* Return if we have reached the end of the buffer */
+				if (n_read >= (int)buf_len) {
+					/* Switch to a different state to indicate that we actually
+					   have data waiting for the user */
+					if (parser->data_begin != parser->data_end) {
+						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+					}
+					return vtparse_return(parser, n_read);
+				}
+
+				/* Read the next character */
+				parser->ch = ch = buf[n_read++];
+
+				/* Determine which state change is required */
+				priv->change = change = table[((priv->state - 1) << 8) + ch];
+
+				/* Match frequent control sequences as a whole */
+				if (ch == 0x1B && (priv->options & VTPARSE_OPTION_SEQUENCES) &&
+				    priv->state == VTPARSE_STATE_GROUND && !dialect &&
+				    (seq_len = vtparse_sequence_match(buf + n_read - 1,
+				                                      buf_len - n_read + 1,
+				                                      &sequence))) {
+					/* Return pending data first; the ESC is read again in
+					   the next call */
+					if (parser->data_begin != parser->data_end) {
+						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+						return vtparse_return(parser, n_read - 1);
+					}
+					n_read += seq_len - 1;
+					change = vtparse_sequence_take(
+					    parser, buf + n_read - seq_len, seq_len, sequence);
+					if (priv->event_mask & VTPARSE_EVENT_MASK(change)) {
+						parser->action = (vtparse_action_t)change;
+						parser->data_begin = buf + n_read;
+						parser->data_end = buf + n_read;
+						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+						return vtparse_return(parser, n_read);
+					}
+					parser->sequence = VTPARSE_SEQUENCE_NONE;
+					break;
+				}
+
+#ifndef VTPARSE_NO_HOT_TRANSITIONS
+				/* Frequent transitions that do not return to the user skip
+				   the action cycles */
+				if (!dialect && vtparse_hot_transition(parser, ch, buf + n_read)) {
+					break;
+				}
+#endif
+
+				if (STATE(change)) {
+					priv->cycle = VTPARSE_CYCLE_EXIT_ACTION;
+				} else if (IS_DATA_ACTION(change) ||
+				           (change == VTPARSE_ACTION_EXECUTE &&
+				            (priv->options & VTPARSE_OPTION_LINE_SPANS) &&
+				            priv->state == VTPARSE_STATE_GROUND &&
+				            IS_LINE_CHAR(ch))) {
+					/* Fast path for actions producing data: consume the entire
+					   run of characters triggering the same action at once */
+					const unsigned char *run = buf + n_read - 1;
+					const vtparse_state_change_t *row =
+					    table + ((priv->state - 1) << 8);
+					int num_line_breaks = 0;
+
+					/* Data is returned as a contiguous range; return pending
+					   data first if the run does not directly follow it. The
+					   current character is read again in the next call. */
+					if (parser->data_begin != parser->data_end &&
+					    parser->data_end != run) {
+						priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+						return vtparse_return(parser, n_read - 1);
+					}
+					if (priv->state == VTPARSE_STATE_GROUND &&
+					    (priv->options & VTPARSE_OPTION_LINE_SPANS)) {
+						/* Keep line breaks inside the printed range */
+						change = VTPARSE_ACTION_PRINT;
+						num_line_breaks = (ch == '\n');
+						n_read = vtparse_scan_line_span(row, buf, n_read, buf_len,
+						                                &num_line_breaks);
+					} else if (buf_len - n_read >= VTPARSE_SCAN_MIN_LEN &&
+					           row[buf[n_read]] == change &&
+					           priv->kernels->scan_ground &&
+					           run_classes[priv->state - 1].num_ranges) {
+						/* Long run; hand over to the vectorized scanner */
+						n_read = (priv->state == VTPARSE_STATE_GROUND
+						              ? priv->kernels->scan_ground
+						              : priv->kernels->scan_string)(
+						    &run_classes[priv->state - 1], buf, n_read, buf_len);
+					} else {
+						while (n_read < (int)buf_len && row[buf[n_read]] == change) {
+							n_read++;
+						}
+					}
+					parser->ch = buf[n_read - 1];
+
+					/* Skip the data if the user is not interested in it */
+					if (priv->event_mask & VTPARSE_EVENT_MASK(change)) {
+						if (parser->data_begin == parser->data_end) {
+							parser->data_begin = run;
+							parser->num_line_breaks = 0;
+						}
+						parser->data_end = buf + n_read;
+						parser->num_line_breaks += num_line_breaks;
+						parser->action = (vtparse_action_t)change;
+					}
+				} else if (ACTION(change)) {
+					priv->cycle = VTPARSE_CYCLE_ACTION;
+				}
+				break;
+			}
+
+			/* Execute the exit action for the last state the parser was in */
+			case VTPARSE_CYCLE_EXIT_ACTION:
+				if (vtparse_handle_action(
+				        parser,
+				        (vtparse_action_t)(dialect ? dialect->exit_actions
+				                                   : EXIT_ACTIONS)[priv->state - 1],
+				        buf + n_read)) {
+					/* Return to the user if necessary */
+					return vtparse_return(parser, n_read);
+				}
+				break;
+
+			/* Execute the action associated with the character read above */
+			case VTPARSE_CYCLE_ACTION:
+				if (vtparse_handle_action(parser,
+				                          (vtparse_action_t)ACTION(priv->change),
+				                          buf + n_read)) {
+					/* Return to the user if necessary */
+					return vtparse_return(parser, n_read);
+				}
+				break;
+
+			/* Execute the entry action if there was a state change */
+			case VTPARSE_CYCLE_ENTRY_ACTION:
+				if (vtparse_handle_action(
+				        parser,
+				        (vtparse_action_t)(dialect ? dialect->entry_actions
+				                                   : ENTRY_ACTIONS)[STATE(priv->change) - 1],
+				        buf + n_read)) {
+					/* Return to the user if necessary */
+					return vtparse_return(parser, n_read);
+				}
+				break;
+
+			/* Transition to the next state */
+			case VTPARSE_CYCLE_ENTRY_ACTION_DONE:
+				priv->cycle = VTPARSE_CYCLE_READ_CHAR;
+				priv->state = STATE(priv->change);
+
+				/* Set data_begin/data_end if there is no data waiting. This is
+				   relevant when recovering from error conditions. */
+				if (parser->data_begin == parser->data_end) {
+					parser->action = (vtparse_action_t)0;
+					parser->data_begin = buf + n_read;
+					parser->data_end = buf + n_read;
+				}
+
+				break;
+
+			/* Transition back to the READ_CHAR state */
+			case VTPARSE_CYCLE_READ_CHAR_DONE:
+				priv->cycle = VTPARSE_CYCLE_READ_CHAR;
+				break;
+		}
+	}
+	return n_read;
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API void vtparse_init(vtparse_t *parser) {
+	unsigned int i;
+
+	/* Reset all non-array fields */
+	parser->action = (vtparse_action_t)0;
+	parser->ch = 0;
+	parser->num_params = 0;
+	parser->num_intermediate_chars = 0;
+	parser->error = 0;
+	parser->sequence = VTPARSE_SEQUENCE_NONE;
+	parser->data_begin = 0;
+	parser->data_end = 0;
+	parser->num_line_breaks = 0;
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Reset all arrays */
+	for (i = 0; i < VTPARSE_MAX_PARAMS; i++) {
+		parser->params[i] = 0;
+	}
+	for (i = 0; i < VTPARSE_MAX_INTERMEDIATE_CHARS; i++) {
+		parser->intermediate_chars[i] = 0;
+	}
+
+	/* Reset the private data */
+	parser->priv_.event_mask = VTPARSE_EVENT_MASK_ALL;
+	parser->priv_.options = 0;
+	parser->priv_.arena = 0;
+	parser->priv_.kernels = vtparse_get_kernels();
+	parser->priv_.dialect = 0;
+	parser->priv_.max_bytes = VTPARSE_BUDGET_UNLIMITED;
+	parser->priv_.max_events = VTPARSE_BUDGET_UNLIMITED;
+	parser->priv_.used_bytes = 0;
+	parser->priv_.used_events = 0;
+	parser->priv_.change = 0;
+	parser->priv_.cycle = VTPARSE_CYCLE_READ_CHAR;
+	parser->priv_.state = VTPARSE_STATE_GROUND;
+}
+
+static VTPARSE_ALWAYS_INLINE unsigned int vtparse_parse_unbounded(
+    vtparse_t *parser, const unsigned char *buf, unsigned int buf_len) {
+	/* Number of characters read from the input */
+	int n_read = 0;
+
+	/* Convenient reference at the private data */
+	vtparse_private_t *priv = &parser->priv_;
+
+	/* Reset the "data" pointers in the parser instance to indicate that we have
+	   not processed any characters so far. */
+	parser->data_begin = buf;
+	parser->data_end = buf;
+
+	/* Raw parameter bytes are only valid until the next call */
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Only set by the sequence recognizer for the event it returns */
+	parser->sequence = VTPARSE_SEQUENCE_NONE;
+
+	/* Skip the round trip through the state machine loop after data was
+	   returned in the last call */
+	if (priv->cycle == VTPARSE_CYCLE_READ_CHAR_DONE) {
+		priv->cycle = VTPARSE_CYCLE_READ_CHAR;
+	}
+
+	/* Fast path for tiny inputs, such as echoed keystrokes: consume leading
+	   printable characters in the ground state without entering the loop. If
+	   the entire buffer is printable, return right away. */
+	if (buf_len <= VTPARSE_SMALL_INPUT_LEN &&
+	    priv->cycle == VTPARSE_CYCLE_READ_CHAR &&
+	    priv->state == VTPARSE_STATE_GROUND) {
+		const vtparse_state_change_t *row =
+		    priv->dialect ? priv->dialect->state_table[VTPARSE_STATE_GROUND - 1]
+		                  : STATE_TABLE[VTPARSE_STATE_GROUND - 1];
+		while (n_read < (int)buf_len && row[buf[n_read]] == VTPARSE_ACTION_PRINT) {
+			n_read++;
+		}
+		if (n_read > 0) {
+			parser->ch = buf[n_read - 1];
+			if (priv->event_mask & VTPARSE_EVENT_MASK(VTPARSE_ACTION_PRINT)) {
+				parser->action = VTPARSE_ACTION_PRINT;
+				parser->data_end = buf + n_read;
+				parser->num_line_breaks = 0;
+			}
+		}
+		if (n_read == (int)buf_len) {
+			if (parser->data_begin != parser->data_end) {
+				priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+			}
+			return n_read;
+		}
+
+		/* Likewise, directly return a leading control character (e.g. a
+		   backspace or line feed) that is executed in the ground state */
+		if (n_read == 0 &&
+		    row[buf[0]] == VTPARSE_ACTION_EXECUTE && !parser->error &&
+		    (priv->event_mask & VTPARSE_EVENT_MASK(VTPARSE_ACTION_EXECUTE)) &&
+		    !((priv->options & VTPARSE_OPTION_LINE_SPANS) &&
+		      IS_LINE_CHAR(buf[0]))) {
+			parser->ch = buf[0];
+			parser->action = VTPARSE_ACTION_EXECUTE;
+			priv->change = VTPARSE_ACTION_EXECUTE;
+			priv->cycle = VTPARSE_CYCLE_READ_CHAR_DONE;
+			return 1U;
+		}
+	}
+
+	return vtparse_parse_loop(parser, buf, buf_len, n_read);
+}
+
+static VTPARSE_NOINLINE unsigned int vtparse_parse_bounded(
+    vtparse_t *parser, const unsigned char *buf, unsigned int buf_len) {
+	unsigned int n_read;
+	vtparse_private_t *priv = &parser->priv_;
+
+	/* Only hand the remaining number of bytes to the parser; once the event
+	   budget is exhausted, only drain the events pending for bytes that have
+	   already been consumed */
+	if (priv->max_bytes && buf_len > priv->max_bytes - priv->used_bytes) {
+		buf_len = priv->max_bytes - priv->used_bytes;
+	}
+	if (priv->max_events && priv->used_events >= priv->max_events) {
+		buf_len = 0;
+	}
+
+	n_read = vtparse_parse_unbounded(parser, buf, buf_len);
+	priv->used_bytes += n_read;
+	if (vtparse_has_event(parser)) {
+		priv->used_events++;
+	}
+	return n_read;
+}
+
+VTPARSE_API unsigned int vtparse_parse(vtparse_t *parser,
+                                       const unsigned char *buf,
+                                       unsigned int buf_len) {
+	if (parser->priv_.max_bytes | parser->priv_.max_events) {
+		return vtparse_parse_bounded(parser, buf, buf_len);
+	}
+	return vtparse_parse_unbounded(parser, buf, buf_len);
+}
+
+VTPARSE_API void vtparse_set_event_mask(vtparse_t *parser,
+                                        unsigned int event_mask) {
+	parser->priv_.event_mask = event_mask;
+}
+
+VTPARSE_API void vtparse_set_options(vtparse_t *parser, unsigned int options) {
+	parser->priv_.options = options;
+}
+
+VTPARSE_API void vtparse_set_arena(vtparse_t *parser,
+                                   const vtparse_arena_t *arena) {
+	parser->priv_.arena = arena;
+}
+
+VTPARSE_API void vtparse_set_dialect(vtparse_t *parser,
+                                     const vtparse_dialect_t *dialect) {
+	parser->priv_.dialect = dialect;
+}
+
+VTPARSE_API void vtparse_set_budget(vtparse_t *parser, unsigned int max_bytes,
+                                    unsigned int max_events) {
+	parser->priv_.max_bytes = max_bytes;
+	parser->priv_.max_events = max_events;
+	parser->priv_.used_bytes = 0;
+	parser->priv_.used_events = 0;
+}
+
+VTPARSE_API void vtparse_renew_budget(vtparse_t *parser) {
+	parser->priv_.used_bytes = 0;
+	parser->priv_.used_events = 0;
+}
+
+VTPARSE_API void vtparse_get_budget_used(const vtparse_t *parser,
+                                         unsigned int *bytes,
+                                         unsigned int *events) {
+	if (bytes) {
+		*bytes = parser->priv_.used_bytes;
+	}
+	if (events) {
+		*events = parser->priv_.used_events;
+	}
+}
+
+VTPARSE_API int vtparse_budget_exhausted(const vtparse_t *parser) {
+	const vtparse_private_t *priv = &parser->priv_;
+	return (priv->max_bytes && priv->used_bytes >= priv->max_bytes) ||
+	       (priv->max_events && priv->used_events >= priv->max_events);
+}
+
+VTPARSE_API int vtparse_get_param(const vtparse_t *parser, unsigned int i) {
+	if (i >= (unsigned int)parser->num_params) {
+		return 0;
+	} else if (i < VTPARSE_MAX_PARAMS) {
+		return parser->params[i];
+	}
+	return parser->priv_.arena->params[i - VTPARSE_MAX_PARAMS];
+}
+
+VTPARSE_API unsigned char vtparse_get_intermediate_char(const vtparse_t *parser,
+                                                       unsigned int i) {
+	if (i >= (unsigned int)parser->num_intermediate_chars) {
+		return 0;
+	} else if (i < VTPARSE_MAX_INTERMEDIATE_CHARS) {
+		return parser->intermediate_chars[i];
+	}
+	return parser->priv_.arena
+	    ->intermediate_chars[i - VTPARSE_MAX_INTERMEDIATE_CHARS];
+}
+
+VTPARSE_API void vtparse_decode_params(vtparse_t *parser) {
+	const unsigned char *p = parser->param_begin, *end = parser->param_end;
+	const vtparse_kernels_t *kernels = parser->priv_.kernels;
+	int n;
+
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Use the accelerated decoder for the common case of a short parameter
+	   list; fall back to the generic code if it spills into the arena */
+	if (kernels->decode_params && p < end && parser->num_params == 0 &&
+	    !parser->error) {
+		if ((n = kernels->decode_params(parser->params, p, end)) >= 0) {
+			parser->num_params = n;
+			return;
+		}
+	}
+	for (; p < end; p++) {
+		vtparse_collect_param(parser, *p);
+	}
+}
+
+VTPARSE_API int vtparse_has_event(const vtparse_t *parser) {
+	return parser->priv_.cycle != VTPARSE_CYCLE_READ_CHAR;
+}
+
+VTPARSE_API void vtparse_compact_init(vtparse_compact_t *compact) {
+	unsigned int i;
+
+	compact->state = VTPARSE_STATE_GROUND;
+	compact->error = 0;
+	compact->num_params = 0;
+	compact->num_intermediate_chars = 0;
+	for (i = 0; i < VTPARSE_COMPACT_MAX_PARAMS; i++) {
+		compact->params[i] = 0;
+	}
+	for (i = 0; i < VTPARSE_MAX_INTERMEDIATE_CHARS; i++) {
+		compact->intermediate_chars[i] = 0;
+	}
+}
+
+VTPARSE_API int vtparse_suspend(const vtparse_t *parser,
+                                vtparse_compact_t *compact) {
+	return vtparse_suspend_spill(parser, compact, 0, 0U);
+}
+
+VTPARSE_API int vtparse_suspend_spill(const vtparse_t *parser,
+                                      vtparse_compact_t *compact,
+                                      unsigned short *spill,
+                                      unsigned int max_spill) {
+	int i, param;
+
+	/* We cannot store pending events */
+	if (vtparse_has_event(parser)) {
+		return 0;
+	}
+
+	/* Parameters and intermediate characters are only relevant while the
+	   state machine is not in the ground state; they are cleared upon entering
+	   one of the states collecting them. */
+	vtparse_compact_init(compact);
+	compact->state = parser->priv_.state;
+	if (compact->state == VTPARSE_STATE_GROUND) {
+		return 1;
+	}
+
+	/* Store the first parameters in the compact state and the remaining ones
+	   in the spill storage. Sequences that do not fit are dropped. */
+	compact->error = parser->error ? 1 : 0;
+	if (parser->num_params >
+	    (int)(VTPARSE_COMPACT_MAX_PARAMS + max_spill) ||
+	    parser->num_params > 0xFF) {
+		compact->error = 1;
+	} else {
+		for (i = 0; i < parser->num_params; i++) {
+			param = vtparse_get_param(parser, i);
+			if (param < 0 || param > 0xFFFF) {
+				compact->error = 1;
+				break;
+			} else if (i < (int)VTPARSE_COMPACT_MAX_PARAMS) {
+				compact->params[i] = param;
+			} else {
+				spill[i - VTPARSE_COMPACT_MAX_PARAMS] = param;
+			}
+		}
+		compact->num_params = compact->error ? 0 : parser->num_params;
+	}
+	if (parser->num_intermediate_chars >
+	    (int)VTPARSE_MAX_INTERMEDIATE_CHARS) {
+		compact->error = 1;
+	} else {
+		compact->num_intermediate_chars = parser->num_intermediate_chars;
+		for (i = 0; i < parser->num_intermediate_chars; i++) {
+			compact->intermediate_chars[i] = parser->intermediate_chars[i];
+		}
+	}
+	return 1;
+}
+
+VTPARSE_API void vtparse_resume(vtparse_t *parser,
+                                const vtparse_compact_t *compact) {
+	vtparse_resume_spill(parser, compact, 0);
+}
+
+VTPARSE_API void vtparse_resume_spill(vtparse_t *parser,
+                                      const vtparse_compact_t *compact,
+                                      const unsigned short *spill) {
+	const vtparse_arena_t *arena = parser->priv_.arena;
+	const int max_params =
+	    VTPARSE_MAX_PARAMS + (arena ? arena->max_params : 0U);
+	int i;
+
+	/* Reset the transient per-call fields */
+	parser->action = (vtparse_action_t)0;
+	parser->ch = 0;
+	parser->sequence = VTPARSE_SEQUENCE_NONE;
+	parser->data_begin = 0;
+	parser->data_end = 0;
+	parser->num_line_breaks = 0;
+	parser->param_begin = 0;
+	parser->param_end = 0;
+
+	/* Restore the partially parsed control sequence */
+	parser->error = compact->error;
+	parser->num_params = compact->num_params;
+	if (parser->num_params > max_params ||
+	    (parser->num_params > (int)VTPARSE_COMPACT_MAX_PARAMS && !spill)) {
+		parser->error = 1;
+		parser->num_params = 0;
+	}
+	for (i = 0; i < parser->num_params; i++) {
+		if (i < (int)VTPARSE_COMPACT_MAX_PARAMS) {
+			*vtparse_param_ptr(parser, i) = compact->params[i];
+		} else {
+			*vtparse_param_ptr(parser, i) =
+			    spill[i - VTPARSE_COMPACT_MAX_PARAMS];
+		}
+	}
+	parser->num_intermediate_chars = compact->num_intermediate_chars;
+	for (i = 0; i < compact->num_intermediate_chars; i++) {
+		parser->intermediate_chars[i] = compact->intermediate_chars[i];
+	}
+	parser->intermediate_chars[compact->num_intermediate_chars] = 0;
+
+	/* Restore the state machine */
+	parser->priv_.change = 0;
+	parser->priv_.cycle = VTPARSE_CYCLE_READ_CHAR;
+	parser->priv_.state = compact->state;
+}
+
+VTPARSE_API const char *vtparse_action_str(vtparse_action_t action) {
+	if (action > VTPARSE_ACTION_ERROR) {
+		return "<invalid>";
+	}
+	return ACTION_NAMES[action];
+}
+
+VTPARSE_API const char *vtparse_state_str(int state) {
+	if (state < 0 || state > VTPARSE_NUM_STATES) {
+		return "<invalid>";
+	}
+	return STATE_NAMES[state];
+}
+
+VTPARSE_API const char *vtparse_sequence_str(int sequence) {
+	if (sequence < 0 ||
+	    sequence >= (int)(sizeof(SEQUENCE_NAMES) / sizeof(SEQUENCE_NAMES[0]))) {
+		return "<invalid>";
+	}
+	return SEQUENCE_NAMES[sequence];
+}
+/* --- end of vtparse/vtparse.c --- */
+
+#endif /* VTPARSE_VTPARSE_AMALGAMATED_H */
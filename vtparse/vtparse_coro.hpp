@@ -0,0 +1,506 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_coro.hpp
+ *
+ * Optional C++20 coroutine interface on top of vtparse.hpp. generate()
+ * returns a vtparse::event_generator that lazily yields the events of a
+ * buffer:
+ *
+ *     vtparse::parser p;
+ *     for (const vtparse::event &e : vtparse::generate(p, buf)) {
+ *         ...
+ *     }
+ *
+ * async_parse() returns a vtparse::task that reads buffers from an
+ * asynchronous byte source and passes the events to a visitor:
+ *
+ *     std::size_t n = co_await vtparse::async_parse(p, source, buf,
+ *                                                   sizeof(buf), visitor);
+ *
+ * Both allocate a single coroutine frame when called; events are yielded or
+ * passed to the visitor without any further allocation. Pass
+ * std::allocator_arg and a vtparse::frame_arena as the first two arguments
+ * to place the frame in caller-supplied memory instead of on the heap.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_CORO_HPP
+#define VTPARSE_VTPARSE_CORO_HPP
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <vtparse/vtparse.hpp>
+
+namespace vtparse {
+
+/**
+ * Caller-supplied memory for coroutine frames. Frames are allocated from the
+ * front of the buffer; space is reclaimed when frames are destroyed in the
+ * reverse order of their creation, and the whole buffer is reclaimed once no
+ * frame is alive. If the buffer is exhausted, frames are allocated on the
+ * heap instead. The buffer must be aligned to
+ * __STDCPP_DEFAULT_NEW_ALIGNMENT__ and outlive all frames allocated from it.
+ */
+class frame_arena {
+public:
+	frame_arena(void *buf, std::size_t size) noexcept
+	    : buf_(static_cast<unsigned char *>(buf)), size_(size), top_(0),
+	      live_(0) {}
+
+	frame_arena(const frame_arena &) = delete;
+	frame_arena &operator=(const frame_arena &) = delete;
+
+	/**
+	 * Returns size bytes from the buffer or nullptr if they do not fit.
+	 */
+	void *allocate(std::size_t size) noexcept {
+		void *ptr;
+		size = align(size);
+		if (size > size_ - top_) {
+			return nullptr;
+		}
+		ptr = buf_ + top_;
+		top_ += size;
+		live_++;
+		return ptr;
+	}
+
+	/**
+	 * Releases memory obtained from allocate().
+	 */
+	void deallocate(void *ptr, std::size_t size) noexcept {
+		size = align(size);
+		if (static_cast<unsigned char *>(ptr) + size == buf_ + top_) {
+			top_ -= size;
+		}
+		if (--live_ == 0) {
+			top_ = 0;
+		}
+	}
+
+	/**
+	 * Number of bytes currently in use.
+	 */
+	std::size_t used() const noexcept { return top_; }
+
+private:
+	static constexpr std::size_t ALIGN = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+	static std::size_t align(std::size_t size) noexcept {
+		return (size + ALIGN - 1) & ~(ALIGN - 1);
+	}
+
+	unsigned char *buf_;
+	std::size_t size_;
+	std::size_t top_;
+	std::size_t live_;
+};
+
+/**
+ * frame_arena with N bytes of inline storage, e.g. as a member of the object
+ * owning the coroutine. A few hundred bytes suffice for the frames of
+ * generate() and async_parse().
+ */
+template <std::size_t N>
+class frame_buffer : public frame_arena {
+public:
+	frame_buffer() noexcept : frame_arena(storage_, N) {}
+
+private:
+	alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) unsigned char storage_[N];
+};
+
+namespace detail {
+
+/**
+ * Base class of the promise types. A coroutine whose first two parameters
+ * are std::allocator_arg and a frame_arena pointer allocates its frame from
+ * that arena (unless the pointer is null); all others use the heap. The
+ * origin of the frame is stored in a header in front of it.
+ */
+class frame_allocator {
+public:
+	static void *operator new(std::size_t size) {
+		return allocate(nullptr, size);
+	}
+
+	template <typename... Args>
+	static void *operator new(std::size_t size, std::allocator_arg_t,
+	                          frame_arena *arena, const Args &...) {
+		return allocate(arena, size);
+	}
+
+	static void operator delete(void *ptr, std::size_t size) noexcept {
+		unsigned char *base = static_cast<unsigned char *>(ptr) - HEADER;
+		frame_arena *arena = *reinterpret_cast<frame_arena **>(base);
+		if (arena) {
+			arena->deallocate(base, size + HEADER);
+		} else {
+			::operator delete(base);
+		}
+	}
+
+private:
+	static constexpr std::size_t HEADER = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	static_assert(HEADER >= sizeof(frame_arena *));
+
+	/* Not inlined; GCC otherwise pairs the frame released by operator delete
+	   with the ::operator new below and warns about a mismatch */
+	[[gnu::noinline]] static void *allocate(frame_arena *arena,
+	                                        std::size_t size) {
+		unsigned char *base = nullptr;
+		if (arena) {
+			base = static_cast<unsigned char *>(arena->allocate(size + HEADER));
+		}
+		if (!base) {
+			base = static_cast<unsigned char *>(::operator new(size + HEADER));
+			arena = nullptr;
+		}
+		*reinterpret_cast<frame_arena **>(base) = arena;
+		return base + HEADER;
+	}
+};
+
+}  // namespace detail
+
+/**
+ * Coroutine lazily yielding vtparse::event instances; a coroutine returning
+ * an event_generator uses co_yield to produce events and must not use
+ * co_await. The yielded events are views and are valid until the iterator is
+ * advanced.
+ */
+class event_generator {
+public:
+	class promise_type : public detail::frame_allocator {
+	public:
+		event_generator get_return_object() noexcept {
+			return event_generator(handle::from_promise(*this));
+		}
+
+		std::suspend_always initial_suspend() const noexcept { return {}; }
+		std::suspend_always final_suspend() const noexcept { return {}; }
+
+		std::suspend_always yield_value(const event &e) noexcept {
+			value_ = &e;
+			return {};
+		}
+
+		void return_void() const noexcept {}
+
+		void unhandled_exception() noexcept {
+			exception_ = std::current_exception();
+		}
+
+		template <typename T>
+		std::suspend_never await_transform(T &&) = delete;
+
+	private:
+		friend class event_generator;
+
+		const event *value_ = nullptr;
+		std::exception_ptr exception_;
+	};
+
+	using handle = std::coroutine_handle<promise_type>;
+
+	class iterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = event;
+		using difference_type = std::ptrdiff_t;
+		using pointer = const event *;
+		using reference = const event &;
+
+		explicit iterator(handle h) noexcept : h_(h) {}
+
+		const event &operator*() const noexcept { return *h_.promise().value_; }
+
+		iterator &operator++() {
+			advance(h_);
+			return *this;
+		}
+
+		void operator++(int) { advance(h_); }
+
+		friend bool operator==(const iterator &it,
+		                       std::default_sentinel_t) noexcept {
+			return it.h_.done();
+		}
+
+	private:
+		handle h_;
+	};
+
+	event_generator(event_generator &&o) noexcept
+	    : h_(std::exchange(o.h_, nullptr)) {}
+
+	event_generator &operator=(event_generator &&o) noexcept {
+		if (this != &o) {
+			if (h_) {
+				h_.destroy();
+			}
+			h_ = std::exchange(o.h_, nullptr);
+		}
+		return *this;
+	}
+
+	~event_generator() {
+		if (h_) {
+			h_.destroy();
+		}
+	}
+
+	/**
+	 * Runs the coroutine up to the first event. Must only be called once.
+	 */
+	iterator begin() {
+		advance(h_);
+		return iterator(h_);
+	}
+
+	std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+	explicit event_generator(handle h) noexcept : h_(h) {}
+
+	static void advance(handle h) {
+		h.resume();
+		if (h.promise().exception_) {
+			std::rethrow_exception(std::exchange(h.promise().exception_, nullptr));
+		}
+	}
+
+	handle h_;
+};
+
+/**
+ * Lazily started coroutine producing a value of type T, which must be default
+ * constructible. Either co_await the task from another coroutine, or call
+ * start() and wait for done() to become true, resuming the coroutines the
+ * task is waiting for in the meantime.
+ */
+template <typename T>
+class task {
+public:
+	class promise_type : public detail::frame_allocator {
+	public:
+		task get_return_object() noexcept {
+			return task(handle::from_promise(*this));
+		}
+
+		std::suspend_always initial_suspend() const noexcept { return {}; }
+
+		auto final_suspend() const noexcept {
+			struct final_awaiter {
+				bool await_ready() const noexcept { return false; }
+				std::coroutine_handle<> await_suspend(handle h) const noexcept {
+					std::coroutine_handle<> c = h.promise().continuation_;
+					return c ? c : std::noop_coroutine();
+				}
+				void await_resume() const noexcept {}
+			};
+			return final_awaiter{};
+		}
+
+		void return_value(T value) { value_ = std::move(value); }
+
+		void unhandled_exception() noexcept {
+			exception_ = std::current_exception();
+		}
+
+	private:
+		friend class task;
+
+		std::coroutine_handle<> continuation_;
+		T value_{};
+		std::exception_ptr exception_;
+	};
+
+	using handle = std::coroutine_handle<promise_type>;
+
+	task(task &&o) noexcept : h_(std::exchange(o.h_, nullptr)) {}
+
+	task &operator=(task &&o) noexcept {
+		if (this != &o) {
+			if (h_) {
+				h_.destroy();
+			}
+			h_ = std::exchange(o.h_, nullptr);
+		}
+		return *this;
+	}
+
+	~task() {
+		if (h_) {
+			h_.destroy();
+		}
+	}
+
+	bool await_ready() const noexcept { return false; }
+
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<> c) noexcept {
+		h_.promise().continuation_ = c;
+		return h_;
+	}
+
+	T await_resume() { return result(); }
+
+	/**
+	 * Runs the task up to its first suspension point.
+	 */
+	void start() { h_.resume(); }
+
+	bool done() const noexcept { return h_.done(); }
+
+	/**
+	 * Returns the value produced by the completed task or rethrows the
+	 * exception it exited with.
+	 */
+	T result() {
+		if (h_.promise().exception_) {
+			std::rethrow_exception(std::exchange(h_.promise().exception_, nullptr));
+		}
+		return std::move(h_.promise().value_);
+	}
+
+private:
+	explicit task(handle h) noexcept : h_(h) {}
+
+	handle h_;
+};
+
+/**
+ * Asynchronous byte source for async_parse(). read(buf, size) returns an
+ * awaitable that reads up to size bytes into buf and resumes with the number
+ * of bytes read, or zero at the end of the stream.
+ */
+template <typename Source>
+concept async_byte_source =
+    requires(Source &source, unsigned char *buf, std::size_t size) {
+	    {
+		    source.read(buf, size).await_resume()
+	    } -> std::convertible_to<std::size_t>;
+    };
+
+namespace detail {
+
+inline event_generator generate(std::allocator_arg_t, frame_arena *,
+                                parser &p, const unsigned char *buf,
+                                std::size_t len) {
+	for (const event &e : p.events(buf, len)) {
+		co_yield e;
+	}
+}
+
+template <typename Source, typename Visitor>
+task<std::size_t> async_parse(std::allocator_arg_t, frame_arena *, parser &p,
+                              Source &source, unsigned char *buf,
+                              std::size_t size, Visitor visitor) {
+	std::size_t total = 0, n;
+	bool stopped = false;
+	auto call = [&visitor, &stopped](const event &e) {
+		if constexpr (std::is_same_v<
+		                  std::invoke_result_t<Visitor &, const event &>,
+		                  bool>) {
+			stopped = !visitor(e);
+		} else {
+			visitor(e);
+		}
+		return !stopped;
+	};
+	while (true) {
+		n = co_await source.read(buf, size);
+		if (n == 0) {
+			co_return total;
+		}
+		total += p.parse(buf, n, call);
+		if (stopped || vtparse_budget_exhausted(&p.raw())) {
+			co_return total;
+		}
+	}
+}
+
+}  // namespace detail
+
+/**
+ * Returns a generator yielding the events produced by parsing the given
+ * buffer. The buffer and the parser must outlive the generator.
+ */
+inline event_generator generate(parser &p, const unsigned char *buf,
+                                std::size_t len) {
+	return detail::generate(std::allocator_arg, nullptr, p, buf, len);
+}
+
+inline event_generator generate(parser &p, std::string_view buf) {
+	return generate(p, reinterpret_cast<const unsigned char *>(buf.data()),
+	                buf.size());
+}
+
+inline event_generator generate(std::allocator_arg_t, frame_arena &arena,
+                                parser &p, const unsigned char *buf,
+                                std::size_t len) {
+	return detail::generate(std::allocator_arg, &arena, p, buf, len);
+}
+
+inline event_generator generate(std::allocator_arg_t, frame_arena &arena,
+                                parser &p, std::string_view buf) {
+	return generate(std::allocator_arg, arena, p,
+	                reinterpret_cast<const unsigned char *>(buf.data()),
+	                buf.size());
+}
+
+/**
+ * Returns a task that repeatedly reads up to size bytes from the source into
+ * buf and passes the events to the visitor, see parser::parse(). The task
+ * ends at the end of the stream, or once the visitor returns false or the
+ * budget of the parser is exhausted; the rest of the last buffer is not
+ * parsed in the latter case. The task produces the number of bytes parsed.
+ * The parser, the source and the buffer must outlive the task; the visitor
+ * is moved into the coroutine frame.
+ */
+template <async_byte_source Source, typename Visitor>
+task<std::size_t> async_parse(parser &p, Source &source, unsigned char *buf,
+                              std::size_t size, Visitor visitor) {
+	return detail::async_parse(std::allocator_arg, nullptr, p, source, buf,
+	                           size, std::move(visitor));
+}
+
+template <async_byte_source Source, typename Visitor>
+task<std::size_t> async_parse(std::allocator_arg_t, frame_arena &arena,
+                              parser &p, Source &source, unsigned char *buf,
+                              std::size_t size, Visitor visitor) {
+	return detail::async_parse(std::allocator_arg, &arena, p, source, buf,
+	                           size, std::move(visitor));
+}
+
+}  // namespace vtparse
+
+#endif /* VTPARSE_VTPARSE_CORO_HPP */
@@ -0,0 +1,273 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dialect.c
+ *
+ * Builds custom dialects from a list of rules. The rules are expanded into a
+ * state transition table with one entry per state and byte, exactly like
+ * tables/vtparse_gen_c_tables.rb does for the built-in dialect, and the run
+ * classes used by the vectorized scanners are derived from the table.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <vtparse/vtparse_dialect.h>
+
+/******************************************************************************
+ * Example dialects                                                           *
+ ******************************************************************************/
+
+/* The C1 control characters as commented out in tables/vtparse_tables.rb */
+static const vtparse_dialect_rule_t vtparse_dialect_c1_rules[] = {
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x80, 0x8F, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x90, 0x90, 0,
+                 VTPARSE_STATE_DCS_ENTRY),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x91, 0x97, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x98, 0x98, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x99, 0x9A, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9B, 0x9B, 0,
+                 VTPARSE_STATE_CSI_ENTRY),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9C, 0x9C, 0, VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9D, 0x9D, 0,
+                 VTPARSE_STATE_OSC_STRING),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x9E, 0x9F, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0xA0, 0xFF, VTPARSE_ACTION_PRINT, 0),
+    VTPARSE_RULE_END};
+
+/* Device control strings are ignored after their final byte, however they
+   were started */
+static const vtparse_dialect_rule_t vtparse_dialect_no_dcs_rules[] = {
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x40, 0x7E, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x40, 0x7E, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x40, 0x7E, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE_END};
+
+static const vtparse_dialect_rule_t vtparse_dialect_tmux_rules[] = {
+    /* Hook in the transitions into DCS_PASSTHROUGH and unhook in those out
+       of it instead of in its entry and exit actions, such that an escaped
+       ESC can leave and re-enter the state */
+    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_DCS_PASSTHROUGH, 0),
+    VTPARSE_RULE_ON_EXIT(VTPARSE_STATE_DCS_PASSTHROUGH, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x40, 0x7E, VTPARSE_ACTION_HOOK,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x40, 0x7E,
+                 VTPARSE_ACTION_HOOK, VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x40, 0x7E, VTPARSE_ACTION_HOOK,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x18, 0x18,
+                 VTPARSE_ACTION_UNHOOK, VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x1A, 0x1A,
+                 VTPARSE_ACTION_UNHOOK, VTPARSE_STATE_GROUND),
+
+    /* DCS_IGNORE behaves exactly like SOS_PM_APC_STRING; use the latter for
+       malformed device control strings and DCS_IGNORE for an ESC read in
+       DCS_PASSTHROUGH */
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x3A, 0x3A, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x30, 0x3F, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x3A, 0x3A, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x3C, 0x3F, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x1B, 0x1B, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+
+    /* ESC ESC is an escaped ESC and ESC \ terminates the string. Any other
+       byte terminates the string as well and starts the sequence it
+       introduces if this does not require an action. */
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x00, 0xFF, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x1B, 0x1B, VTPARSE_ACTION_PUT,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x50, 0x50, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_DCS_ENTRY),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x58, 0x58, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x5B, 0x5B, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_CSI_ENTRY),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x5D, 0x5D, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_OSC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x5E, 0x5F, VTPARSE_ACTION_UNHOOK,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE_END};
+
+/******************************************************************************
+ * Internal functions                                                         *
+ ******************************************************************************/
+
+/**
+ * Returns true if the given rule refers to valid states and actions.
+ */
+static int vtparse_dialect_rule_valid(const vtparse_dialect_rule_t *rule) {
+	if (rule->kind > VTPARSE_RULE_KIND_ON_EXIT ||
+	    rule->state > VTPARSE_NUM_STATES ||
+	    rule->action >= VTPARSE_ACTION_ERROR) {
+		return 0;
+	}
+	if (rule->kind == VTPARSE_RULE_KIND_TRANSITION) {
+		return rule->first <= rule->last && rule->target <= VTPARSE_NUM_STATES;
+	}
+	return 1;
+}
+
+/**
+ * Applies a single valid rule to the state with the given index.
+ */
+static void vtparse_dialect_apply_rule(vtparse_dialect_t *dialect,
+                                       const vtparse_dialect_rule_t *rule,
+                                       unsigned int s) {
+	unsigned int c;
+
+	switch (rule->kind) {
+		case VTPARSE_RULE_KIND_TRANSITION:
+			for (c = rule->first; c <= rule->last; c++) {
+				dialect->state_table[s][c] =
+				    (vtparse_state_change_t)(rule->action | (rule->target << 4));
+			}
+			break;
+		case VTPARSE_RULE_KIND_ON_ENTRY:
+			dialect->entry_actions[s] = (unsigned char)rule->action;
+			break;
+		case VTPARSE_RULE_KIND_ON_EXIT:
+			dialect->exit_actions[s] = (unsigned char)rule->action;
+			break;
+	}
+}
+
+/**
+ * Returns true if the given state change solely consists of an action that
+ * produces data.
+ */
+static int vtparse_dialect_is_data(vtparse_state_change_t change) {
+	return change == VTPARSE_ACTION_PRINT || change == VTPARSE_ACTION_PUT ||
+	       change == VTPARSE_ACTION_OSC_PUT;
+}
+
+/**
+ * Derives the run class of the state with the given index from the state
+ * transition table, like run_class() in tables/vtparse_gen_c_tables.rb. The
+ * vectorized scanners are disabled for states with more than one data action
+ * or too many ranges.
+ */
+static void vtparse_dialect_run_class(vtparse_dialect_t *dialect,
+                                      unsigned int s) {
+	vtparse_run_class_t *cls = &dialect->run_classes[s];
+	vtparse_state_change_t change;
+	unsigned int c, n = 0;
+	int in_range = 0;
+
+	cls->action = 0;
+	cls->num_ranges = 0;
+	for (c = 0; c < VTPARSE_MAX_RUN_RANGES; c++) {
+		cls->lo[c] = 0;
+		cls->hi[c] = 0;
+	}
+	for (c = 0; c < 256U; c++) {
+		change = dialect->state_table[s][c];
+		if (!vtparse_dialect_is_data(change)) {
+			in_range = 0;
+			continue;
+		}
+		if (cls->action && cls->action != change) {
+			cls->num_ranges = 0;
+			return;
+		}
+		cls->action = change;
+		if (!in_range) {
+			if (n == VTPARSE_MAX_RUN_RANGES) {
+				cls->num_ranges = 0;
+				return;
+			}
+			cls->lo[n++] = (unsigned char)c;
+			in_range = 1;
+		}
+		cls->hi[n - 1] = (unsigned char)c;
+		cls->num_ranges = (unsigned char)n;
+	}
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API void vtparse_dialect_init(vtparse_dialect_t *dialect) {
+	unsigned int s, c;
+
+	for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+		for (c = 0; c < 256U; c++) {
+			dialect->state_table[s][c] = STATE_TABLE[s][c];
+		}
+		dialect->entry_actions[s] = ENTRY_ACTIONS[s];
+		dialect->exit_actions[s] = EXIT_ACTIONS[s];
+		dialect->run_classes[s] = RUN_CLASSES[s];
+	}
+}
+
+VTPARSE_API int vtparse_dialect_apply(vtparse_dialect_t *dialect,
+                                      const vtparse_dialect_rule_t *rules) {
+	const vtparse_dialect_rule_t *rule;
+	unsigned int s;
+
+	/* Validate all rules first, such that the dialect stays intact */
+	for (rule = rules; rule->kind != VTPARSE_RULE_KIND_END; rule++) {
+		if (!vtparse_dialect_rule_valid(rule)) {
+			return 0;
+		}
+	}
+
+	/* Expand the rules into the tables */
+	for (rule = rules; rule->kind != VTPARSE_RULE_KIND_END; rule++) {
+		if (rule->state == VTPARSE_DIALECT_ANYWHERE) {
+			for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+				vtparse_dialect_apply_rule(dialect, rule, s);
+			}
+		} else {
+			vtparse_dialect_apply_rule(dialect, rule, rule->state - 1U);
+		}
+	}
+
+	/* Update the tables derived from the state transition table */
+	for (s = 0; s < VTPARSE_NUM_STATES; s++) {
+		vtparse_dialect_run_class(dialect, s);
+	}
+	return 1;
+}
+
+VTPARSE_API const vtparse_dialect_rule_t *vtparse_dialect_preset(
+    vtparse_dialect_preset_t preset) {
+	switch (preset) {
+		case VTPARSE_DIALECT_C1:
+			return vtparse_dialect_c1_rules;
+		case VTPARSE_DIALECT_NO_DCS:
+			return vtparse_dialect_no_dcs_rules;
+		case VTPARSE_DIALECT_TMUX:
+			return vtparse_dialect_tmux_rules;
+	}
+	return 0;
+}
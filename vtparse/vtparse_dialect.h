@@ -0,0 +1,194 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dialect.h
+ *
+ * Custom dialects of the state machine built at runtime. A dialect consists of
+ * the same tables that tables/vtparse_gen_c_tables.rb generates for the
+ * built-in dialect, and is described by a list of rules in the spirit of the
+ * $states hash in tables/vtparse_tables.rb: each rule assigns an action and a
+ * target state to a range of bytes read in a given state, or sets the entry or
+ * exit action of a state. The rules are applied in order on top of a copy of
+ * the built-in dialect; later rules override earlier ones. A dialect uses the
+ * same states and actions as the built-in one, only the transitions between
+ * them differ. Attach a dialect to a parser with vtparse_set_dialect().
+ *
+ * Example, a parser that ignores device control strings:
+ *
+ *     static const vtparse_dialect_rule_t rules[] = {
+ *         VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x50, 0x50, 0,
+ *                      VTPARSE_STATE_SOS_PM_APC_STRING),
+ *         VTPARSE_RULE_END};
+ *     vtparse_dialect_t dialect;
+ *
+ *     vtparse_dialect_init(&dialect);
+ *     vtparse_dialect_apply(&dialect, rules);
+ *     vtparse_set_dialect(&parser, &dialect);
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_DIALECT_H
+#define VTPARSE_VTPARSE_DIALECT_H
+
+#include <vtparse/vtparse.h>
+#include <vtparse/vtparse_table.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Kinds of vtparse_dialect_rule_t entries.
+ */
+#define VTPARSE_RULE_KIND_END 0
+#define VTPARSE_RULE_KIND_TRANSITION 1
+#define VTPARSE_RULE_KIND_ON_ENTRY 2
+#define VTPARSE_RULE_KIND_ON_EXIT 3
+
+/**
+ * State of a rule that applies to all states, like the "anywhere" transitions
+ * in tables/vtparse_tables.rb.
+ */
+#define VTPARSE_DIALECT_ANYWHERE 0
+
+/**
+ * A single rule of a dialect description.
+ */
+typedef struct vtparse_dialect_rule {
+	/**
+	 * One of the VTPARSE_RULE_KIND_* constants.
+	 */
+	unsigned char kind;
+
+	/**
+	 * State the rule applies to (VTPARSE_STATE_*) or VTPARSE_DIALECT_ANYWHERE.
+	 */
+	unsigned char state;
+
+	/**
+	 * Inclusive range of bytes the transition is taken for.
+	 */
+	unsigned char first, last;
+
+	/**
+	 * Action (VTPARSE_ACTION_*) or zero for no action.
+	 */
+	unsigned char action;
+
+	/**
+	 * Target state (VTPARSE_STATE_*) or zero to stay in the current state
+	 * without running the exit and entry actions.
+	 */
+	unsigned char target;
+} vtparse_dialect_rule_t;
+
+/**
+ * Initializers for vtparse_dialect_rule_t. A list of rules is terminated by
+ * VTPARSE_RULE_END.
+ */
+#define VTPARSE_RULE(state, first, last, action, target) \
+	{VTPARSE_RULE_KIND_TRANSITION, (state), (first), (last), (action), (target)}
+#define VTPARSE_RULE_ON_ENTRY(state, action) \
+	{VTPARSE_RULE_KIND_ON_ENTRY, (state), 0, 0, (action), 0}
+#define VTPARSE_RULE_ON_EXIT(state, action) \
+	{VTPARSE_RULE_KIND_ON_EXIT, (state), 0, 0, (action), 0}
+#define VTPARSE_RULE_END {VTPARSE_RULE_KIND_END, 0, 0, 0, 0, 0}
+
+/**
+ * Example dialects, see vtparse_dialect_preset().
+ */
+typedef enum {
+	/**
+	 * Recognizes the 8-bit C1 control characters 0x80 to 0x9F (e.g. 0x9B as
+	 * CSI) anywhere, like a DEC terminal in 8-bit mode, and prints 0xA0 to
+	 * 0xFF as single-byte characters in the ground state. Not suitable for
+	 * UTF-8 encoded input.
+	 */
+	VTPARSE_DIALECT_C1 = 1,
+
+	/**
+	 * Treats device control strings like SOS, PM and APC strings, i.e. ignores
+	 * them until the string terminator, for untrusted input. The parser never
+	 * reports VTPARSE_ACTION_HOOK, VTPARSE_ACTION_PUT or
+	 * VTPARSE_ACTION_UNHOOK.
+	 */
+	VTPARSE_DIALECT_NO_DCS = 2,
+
+	/**
+	 * Understands the passthrough of tmux, which wraps a sequence into a
+	 * device control string ("ESC P tmux; ... ESC \") and doubles each ESC in
+	 * it. A doubled ESC is reported as VTPARSE_ACTION_PUT of a single ESC
+	 * instead of ending the string. The string terminator of a device control
+	 * string is consumed with it and not reported as VTPARSE_ACTION_ESC_DISPATCH,
+	 * and CAN and SUB terminate the string without VTPARSE_ACTION_EXECUTE.
+	 * Meant to be applied on its own.
+	 */
+	VTPARSE_DIALECT_TMUX = 3
+} vtparse_dialect_preset_t;
+
+/**
+ * Tables of a dialect in the layout used by the parser; see vtparse_table.h
+ * for the meaning of the individual tables. Do not modify these directly;
+ * use vtparse_dialect_apply(), which also keeps the derived tables in sync.
+ */
+typedef struct vtparse_dialect {
+	vtparse_state_change_t state_table[VTPARSE_NUM_STATES][256];
+	unsigned char entry_actions[VTPARSE_NUM_STATES];
+	unsigned char exit_actions[VTPARSE_NUM_STATES];
+	vtparse_run_class_t run_classes[VTPARSE_NUM_STATES];
+} vtparse_dialect_t;
+
+/**
+ * Initializes the given dialect with a copy of the built-in dialect.
+ */
+VTPARSE_API void vtparse_dialect_init(vtparse_dialect_t *dialect);
+
+/**
+ * Applies a list of rules to the given dialect. Start the list with
+ * VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x00, 0xFF, 0, 0) and entry and exit
+ * rules for VTPARSE_DIALECT_ANYWHERE to describe a dialect from scratch.
+ *
+ * Actions producing data (VTPARSE_ACTION_PRINT, VTPARSE_ACTION_PUT and
+ * VTPARSE_ACTION_OSC_PUT) are reported as ranges of the input buffer. If such
+ * an action is combined with a change of state or is an entry or exit action,
+ * it is reported as a range of a single byte pointing at vtparse_t.ch instead.
+ *
+ * @param dialect is the dialect to modify.
+ * @param rules points at the rules, terminated by VTPARSE_RULE_END.
+ * @return a non-zero value on success, zero if one of the rules refers to an
+ * invalid state or action or has an empty range of bytes. The dialect is not
+ * modified in this case.
+ */
+VTPARSE_API int vtparse_dialect_apply(vtparse_dialect_t *dialect,
+                                      const vtparse_dialect_rule_t *rules);
+
+/**
+ * Returns the rules of one of the example dialects, to be passed to
+ * vtparse_dialect_apply(), or NULL if the given preset does not exist.
+ */
+VTPARSE_API const vtparse_dialect_rule_t *vtparse_dialect_preset(
+    vtparse_dialect_preset_t preset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_DIALECT_H */
@@ -0,0 +1,470 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dialect.hpp
+ *
+ * Dialects built at compile time. vtparse::builtin_rules describes the
+ * built-in dialect with the rules of vtparse_dialect.h, in the same order as
+ * the $states hash in tables/vtparse_tables.rb; vtparse::make_dialect()
+ * expands rules into the tables of a vtparse_dialect_t during constant
+ * evaluation, without requiring Ruby:
+ *
+ *     static constexpr vtparse_dialect_rule_t no_dcs_rules[] = {
+ *         VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x50, 0x50, 0,
+ *                      VTPARSE_STATE_SOS_PM_APC_STRING),
+ *         VTPARSE_RULE_END};
+ *     static constexpr vtparse_dialect_t no_dcs =
+ *         vtparse::make_dialect(vtparse::builtin_rules, no_dcs_rules);
+ *
+ *     vtparse::dialect_parser<no_dcs> p;
+ *
+ * Invalid rules make the constant evaluation fail.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_DIALECT_HPP
+#define VTPARSE_VTPARSE_DIALECT_HPP
+
+#include <vtparse/vtparse.hpp>
+#include <vtparse/vtparse_dialect.h>
+
+namespace vtparse {
+
+/**
+ * Rules of the built-in dialect; must be kept in sync with
+ * tables/vtparse_tables.rb.
+ */
+inline constexpr vtparse_dialect_rule_t builtin_rules[] = {
+    /* Anywhere transitions */
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x18, 0x18, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x1a, 0x1a, VTPARSE_ACTION_EXECUTE,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_DIALECT_ANYWHERE, 0x1b, 0x1b, 0, VTPARSE_STATE_ESCAPE),
+
+    /* GROUND */
+    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0x00, 0x17, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0x19, 0x19, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0x1c, 0x1f, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_GROUND, 0x20, 0xf7, VTPARSE_ACTION_PRINT, 0),
+
+    /* ESCAPE */
+    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_ESCAPE, VTPARSE_ACTION_CLEAR),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x00, 0x17, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x19, 0x19, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x1c, 0x1f, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x7f, 0x7f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x20, 0x2f, VTPARSE_ACTION_COLLECT,
+                 VTPARSE_STATE_ESCAPE_INTERMEDIATE),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x30, 0x4f, VTPARSE_ACTION_ESC_DISPATCH,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x51, 0x57, VTPARSE_ACTION_ESC_DISPATCH,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x59, 0x59, VTPARSE_ACTION_ESC_DISPATCH,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x5a, 0x5a, VTPARSE_ACTION_ESC_DISPATCH,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x5c, 0x5c, VTPARSE_ACTION_ESC_DISPATCH,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x60, 0x7e, VTPARSE_ACTION_ESC_DISPATCH,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x5b, 0x5b, 0, VTPARSE_STATE_CSI_ENTRY),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x5d, 0x5d, 0, VTPARSE_STATE_OSC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x50, 0x50, 0, VTPARSE_STATE_DCS_ENTRY),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x58, 0x58, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x5e, 0x5e, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE, 0x5f, 0x5f, 0,
+                 VTPARSE_STATE_SOS_PM_APC_STRING),
+
+    /* ESCAPE_INTERMEDIATE */
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE_INTERMEDIATE, 0x00, 0x17,
+                 VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE_INTERMEDIATE, 0x19, 0x19,
+                 VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE_INTERMEDIATE, 0x1c, 0x1f,
+                 VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE_INTERMEDIATE, 0x20, 0x2f,
+                 VTPARSE_ACTION_COLLECT, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE_INTERMEDIATE, 0x7f, 0x7f,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_ESCAPE_INTERMEDIATE, 0x30, 0x7e,
+                 VTPARSE_ACTION_ESC_DISPATCH, VTPARSE_STATE_GROUND),
+
+    /* CSI_ENTRY */
+    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_CSI_ENTRY, VTPARSE_ACTION_CLEAR),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x00, 0x17, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x19, 0x19, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x1c, 0x1f, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x7f, 0x7f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x20, 0x2f, VTPARSE_ACTION_COLLECT,
+                 VTPARSE_STATE_CSI_INTERMEDIATE),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x3a, 0x3a, 0,
+                 VTPARSE_STATE_CSI_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x30, 0x39, VTPARSE_ACTION_PARAM,
+                 VTPARSE_STATE_CSI_PARAM),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x3b, 0x3b, VTPARSE_ACTION_PARAM,
+                 VTPARSE_STATE_CSI_PARAM),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x3c, 0x3f, VTPARSE_ACTION_COLLECT,
+                 VTPARSE_STATE_CSI_PARAM),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_ENTRY, 0x40, 0x7e,
+                 VTPARSE_ACTION_CSI_DISPATCH, VTPARSE_STATE_GROUND),
+
+    /* CSI_IGNORE */
+    VTPARSE_RULE(VTPARSE_STATE_CSI_IGNORE, 0x00, 0x17, VTPARSE_ACTION_EXECUTE,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_IGNORE, 0x19, 0x19, VTPARSE_ACTION_EXECUTE,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_IGNORE, 0x1c, 0x1f, VTPARSE_ACTION_EXECUTE,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_IGNORE, 0x20, 0x3f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_IGNORE, 0x7f, 0x7f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_IGNORE, 0x40, 0x7e, 0, VTPARSE_STATE_GROUND),
+
+    /* CSI_PARAM */
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x00, 0x17, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x19, 0x19, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x1c, 0x1f, VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x30, 0x39, VTPARSE_ACTION_PARAM, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x3b, 0x3b, VTPARSE_ACTION_PARAM, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x7f, 0x7f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x3a, 0x3a, 0,
+                 VTPARSE_STATE_CSI_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x3c, 0x3f, 0,
+                 VTPARSE_STATE_CSI_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x20, 0x2f, VTPARSE_ACTION_COLLECT,
+                 VTPARSE_STATE_CSI_INTERMEDIATE),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_PARAM, 0x40, 0x7e,
+                 VTPARSE_ACTION_CSI_DISPATCH, VTPARSE_STATE_GROUND),
+
+    /* CSI_INTERMEDIATE */
+    VTPARSE_RULE(VTPARSE_STATE_CSI_INTERMEDIATE, 0x00, 0x17,
+                 VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_INTERMEDIATE, 0x19, 0x19,
+                 VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_INTERMEDIATE, 0x1c, 0x1f,
+                 VTPARSE_ACTION_EXECUTE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_INTERMEDIATE, 0x20, 0x2f,
+                 VTPARSE_ACTION_COLLECT, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_INTERMEDIATE, 0x7f, 0x7f,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_INTERMEDIATE, 0x30, 0x3f, 0,
+                 VTPARSE_STATE_CSI_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_CSI_INTERMEDIATE, 0x40, 0x7e,
+                 VTPARSE_ACTION_CSI_DISPATCH, VTPARSE_STATE_GROUND),
+
+    /* DCS_ENTRY */
+    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_DCS_ENTRY, VTPARSE_ACTION_CLEAR),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x00, 0x17, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x19, 0x19, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x1c, 0x1f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x7f, 0x7f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x3a, 0x3a, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x20, 0x2f, VTPARSE_ACTION_COLLECT,
+                 VTPARSE_STATE_DCS_INTERMEDIATE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x30, 0x39, VTPARSE_ACTION_PARAM,
+                 VTPARSE_STATE_DCS_PARAM),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x3b, 0x3b, VTPARSE_ACTION_PARAM,
+                 VTPARSE_STATE_DCS_PARAM),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x3c, 0x3f, VTPARSE_ACTION_COLLECT,
+                 VTPARSE_STATE_DCS_PARAM),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_ENTRY, 0x40, 0x7e, 0,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+
+    /* DCS_INTERMEDIATE */
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x00, 0x17,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x19, 0x19,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x1c, 0x1f,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x20, 0x2f,
+                 VTPARSE_ACTION_COLLECT, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x7f, 0x7f,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x30, 0x3f, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_INTERMEDIATE, 0x40, 0x7e, 0,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+
+    /* DCS_IGNORE */
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x00, 0x17, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x19, 0x19, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x1c, 0x1f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_IGNORE, 0x20, 0x7f, VTPARSE_ACTION_IGNORE, 0),
+
+    /* DCS_PARAM */
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x00, 0x17, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x19, 0x19, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x1c, 0x1f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x30, 0x39, VTPARSE_ACTION_PARAM, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x3b, 0x3b, VTPARSE_ACTION_PARAM, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x7f, 0x7f, VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x3a, 0x3a, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x3c, 0x3f, 0,
+                 VTPARSE_STATE_DCS_IGNORE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x20, 0x2f, VTPARSE_ACTION_COLLECT,
+                 VTPARSE_STATE_DCS_INTERMEDIATE),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PARAM, 0x40, 0x7e, 0,
+                 VTPARSE_STATE_DCS_PASSTHROUGH),
+
+    /* DCS_PASSTHROUGH */
+    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_DCS_PASSTHROUGH, VTPARSE_ACTION_HOOK),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x00, 0x17, VTPARSE_ACTION_PUT,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x19, 0x19, VTPARSE_ACTION_PUT,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x1c, 0x1f, VTPARSE_ACTION_PUT,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x20, 0x7e, VTPARSE_ACTION_PUT,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_DCS_PASSTHROUGH, 0x7f, 0x7f,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE_ON_EXIT(VTPARSE_STATE_DCS_PASSTHROUGH, VTPARSE_ACTION_UNHOOK),
+
+    /* SOS_PM_APC_STRING */
+    VTPARSE_RULE(VTPARSE_STATE_SOS_PM_APC_STRING, 0x00, 0x17,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_SOS_PM_APC_STRING, 0x19, 0x19,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_SOS_PM_APC_STRING, 0x1c, 0x1f,
+                 VTPARSE_ACTION_IGNORE, 0),
+    VTPARSE_RULE(VTPARSE_STATE_SOS_PM_APC_STRING, 0x20, 0x7f,
+                 VTPARSE_ACTION_IGNORE, 0),
+
+    /* OSC_STRING */
+    VTPARSE_RULE_ON_ENTRY(VTPARSE_STATE_OSC_STRING, VTPARSE_ACTION_OSC_START),
+    VTPARSE_RULE(VTPARSE_STATE_OSC_STRING, 0x00, 0x06, VTPARSE_ACTION_IGNORE,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_OSC_STRING, 0x07, 0x07, 0,
+                 VTPARSE_STATE_GROUND),
+    VTPARSE_RULE(VTPARSE_STATE_OSC_STRING, 0x08, 0x17, VTPARSE_ACTION_IGNORE,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_OSC_STRING, 0x19, 0x19, VTPARSE_ACTION_IGNORE,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_OSC_STRING, 0x1c, 0x1f, VTPARSE_ACTION_IGNORE,
+                 0),
+    VTPARSE_RULE(VTPARSE_STATE_OSC_STRING, 0x20, 0x7f, VTPARSE_ACTION_OSC_PUT,
+                 0),
+    VTPARSE_RULE_ON_EXIT(VTPARSE_STATE_OSC_STRING, VTPARSE_ACTION_OSC_END),
+
+    VTPARSE_RULE_END};
+
+namespace detail {
+
+consteval void check_rules(const vtparse_dialect_rule_t *rules) {
+	for (; rules->kind != VTPARSE_RULE_KIND_END; rules++) {
+		if (rules->kind > VTPARSE_RULE_KIND_ON_EXIT ||
+		    rules->state > VTPARSE_NUM_STATES ||
+		    rules->action >= VTPARSE_ACTION_ERROR) {
+			throw "invalid rule kind, state or action";
+		}
+		if (rules->kind == VTPARSE_RULE_KIND_TRANSITION &&
+		    (rules->first > rules->last ||
+		     rules->target > VTPARSE_NUM_STATES)) {
+			throw "invalid range or target state";
+		}
+	}
+}
+
+/* Applies a single rule to the state with the given index, see
+   vtparse_dialect_apply_rule() */
+consteval void apply_rule(vtparse_dialect_t &d,
+                          const vtparse_dialect_rule_t &rule, unsigned int s) {
+	switch (rule.kind) {
+		case VTPARSE_RULE_KIND_TRANSITION:
+			for (unsigned int c = rule.first; c <= rule.last; c++) {
+				d.state_table[s][c] =
+				    static_cast<vtparse_state_change_t>(rule.action |
+				                                        (rule.target << 4));
+			}
+			break;
+		case VTPARSE_RULE_KIND_ON_ENTRY:
+			d.entry_actions[s] = static_cast<unsigned char>(rule.action);
+			break;
+		case VTPARSE_RULE_KIND_ON_EXIT:
+			d.exit_actions[s] = static_cast<unsigned char>(rule.action);
+			break;
+	}
+}
+
+consteval void apply_rules(vtparse_dialect_t &d,
+                           const vtparse_dialect_rule_t *rules) {
+	for (; rules->kind != VTPARSE_RULE_KIND_END; rules++) {
+		if (rules->state == VTPARSE_DIALECT_ANYWHERE) {
+			for (unsigned int s = 0; s < VTPARSE_NUM_STATES; s++) {
+				apply_rule(d, *rules, s);
+			}
+		} else {
+			apply_rule(d, *rules, rules->state - 1U);
+		}
+	}
+}
+
+/* Derives the run class of the state with the given index, see
+   vtparse_dialect_run_class() */
+consteval void run_class(vtparse_dialect_t &d, unsigned int s) {
+	vtparse_run_class_t &cls = d.run_classes[s];
+	unsigned int n = 0;
+	bool in_range = false;
+
+	cls = vtparse_run_class_t{};
+	for (unsigned int c = 0; c < 256U; c++) {
+		const vtparse_state_change_t change = d.state_table[s][c];
+		if (change != VTPARSE_ACTION_PRINT && change != VTPARSE_ACTION_PUT &&
+		    change != VTPARSE_ACTION_OSC_PUT) {
+			in_range = false;
+			continue;
+		}
+		if (cls.action && cls.action != change) {
+			cls.num_ranges = 0;
+			return;
+		}
+		cls.action = change;
+		if (!in_range) {
+			if (n == VTPARSE_MAX_RUN_RANGES) {
+				cls.num_ranges = 0;
+				return;
+			}
+			cls.lo[n++] = static_cast<unsigned char>(c);
+			in_range = true;
+		}
+		cls.hi[n - 1] = static_cast<unsigned char>(c);
+		cls.num_ranges = static_cast<unsigned char>(n);
+	}
+}
+
+}  // namespace detail
+
+/**
+ * Expands rules into a dialect the way tables/vtparse_gen_c_tables.rb expands
+ * tables/vtparse_tables.rb: the tables start out empty, the rules for
+ * individual states are applied in order, and rules for
+ * VTPARSE_DIALECT_ANYWHERE fill in the remaining transitions of all states.
+ * An anywhere transition overlapping a transition of a state is an error.
+ */
+consteval vtparse_dialect_t make_dialect(const vtparse_dialect_rule_t *rules) {
+	vtparse_dialect_t d{};
+	bool defined[VTPARSE_NUM_STATES][256] = {};
+	const vtparse_dialect_rule_t *rule;
+
+	detail::check_rules(rules);
+	for (rule = rules; rule->kind != VTPARSE_RULE_KIND_END; rule++) {
+		if (rule->state == VTPARSE_DIALECT_ANYWHERE) {
+			continue;
+		}
+		detail::apply_rule(d, *rule, rule->state - 1U);
+		for (unsigned int c = rule->first;
+		     rule->kind == VTPARSE_RULE_KIND_TRANSITION && c <= rule->last;
+		     c++) {
+			defined[rule->state - 1U][c] = true;
+		}
+	}
+	for (rule = rules; rule->kind != VTPARSE_RULE_KIND_END; rule++) {
+		if (rule->state != VTPARSE_DIALECT_ANYWHERE) {
+			continue;
+		}
+		for (unsigned int s = 0; s < VTPARSE_NUM_STATES; s++) {
+			for (unsigned int c = rule->first;
+			     rule->kind == VTPARSE_RULE_KIND_TRANSITION && c <= rule->last;
+			     c++) {
+				if (defined[s][c]) {
+					throw "anywhere transition overlaps a transition of a state";
+				}
+			}
+			detail::apply_rule(d, *rule, s);
+		}
+	}
+	for (unsigned int s = 0; s < VTPARSE_NUM_STATES; s++) {
+		detail::run_class(d, s);
+	}
+	return d;
+}
+
+/**
+ * Expands the base rules with make_dialect() and applies the overrides on top
+ * like vtparse_dialect_apply(), i.e. later rules override earlier ones.
+ * make_dialect(builtin_rules, rules) thus is the same dialect as
+ * vtparse_dialect_init() followed by vtparse_dialect_apply() with rules.
+ */
+consteval vtparse_dialect_t make_dialect(
+    const vtparse_dialect_rule_t *base,
+    const vtparse_dialect_rule_t *overrides) {
+	vtparse_dialect_t d = make_dialect(base);
+
+	detail::check_rules(overrides);
+	detail::apply_rules(d, overrides);
+	for (unsigned int s = 0; s < VTPARSE_NUM_STATES; s++) {
+		detail::run_class(d, s);
+	}
+	return d;
+}
+
+/**
+ * Tables of the built-in dialect expanded at compile time; equal to the
+ * tables in vtparse_table.c.
+ */
+inline constexpr vtparse_dialect_t builtin_dialect =
+    make_dialect(builtin_rules);
+
+/**
+ * Parser bound to a dialect at compile time. For builtin_dialect, the parser
+ * keeps using the tables compiled into the library and with them the
+ * transitions inlined from the traffic profile, the stride-2 engine and
+ * VTPARSE_OPTION_SEQUENCES; any other dialect is attached with
+ * vtparse_set_dialect().
+ */
+template <const vtparse_dialect_t &Dialect>
+class dialect_parser : public parser {
+public:
+	dialect_parser() noexcept { attach(); }
+
+	/**
+	 * Resets the parser and its configuration, except for the dialect.
+	 */
+	void reset() noexcept {
+		parser::reset();
+		attach();
+	}
+
+	/**
+	 * The dialect of the parser.
+	 */
+	static constexpr const vtparse_dialect_t &dialect() noexcept {
+		return Dialect;
+	}
+
+private:
+	using parser::set_dialect;
+
+	void attach() noexcept {
+		if constexpr (&Dialect != &builtin_dialect) {
+			set_dialect(&Dialect);
+		}
+	}
+};
+
+}  // namespace vtparse
+
+#endif /* VTPARSE_VTPARSE_DIALECT_HPP */
@@ -0,0 +1,638 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dispatch.c
+ *
+ * Instruction set specific kernels and the runtime selection among them. The
+ * kernels are compiled with per-function target attributes, so the library
+ * itself can be built for the baseline instruction set; the CPU is queried
+ * using cpuid (via __builtin_cpu_supports()) the first time a parser is
+ * initialized.
+ *
+ * The scan kernels test whether a byte belongs to a run class by checking the
+ * byte ranges listed in RUN_CLASSES, which are generated together with the
+ * state transition table. A byte x lies in the range [lo, hi] if
+ * (x - lo) mod 256 <= hi - lo, which maps to an unsigned minimum and a
+ * comparison in SSE2 and AVX2.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <vtparse/vtparse_dispatch.h>
+
+#ifdef VTPARSE_DISPATCH_X86
+#include <immintrin.h>
+#if defined(__STDC_HOSTED__) && __STDC_HOSTED__ && !defined(VTPARSE_NO_GETENV)
+#include <stdlib.h>
+#define VTPARSE_DISPATCH_GETENV 1
+#endif
+#endif
+
+/******************************************************************************
+ * Kernels                                                                    *
+ ******************************************************************************/
+
+static const vtparse_kernels_t VTPARSE_KERNELS_SCALAR = {
+    VTPARSE_ISA_SCALAR, 0, 0, 0, 0};
+
+#ifdef VTPARSE_DISPATCH_X86
+
+/**
+ * Scalar tail of the scan kernels.
+ */
+static unsigned int vtparse_scan_tail(const vtparse_run_class_t *cls,
+                                      const unsigned char *buf,
+                                      unsigned int pos, unsigned int buf_len) {
+	unsigned int r;
+	unsigned char x;
+	for (; pos < buf_len; pos++) {
+		x = buf[pos];
+		for (r = 0; r < cls->num_ranges; r++) {
+			if ((unsigned char)(x - cls->lo[r]) <=
+			    (unsigned char)(cls->hi[r] - cls->lo[r])) {
+				break;
+			}
+		}
+		if (r == cls->num_ranges) {
+			break;
+		}
+	}
+	return pos;
+}
+
+/**
+ * Returns the start of the last character in buf[start] to buf[end - 1] if
+ * the character is truncated, end otherwise. Only called for input that has
+ * been validated up to a possibly truncated last character; decrements
+ * *num_codepoints if the character is cut off.
+ */
+static unsigned int vtparse_utf8_complete_end(const unsigned char *buf,
+                                              unsigned int start,
+                                              unsigned int end,
+                                              unsigned int *num_codepoints) {
+	unsigned int i = end, len;
+	unsigned char c;
+	while (i > start && end - i < 4U) {
+		c = buf[--i];
+		if (c < 0x80U) {
+			break;
+		}
+		if (c >= 0xC0U) {
+			len = (c >= 0xF0U) ? 4U : ((c >= 0xE0U) ? 3U : 2U);
+			if (i + len > end) {
+				(*num_codepoints)--;
+				return i;
+			}
+			break;
+		}
+	}
+	return end;
+}
+
+/*
+ * SSE2
+ */
+
+/* Plain SSE2 lacks the byte shuffle required for the lookup tables of the
+   full validator; this kernel only skips over ASCII */
+__attribute__((target("sse2"))) static unsigned int vtparse_validate_utf8_sse2(
+    const unsigned char *buf, unsigned int pos, unsigned int buf_len,
+    unsigned int *num_codepoints) {
+	unsigned int mask, start = pos;
+	for (; pos + 16U <= buf_len; pos += 16U) {
+		mask = (unsigned int)_mm_movemask_epi8(
+		    _mm_loadu_si128((const __m128i *)(buf + pos)));
+		if (mask) {
+			pos += (unsigned int)__builtin_ctz(mask);
+			break;
+		}
+	}
+	*num_codepoints += pos - start;
+	return pos;
+}
+
+__attribute__((target("sse2"))) static unsigned int vtparse_scan_string_sse2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m128i lo[VTPARSE_MAX_RUN_RANGES], width[VTPARSE_MAX_RUN_RANGES];
+	__m128i x, d, in;
+	unsigned int r, mask;
+
+	for (r = 0; r < cls->num_ranges; r++) {
+		lo[r] = _mm_set1_epi8((char)cls->lo[r]);
+		width[r] = _mm_set1_epi8((char)(cls->hi[r] - cls->lo[r]));
+	}
+	for (; pos + 16U <= buf_len; pos += 16U) {
+		x = _mm_loadu_si128((const __m128i *)(buf + pos));
+		in = _mm_setzero_si128();
+		for (r = 0; r < cls->num_ranges; r++) {
+			d = _mm_sub_epi8(x, lo[r]);
+			in = _mm_or_si128(in, _mm_cmpeq_epi8(_mm_min_epu8(d, width[r]), d));
+		}
+		mask = ~(unsigned int)_mm_movemask_epi8(in) & 0xFFFFU;
+		if (mask) {
+			return pos + (unsigned int)__builtin_ctz(mask);
+		}
+	}
+	return vtparse_scan_tail(cls, buf, pos, buf_len);
+}
+
+__attribute__((target("sse2"))) static unsigned int vtparse_scan_ground_sse2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m128i lo, width, d0, d1;
+	unsigned int mask;
+
+	if (cls->num_ranges != 1U) {
+		return vtparse_scan_string_sse2(cls, buf, pos, buf_len);
+	}
+	lo = _mm_set1_epi8((char)cls->lo[0]);
+	width = _mm_set1_epi8((char)(cls->hi[0] - cls->lo[0]));
+	for (; pos + 32U <= buf_len; pos += 32U) {
+		d0 = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(buf + pos)), lo);
+		d1 = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)(buf + pos + 16U)),
+		                  lo);
+		mask = (unsigned int)_mm_movemask_epi8(
+		           _mm_cmpeq_epi8(_mm_min_epu8(d0, width), d0)) |
+		       ((unsigned int)_mm_movemask_epi8(
+		            _mm_cmpeq_epi8(_mm_min_epu8(d1, width), d1))
+		        << 16U);
+		if (~mask) {
+			return pos + (unsigned int)__builtin_ctz(~mask);
+		}
+	}
+	return vtparse_scan_string_sse2(cls, buf, pos, buf_len);
+}
+
+__attribute__((target("sse2"))) static int vtparse_decode_params_sse2(
+    int *params, const unsigned char *p, const unsigned char *end) {
+	const __m128i semicolon = _mm_set1_epi8(';');
+	unsigned char chunk[16];
+	const unsigned char *src;
+	unsigned int len, mask, i, k;
+	int n = (*p == ';') ? 0 : 1, value = 0;
+
+	while (p < end) {
+		/* Never read past the end of the input buffer */
+		len = (unsigned int)(end - p);
+		if (len >= 16U) {
+			src = p;
+			len = 16U;
+		} else {
+			for (i = 0; i < 16U; i++) {
+				chunk[i] = (i < len) ? p[i] : 0U;
+			}
+			src = chunk;
+		}
+
+		/* Accumulate the digits between the separators */
+		mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+		    _mm_loadu_si128((const __m128i *)src), semicolon));
+		i = 0;
+		while (mask) {
+			k = (unsigned int)__builtin_ctz(mask);
+			mask &= mask - 1U;
+			for (; i < k; i++) {
+				value = value * 10 + (src[i] - '0');
+			}
+			if (n > 0) {
+				params[n - 1] = value;
+			}
+			if (++n > (int)VTPARSE_MAX_PARAMS) {
+				return -1;
+			}
+			value = 0;
+			i = k + 1U;
+		}
+		for (; i < len; i++) {
+			value = value * 10 + (src[i] - '0');
+		}
+		p += len;
+	}
+	params[n - 1] = value;
+	return n;
+}
+
+/*
+ * AVX2
+ */
+
+__attribute__((target("avx2"))) static unsigned int vtparse_scan_string_avx2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m256i lo[VTPARSE_MAX_RUN_RANGES], width[VTPARSE_MAX_RUN_RANGES];
+	__m256i x, d, in;
+	unsigned int r, mask;
+
+	for (r = 0; r < cls->num_ranges; r++) {
+		lo[r] = _mm256_set1_epi8((char)cls->lo[r]);
+		width[r] = _mm256_set1_epi8((char)(cls->hi[r] - cls->lo[r]));
+	}
+	for (; pos + 32U <= buf_len; pos += 32U) {
+		x = _mm256_loadu_si256((const __m256i *)(buf + pos));
+		in = _mm256_setzero_si256();
+		for (r = 0; r < cls->num_ranges; r++) {
+			d = _mm256_sub_epi8(x, lo[r]);
+			in = _mm256_or_si256(
+			    in, _mm256_cmpeq_epi8(_mm256_min_epu8(d, width[r]), d));
+		}
+		mask = ~(unsigned int)_mm256_movemask_epi8(in);
+		if (mask) {
+			return pos + (unsigned int)__builtin_ctz(mask);
+		}
+	}
+	/* The compiler omits this before the tail call; without it, each SSE
+	   instruction in the callee pays for the dirty upper register halves */
+	_mm256_zeroupper();
+	return vtparse_scan_string_sse2(cls, buf, pos, buf_len);
+}
+
+__attribute__((target("avx2"))) static unsigned int vtparse_scan_ground_avx2(
+    const vtparse_run_class_t *cls, const unsigned char *buf, unsigned int pos,
+    unsigned int buf_len) {
+	__m256i lo, width, d0, d1;
+	unsigned int mask0, mask1;
+
+	if (cls->num_ranges != 1U) {
+		return vtparse_scan_string_avx2(cls, buf, pos, buf_len);
+	}
+	lo = _mm256_set1_epi8((char)cls->lo[0]);
+	width = _mm256_set1_epi8((char)(cls->hi[0] - cls->lo[0]));
+	for (; pos + 64U <= buf_len; pos += 64U) {
+		d0 = _mm256_sub_epi8(_mm256_loadu_si256((const __m256i *)(buf + pos)),
+		                     lo);
+		d1 = _mm256_sub_epi8(
+		    _mm256_loadu_si256((const __m256i *)(buf + pos + 32U)), lo);
+		mask0 = ~(unsigned int)_mm256_movemask_epi8(
+		    _mm256_cmpeq_epi8(_mm256_min_epu8(d0, width), d0));
+		mask1 = ~(unsigned int)_mm256_movemask_epi8(
+		    _mm256_cmpeq_epi8(_mm256_min_epu8(d1, width), d1));
+		if (mask0) {
+			return pos + (unsigned int)__builtin_ctz(mask0);
+		} else if (mask1) {
+			return pos + 32U + (unsigned int)__builtin_ctz(mask1);
+		}
+	}
+	return vtparse_scan_string_avx2(cls, buf, pos, buf_len);
+}
+
+/*
+ * UTF-8 validation following the lookup algorithm by Keiser and Lemire
+ * ("Validating UTF-8 in less than one instruction per byte", 2021). Three
+ * 16-entry tables indexed by the high and low nibble of the previous byte and
+ * the high nibble of the current byte flag all invalid two-byte combinations;
+ * the expected positions of third and fourth bytes are checked separately.
+ */
+
+#define UTF8_TOO_SHORT (1 << 0)
+#define UTF8_TOO_LONG (1 << 1)
+#define UTF8_OVERLONG_3 (1 << 2)
+#define UTF8_TOO_LARGE (1 << 3)
+#define UTF8_SURROGATE (1 << 4)
+#define UTF8_OVERLONG_2 (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4 (1 << 6)
+#define UTF8_TWO_CONTS (1 << 7)
+#define UTF8_CARRY (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+__attribute__((target("avx2"))) static __m256i vtparse_utf8_prev_avx2(
+    __m256i in, __m256i prev_in, int n) {
+	__m256i x = _mm256_permute2x128_si256(prev_in, in, 0x21);
+	switch (n) {
+		case 1:
+			return _mm256_alignr_epi8(in, x, 15);
+		case 2:
+			return _mm256_alignr_epi8(in, x, 14);
+		default:
+			return _mm256_alignr_epi8(in, x, 13);
+	}
+}
+
+__attribute__((target("avx2"))) static unsigned int vtparse_validate_utf8_avx2(
+    const unsigned char *buf, unsigned int pos, unsigned int buf_len,
+    unsigned int *num_codepoints) {
+	const __m256i byte_1_high_tbl = _mm256_setr_epi8(
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_2, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+	    (char)(UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_OVERLONG_4),
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+	    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_2, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+	    (char)(UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_OVERLONG_4));
+	const __m256i byte_1_low_tbl = _mm256_setr_epi8(
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4),
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_2), (char)UTF8_CARRY,
+	    (char)UTF8_CARRY, (char)(UTF8_CARRY | UTF8_TOO_LARGE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_SURROGATE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4),
+	    (char)(UTF8_CARRY | UTF8_OVERLONG_2), (char)UTF8_CARRY,
+	    (char)UTF8_CARRY, (char)(UTF8_CARRY | UTF8_TOO_LARGE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 |
+	           UTF8_SURROGATE),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000),
+	    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000));
+	const __m256i byte_2_high_tbl = _mm256_setr_epi8(
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_OVERLONG_3 | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS |
+	           UTF8_SURROGATE | UTF8_TOO_LARGE),
+	    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT);
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	const __m256i not_cont = _mm256_set1_epi8(-65); /* 0xBF */
+	const __m256i third = _mm256_set1_epi8((char)(0xE0 - 0x80));
+	const __m256i fourth = _mm256_set1_epi8((char)(0xF0 - 0x80));
+	const __m256i msb = _mm256_set1_epi8((char)0x80);
+	__m256i in, prev_in = _mm256_setzero_si256(), prev1, sc, must23, err;
+	unsigned int start = pos;
+	int tail_ascii = 1;
+
+	for (; pos + 32U <= buf_len; pos += 32U) {
+		in = _mm256_loadu_si256((const __m256i *)(buf + pos));
+
+		/* ASCII blocks are valid unless the previous block ended inside a
+		   multibyte character */
+		if (!_mm256_movemask_epi8(in) && tail_ascii) {
+			*num_codepoints += 32U;
+			prev_in = in;
+			continue;
+		}
+
+		prev1 = vtparse_utf8_prev_avx2(in, prev_in, 1);
+		sc = _mm256_and_si256(
+		    _mm256_and_si256(
+		        _mm256_shuffle_epi8(
+		            byte_1_high_tbl,
+		            _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+		        _mm256_shuffle_epi8(byte_1_low_tbl,
+		                            _mm256_and_si256(prev1, nibble))),
+		    _mm256_shuffle_epi8(
+		        byte_2_high_tbl,
+		        _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+		must23 = _mm256_or_si256(
+		    _mm256_subs_epu8(vtparse_utf8_prev_avx2(in, prev_in, 2), third),
+		    _mm256_subs_epu8(vtparse_utf8_prev_avx2(in, prev_in, 3), fourth));
+		err = _mm256_xor_si256(_mm256_and_si256(must23, msb), sc);
+		if (!_mm256_testz_si256(err, err)) {
+			break;
+		}
+
+		*num_codepoints += (unsigned int)__builtin_popcount(
+		    (unsigned int)_mm256_movemask_epi8(_mm256_cmpgt_epi8(in, not_cont)));
+		tail_ascii = buf[pos + 31U] < 0x80U;
+		prev_in = in;
+	}
+
+	/* Spans are short; skip another 16 bytes of ASCII before handing the
+	   rest to the scalar decoder */
+	if (pos + 32U > buf_len && pos + 16U <= buf_len && tail_ascii &&
+	    !_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(buf + pos)))) {
+		*num_codepoints += 16U;
+		pos += 16U;
+	}
+	return vtparse_utf8_complete_end(buf, start, pos, num_codepoints);
+}
+
+/*
+ * AVX-512 (requires AVX512BW for byte-granular operations). Masked loads
+ * handle the tail without touching memory past the end of the buffer.
+ */
+
+__attribute__((target("avx512f,avx512bw"))) static unsigned int
+vtparse_scan_string_avx512(const vtparse_run_class_t *cls,
+                           const unsigned char *buf, unsigned int pos,
+                           unsigned int buf_len) {
+	__m512i lo[VTPARSE_MAX_RUN_RANGES], width[VTPARSE_MAX_RUN_RANGES], x;
+	__mmask64 valid, in;
+	unsigned int r;
+
+	for (r = 0; r < cls->num_ranges; r++) {
+		lo[r] = _mm512_set1_epi8((char)cls->lo[r]);
+		width[r] = _mm512_set1_epi8((char)(cls->hi[r] - cls->lo[r]));
+	}
+	for (; pos < buf_len; pos += 64U) {
+		valid = (buf_len - pos >= 64U)
+		            ? ~(__mmask64)0
+		            : (((__mmask64)1 << (buf_len - pos)) - 1U);
+		x = _mm512_maskz_loadu_epi8(valid, buf + pos);
+		in = 0;
+		for (r = 0; r < cls->num_ranges; r++) {
+			in |= _mm512_cmple_epu8_mask(_mm512_sub_epi8(x, lo[r]), width[r]);
+		}
+		in = ~in & valid;
+		if (in) {
+			return pos + (unsigned int)__builtin_ctzll(in);
+		}
+	}
+	return buf_len;
+}
+
+__attribute__((target("avx512f,avx512bw"))) static unsigned int
+vtparse_scan_ground_avx512(const vtparse_run_class_t *cls,
+                           const unsigned char *buf, unsigned int pos,
+                           unsigned int buf_len) {
+	__m512i lo, width;
+	__mmask64 in;
+
+	if (cls->num_ranges != 1U) {
+		return vtparse_scan_string_avx512(cls, buf, pos, buf_len);
+	}
+	lo = _mm512_set1_epi8((char)cls->lo[0]);
+	width = _mm512_set1_epi8((char)(cls->hi[0] - cls->lo[0]));
+	for (; pos + 64U <= buf_len; pos += 64U) {
+		in = _mm512_cmple_epu8_mask(
+		    _mm512_sub_epi8(_mm512_loadu_si512((const void *)(buf + pos)), lo),
+		    width);
+		if (~in) {
+			return pos + (unsigned int)__builtin_ctzll(~in);
+		}
+	}
+	return vtparse_scan_string_avx512(cls, buf, pos, buf_len);
+}
+
+/* The parameter lists are typically far shorter than a single SSE2 register,
+   hence the SSE2 parameter decoder is used for the wider instruction sets as
+   well. Likewise, the AVX2 UTF-8 validator is used on AVX-512 machines. */
+
+static const vtparse_kernels_t VTPARSE_KERNELS_SSE2 = {
+    VTPARSE_ISA_SSE2, vtparse_scan_ground_sse2, vtparse_scan_string_sse2,
+    vtparse_decode_params_sse2, vtparse_validate_utf8_sse2};
+
+static const vtparse_kernels_t VTPARSE_KERNELS_AVX2 = {
+    VTPARSE_ISA_AVX2, vtparse_scan_ground_avx2, vtparse_scan_string_avx2,
+    vtparse_decode_params_sse2, vtparse_validate_utf8_avx2};
+
+static const vtparse_kernels_t VTPARSE_KERNELS_AVX512 = {
+    VTPARSE_ISA_AVX512, vtparse_scan_ground_avx512, vtparse_scan_string_avx512,
+    vtparse_decode_params_sse2, vtparse_validate_utf8_avx2};
+
+#endif /* VTPARSE_DISPATCH_X86 */
+
+/******************************************************************************
+ * Selection                                                                  *
+ ******************************************************************************/
+
+/* Kernels selected by vtparse_set_isa() or lazily by vtparse_get_kernels();
+   only accessed through the VTPARSE_ATOMIC_* macros */
+static const vtparse_kernels_t *vtparse_kernels = 0;
+
+VTPARSE_INTERNAL int vtparse_cpu_isa(void) {
+#ifdef VTPARSE_DISPATCH_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") &&
+	    __builtin_cpu_supports("avx512bw")) {
+		return VTPARSE_ISA_AVX512;
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		return VTPARSE_ISA_AVX2;
+	}
+	return VTPARSE_ISA_SSE2; /* Part of the x86-64 baseline */
+#else
+	return VTPARSE_ISA_SCALAR;
+#endif
+}
+
+#ifdef VTPARSE_DISPATCH_GETENV
+static int vtparse_streq(const char *a, const char *b) {
+	while (*a && *a == *b) {
+		a++, b++;
+	}
+	return *a == *b;
+}
+#endif
+
+/**
+ * Reads the VTPARSE_FORCE_ISA environment variable. Returns
+ * VTPARSE_ISA_AUTO if the variable is not set or invalid.
+ */
+static int vtparse_forced_isa(void) {
+#ifdef VTPARSE_DISPATCH_GETENV
+	const char *s = getenv("VTPARSE_FORCE_ISA");
+	if (s) {
+		if (vtparse_streq(s, "scalar")) {
+			return VTPARSE_ISA_SCALAR;
+		} else if (vtparse_streq(s, "sse2")) {
+			return VTPARSE_ISA_SSE2;
+		} else if (vtparse_streq(s, "avx2")) {
+			return VTPARSE_ISA_AVX2;
+		} else if (vtparse_streq(s, "avx512")) {
+			return VTPARSE_ISA_AVX512;
+		}
+	}
+#endif
+	return VTPARSE_ISA_AUTO;
+}
+
+/**
+ * Returns the kernel table for the given VTPARSE_ISA_* constant.
+ */
+static const vtparse_kernels_t *vtparse_select_kernels(int isa) {
+	const int supported = vtparse_cpu_isa();
+
+	if (isa == VTPARSE_ISA_AUTO) {
+		isa = vtparse_forced_isa();
+	}
+	if (isa == VTPARSE_ISA_AUTO || isa > supported) {
+		isa = supported;
+	}
+	switch (isa) {
+#ifdef VTPARSE_DISPATCH_X86
+		case VTPARSE_ISA_AVX512:
+			return &VTPARSE_KERNELS_AVX512;
+		case VTPARSE_ISA_AVX2:
+			return &VTPARSE_KERNELS_AVX2;
+		case VTPARSE_ISA_SSE2:
+			return &VTPARSE_KERNELS_SSE2;
+#endif
+		default:
+			return &VTPARSE_KERNELS_SCALAR;
+	}
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API int vtparse_set_isa(int isa) {
+	const vtparse_kernels_t *kernels = vtparse_select_kernels(isa);
+	VTPARSE_ATOMIC_STORE(&vtparse_kernels, kernels);
+	return kernels->isa;
+}
+
+VTPARSE_API int vtparse_get_isa(void) {
+	return vtparse_get_kernels()->isa;
+}
+
+VTPARSE_INTERNAL const vtparse_kernels_t *vtparse_get_kernels(void) {
+	const vtparse_kernels_t *kernels = VTPARSE_ATOMIC_LOAD(&vtparse_kernels);
+	const vtparse_kernels_t *expected = 0;
+	if (!kernels) {
+		/* Threads racing here all select the same kernels; a concurrent
+		   vtparse_set_isa() takes precedence */
+		kernels = vtparse_select_kernels(VTPARSE_ISA_AUTO);
+		if (!VTPARSE_ATOMIC_INIT(&vtparse_kernels, &expected, kernels)) {
+			kernels = expected;
+		}
+	}
+	return kernels;
+}
@@ -0,0 +1,167 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_dispatch.h
+ *
+ * Internal interface between the parser and the instruction set specific
+ * kernels. The kernels are selected once for the running CPU; each parser
+ * instance stores a pointer at the kernel table in effect when vtparse_init()
+ * was called.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_DISPATCH_H
+#define VTPARSE_VTPARSE_DISPATCH_H
+
+#include <vtparse/vtparse.h>
+#include <vtparse/vtparse_table.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Defined if the compiler supports per-function target attributes and the
+ * x86 intrinsics, i.e. if the SSE2, AVX2 and AVX-512 kernels are built.
+ */
+#if defined(__GNUC__) && defined(__x86_64__) && \
+    (__GNUC__ >= 5 || defined(__clang__))
+#define VTPARSE_DISPATCH_X86 1
+#endif
+
+/**
+ * Storage class of the functions declared in this header. They are shared
+ * between the translation units of the library but hidden in the shared
+ * library, just like the generated tables; vtparse_amalgamated.h sets this to
+ * VTPARSE_API.
+ */
+#ifndef VTPARSE_INTERNAL
+#if defined(__GNUC__) && !defined(_WIN32) && !defined(__CYGWIN__)
+#define VTPARSE_INTERNAL __attribute__((visibility("hidden")))
+#else
+#define VTPARSE_INTERNAL
+#endif
+#endif
+
+/**
+ * Atomic access to the pointers at the selected kernels, which are set lazily
+ * by the first parser and may be read from several threads at once. Falls
+ * back to plain accesses for compilers without the GCC atomic builtins.
+ */
+#if defined(__GNUC__)
+#define VTPARSE_ATOMIC_LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define VTPARSE_ATOMIC_STORE(ptr, value) \
+	__atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#define VTPARSE_ATOMIC_INIT(ptr, expected, value)                 \
+	__atomic_compare_exchange_n((ptr), (expected), (value), 0, \
+	                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#else
+#define VTPARSE_ATOMIC_LOAD(ptr) (*(ptr))
+#define VTPARSE_ATOMIC_STORE(ptr, value) (*(ptr) = (value))
+#define VTPARSE_ATOMIC_INIT(ptr, expected, value) (*(ptr) = (value), 1)
+#endif
+
+/**
+ * Minimum number of remaining input bytes for which the parser calls a scan
+ * kernel instead of its inline loop.
+ */
+#define VTPARSE_SCAN_MIN_LEN 16U
+
+/**
+ * Returns the index of the first byte in buf[pos] to buf[buf_len - 1] that is
+ * not contained in the given run class, or buf_len if there is no such byte.
+ * cls->num_ranges must be larger than zero.
+ */
+typedef unsigned int (*vtparse_scan_kernel_t)(const vtparse_run_class_t *cls,
+                                              const unsigned char *buf,
+                                              unsigned int pos,
+                                              unsigned int buf_len);
+
+/**
+ * Decodes the raw parameter bytes p to end - 1 (digits and ';', at least one
+ * byte) into params, as if they were passed to an empty parameter list one
+ * after another. Returns the number of parameters, or -1 if there are more
+ * than VTPARSE_MAX_PARAMS parameters (params is clobbered in this case).
+ */
+typedef int (*vtparse_decode_params_kernel_t)(int *params,
+                                              const unsigned char *p,
+                                              const unsigned char *end);
+
+/**
+ * Validates UTF-8 starting at buf[pos], which must be the first byte of a
+ * character. Returns the end of a prefix of buf[pos] to buf[buf_len - 1] that
+ * consists of complete, valid characters and adds the number of characters in
+ * the prefix to *num_codepoints. The kernel may stop before the first invalid
+ * or truncated character; the caller continues with the scalar decoder.
+ */
+typedef unsigned int (*vtparse_utf8_kernel_t)(const unsigned char *buf,
+                                              unsigned int pos,
+                                              unsigned int buf_len,
+                                              unsigned int *num_codepoints);
+
+/**
+ * Set of kernels for one instruction set. NULL entries select the portable
+ * code inlined into the parser.
+ */
+typedef struct vtparse_kernels {
+	int isa;
+
+	/**
+	 * Scanner for runs of VTPARSE_ACTION_PRINT in the ground state.
+	 */
+	vtparse_scan_kernel_t scan_ground;
+
+	/**
+	 * Scanner for runs of VTPARSE_ACTION_PUT and VTPARSE_ACTION_OSC_PUT in the
+	 * DCS and OSC string states.
+	 */
+	vtparse_scan_kernel_t scan_string;
+
+	/**
+	 * Decoder for raw parameter bytes, see VTPARSE_OPTION_LAZY_PARAMS.
+	 */
+	vtparse_decode_params_kernel_t decode_params;
+
+	/**
+	 * UTF-8 validator used by vtparse_utf8_validate().
+	 */
+	vtparse_utf8_kernel_t validate_utf8;
+} vtparse_kernels_t;
+
+/**
+ * Returns the widest instruction set supported by the CPU (and the compiler).
+ */
+VTPARSE_INTERNAL int vtparse_cpu_isa(void);
+
+/**
+ * Returns the kernel table for the instruction set selected by
+ * vtparse_set_isa(). Upon the first call, selects the widest instruction set
+ * supported by the CPU, unless overridden by the VTPARSE_FORCE_ISA
+ * environment variable.
+ */
+VTPARSE_INTERNAL const vtparse_kernels_t *vtparse_get_kernels(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_DISPATCH_H */
@@ -0,0 +1,237 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_grapheme.c
+ *
+ * Implementation of the grapheme cluster segmenter. The rules that only depend
+ * on the classes of two adjacent characters are encoded in GRAPHEME_NO_BREAK,
+ * generated by tables/vtparse_gen_grapheme_tables.rb along with the classes;
+ * the emoji ZWJ sequence and regional indicator rules are implemented here.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <vtparse/vtparse_dispatch.h>
+#include <vtparse/vtparse_grapheme.h>
+#include <vtparse/vtparse_grapheme_table.h>
+
+/* Values of priv_.emoji, tracking the context of rule GB11 */
+#define EMOJI_NONE 0U
+#define EMOJI_PICTOGRAPHIC 1U /* Extended_Pictographic Extend* */
+#define EMOJI_ZWJ 2U          /* Extended_Pictographic Extend* ZWJ */
+
+/* Printable ASCII characters, each of which is a cluster of its own unless
+   preceded by a prepended concatenation mark */
+static const vtparse_run_class_t vtparse_printable_ascii = {
+    VTPARSE_ACTION_PRINT, 1, {0x20}, {0x7E}};
+
+/******************************************************************************
+ * Internal functions                                                         *
+ ******************************************************************************/
+
+static int vtparse_grapheme_class(unsigned long codepoint) {
+	unsigned int block;
+	if (codepoint > 0x10FFFFUL) {
+		return VTPARSE_GRAPHEME_OTHER;
+	}
+	block = GRAPHEME_STAGE1[codepoint >> VTPARSE_GRAPHEME_BLOCK_BITS];
+	return (GRAPHEME_STAGE2[block][(codepoint & 0xFFU) >> 1U] >>
+	        ((codepoint & 1U) << 2U)) &
+	       0x0F;
+}
+
+/**
+ * Returns non-zero if there is a cluster boundary before a character of the
+ * given class and advances the state past the character.
+ */
+static int vtparse_grapheme_push(vtparse_grapheme_t *grapheme, int cls) {
+	const int prev = grapheme->priv_.prev;
+	int brk = !((GRAPHEME_NO_BREAK[prev] >> cls) & 1U);
+
+	if (brk) {
+		if (cls == VTPARSE_GRAPHEME_EXTENDED_PICTOGRAPHIC &&
+		    grapheme->priv_.emoji == EMOJI_ZWJ) {
+			brk = 0; /* GB11 */
+		} else if (cls == VTPARSE_GRAPHEME_REGIONAL_INDICATOR &&
+		           prev == VTPARSE_GRAPHEME_REGIONAL_INDICATOR &&
+		           grapheme->priv_.ri_odd) {
+			brk = 0; /* GB12, GB13 */
+		}
+	}
+
+	if (cls == VTPARSE_GRAPHEME_EXTENDED_PICTOGRAPHIC) {
+		grapheme->priv_.emoji = EMOJI_PICTOGRAPHIC;
+	} else if (grapheme->priv_.emoji == EMOJI_PICTOGRAPHIC &&
+	           cls == VTPARSE_GRAPHEME_ZWJ) {
+		grapheme->priv_.emoji = EMOJI_ZWJ;
+	} else if (grapheme->priv_.emoji != EMOJI_PICTOGRAPHIC ||
+	           cls != VTPARSE_GRAPHEME_EXTEND) {
+		grapheme->priv_.emoji = EMOJI_NONE;
+	}
+	if (cls == VTPARSE_GRAPHEME_REGIONAL_INDICATOR) {
+		grapheme->priv_.ri_odd =
+		    (prev == VTPARSE_GRAPHEME_REGIONAL_INDICATOR)
+		        ? !grapheme->priv_.ri_odd
+		        : 1U;
+	} else {
+		grapheme->priv_.ri_odd = 0;
+	}
+	grapheme->priv_.prev = (unsigned char)cls;
+	return brk;
+}
+
+static int vtparse_grapheme_is_ascii(unsigned char c) {
+	return c - 0x20U < 0x5FU;
+}
+
+/**
+ * Returns the end of the run of printable ASCII characters starting at pos
+ * and sets the state to that after an ordinary character.
+ */
+static unsigned int vtparse_grapheme_skip_ascii(vtparse_grapheme_t *grapheme,
+                                                const unsigned char *buf,
+                                                unsigned int pos,
+                                                unsigned int len) {
+	const vtparse_scan_kernel_t scan = grapheme->priv_.utf8.kernels->scan_ground;
+	if (scan && len - pos >= VTPARSE_SCAN_MIN_LEN) {
+		pos = scan(&vtparse_printable_ascii, buf, pos, len);
+	} else {
+		while (pos < len && vtparse_grapheme_is_ascii(buf[pos])) {
+			pos++;
+		}
+	}
+	grapheme->priv_.prev = VTPARSE_GRAPHEME_OTHER;
+	grapheme->priv_.ri_odd = 0;
+	grapheme->priv_.emoji = EMOJI_NONE;
+	return pos;
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API void vtparse_grapheme_init(vtparse_grapheme_t *grapheme) {
+	grapheme->num_codepoints = 0;
+	grapheme->ascii_begin = grapheme->ascii_end = 0;
+	grapheme->extends = 0;
+	vtparse_utf8_init(&grapheme->priv_.utf8);
+	grapheme->priv_.prev = VTPARSE_GRAPHEME_SOT;
+	grapheme->priv_.ri_odd = 0;
+	grapheme->priv_.emoji = EMOJI_NONE;
+}
+
+VTPARSE_API unsigned int vtparse_grapheme_next(vtparse_grapheme_t *grapheme,
+                                               const unsigned char *buf,
+                                               unsigned int len) {
+	vtparse_utf8_t utf8;
+	unsigned int pos = 0, n_read;
+	unsigned char prev, ri_odd, emoji;
+	unsigned long codepoint;
+	int cls;
+
+	grapheme->num_codepoints = 0;
+	grapheme->ascii_begin = grapheme->ascii_end = buf;
+	grapheme->extends = 0;
+
+	/* Fast path for a run of ASCII characters */
+	if (len > 0U && !grapheme->priv_.utf8.need &&
+	    vtparse_grapheme_is_ascii(buf[0]) &&
+	    grapheme->priv_.prev != VTPARSE_GRAPHEME_PREPEND) {
+		pos = vtparse_grapheme_skip_ascii(grapheme, buf, 0, len);
+		grapheme->ascii_end = buf + pos;
+		return pos;
+	}
+
+	while (pos < len &&
+	       grapheme->num_codepoints < VTPARSE_GRAPHEME_MAX_CODEPOINTS) {
+		/* ASCII characters start a new cluster, leave them to the fast path */
+		if (grapheme->num_codepoints > 0U && !grapheme->priv_.utf8.need &&
+		    vtparse_grapheme_is_ascii(buf[pos]) &&
+		    grapheme->priv_.prev != VTPARSE_GRAPHEME_PREPEND) {
+			break;
+		}
+
+		/* Decode the next character, but leave it in the input if it starts
+		   a new cluster or is incomplete */
+		utf8 = grapheme->priv_.utf8;
+		prev = grapheme->priv_.prev;
+		ri_odd = grapheme->priv_.ri_odd;
+		emoji = grapheme->priv_.emoji;
+		if (!vtparse_utf8_next(&grapheme->priv_.utf8, buf + pos, len - pos,
+		                       &n_read, &codepoint)) {
+			if (grapheme->num_codepoints > 0U) {
+				grapheme->priv_.utf8 = utf8;
+			} else {
+				pos += n_read;
+			}
+			break;
+		}
+		cls = vtparse_grapheme_class(codepoint);
+		if (vtparse_grapheme_push(grapheme, cls)) {
+			if (grapheme->num_codepoints > 0U) {
+				grapheme->priv_.utf8 = utf8;
+				grapheme->priv_.prev = prev;
+				grapheme->priv_.ri_odd = ri_odd;
+				grapheme->priv_.emoji = emoji;
+				break;
+			}
+		} else if (grapheme->num_codepoints == 0U) {
+			grapheme->extends = 1;
+		}
+		grapheme->codepoints[grapheme->num_codepoints++] = codepoint;
+		pos += n_read;
+	}
+	return pos;
+}
+
+VTPARSE_API unsigned int vtparse_grapheme_count(vtparse_grapheme_t *grapheme,
+                                                const unsigned char *buf,
+                                                unsigned int len) {
+	unsigned int pos = 0, end, n_read, n = 0;
+	unsigned long codepoint;
+	int prepend;
+
+	while (pos < len) {
+		if (!grapheme->priv_.utf8.need && vtparse_grapheme_is_ascii(buf[pos])) {
+			/* The first character continues a preceding prepend cluster */
+			prepend = grapheme->priv_.prev == VTPARSE_GRAPHEME_PREPEND;
+			end = vtparse_grapheme_skip_ascii(grapheme, buf, pos, len);
+			n += end - pos - (prepend ? 1U : 0U);
+			pos = end;
+			continue;
+		}
+		if (!vtparse_utf8_next(&grapheme->priv_.utf8, buf + pos, len - pos,
+		                       &n_read, &codepoint)) {
+			break;
+		}
+		n += (unsigned int)vtparse_grapheme_push(
+		    grapheme, vtparse_grapheme_class(codepoint));
+		pos += n_read;
+	}
+	return n;
+}
+
+VTPARSE_API int vtparse_grapheme_break(vtparse_grapheme_t *grapheme) {
+	grapheme->priv_.prev = VTPARSE_GRAPHEME_SOT;
+	grapheme->priv_.ri_odd = 0;
+	grapheme->priv_.emoji = EMOJI_NONE;
+	return vtparse_utf8_flush(&grapheme->priv_.utf8);
+}
@@ -0,0 +1,138 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_grapheme.h
+ *
+ * Streaming segmentation of VTPARSE_ACTION_PRINT data ranges into grapheme
+ * clusters (extended grapheme clusters as defined in Unicode Standard Annex
+ * #29), i.e. the units a terminal stores in a single cell: a base character
+ * with its combining marks, an emoji ZWJ sequence, a pair of regional
+ * indicators, or a Hangul syllable spelled in Jamo.
+ *
+ * The segmenter keeps its state across ranges, so a cluster may continue in
+ * the next range; for example, a combining mark may follow a character
+ * printed before an SGR sequence. Runs of printable ASCII characters are
+ * returned as a whole without being decoded.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_GRAPHEME_H
+#define VTPARSE_VTPARSE_GRAPHEME_H
+
+#include <vtparse/vtparse_utf8.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Maximum number of code points returned per segment. Longer clusters are
+ * returned as several segments.
+ */
+#define VTPARSE_GRAPHEME_MAX_CODEPOINTS 16
+
+/**
+ * Segmenter state and the segment returned by vtparse_grapheme_next().
+ */
+typedef struct vtparse_grapheme {
+	/**
+	 * Code points of the current segment, which belong to a single cluster.
+	 * Empty if the segment is a run of ASCII characters.
+	 */
+	unsigned long codepoints[VTPARSE_GRAPHEME_MAX_CODEPOINTS];
+	unsigned int num_codepoints;
+
+	/**
+	 * Run of printable ASCII characters, each of which is a cluster of its
+	 * own. Empty if the segment consists of code points.
+	 */
+	const unsigned char *ascii_begin;
+	const unsigned char *ascii_end;
+
+	/**
+	 * Non-zero if the segment continues the last cluster of the preceding
+	 * segment instead of starting a new one.
+	 */
+	int extends;
+
+	/**
+	 * Internal state. Do not access directly.
+	 */
+	struct {
+		vtparse_utf8_t utf8;
+		unsigned char prev;
+		unsigned char ri_odd;
+		unsigned char emoji;
+	} priv_;
+} vtparse_grapheme_t;
+
+/**
+ * Resets the segmenter to the start of a text.
+ */
+VTPARSE_API void vtparse_grapheme_init(vtparse_grapheme_t *grapheme);
+
+/**
+ * Returns the next segment of the given range in the codepoints or ascii_begin
+ * fields of the segmenter. Call repeatedly until the entire range has been
+ * consumed:
+ *
+ *     while (pos < len) {
+ *         pos += vtparse_grapheme_next(&grapheme, buf + pos, len - pos);
+ *         ...
+ *     }
+ *
+ * The segment is empty if the range ends with an incomplete UTF-8 sequence,
+ * which is carried over to the next call.
+ *
+ * @param grapheme is the segmenter.
+ * @param buf points at the data, e.g. parser.data_begin.
+ * @param len is the number of bytes.
+ * @return the number of consumed bytes.
+ */
+VTPARSE_API unsigned int vtparse_grapheme_next(vtparse_grapheme_t *grapheme,
+                                               const unsigned char *buf,
+                                               unsigned int len);
+
+/**
+ * Returns the number of clusters starting in the given range, i.e. the number
+ * of cells the cursor advances by if every cluster occupies one cell.
+ * Equivalent to counting the segments returned by vtparse_grapheme_next()
+ * (runs of ASCII characters counting once per character) whose extends flag
+ * is not set.
+ */
+VTPARSE_API unsigned int vtparse_grapheme_count(vtparse_grapheme_t *grapheme,
+                                                const unsigned char *buf,
+                                                unsigned int len);
+
+/**
+ * Forces a cluster boundary, e.g. when a control character interrupts the
+ * text. Escape sequences that do not move the cursor, such as SGR, need not
+ * interrupt clusters. Returns a non-zero value if an incomplete character was
+ * discarded (see vtparse_utf8_flush()).
+ */
+VTPARSE_API int vtparse_grapheme_break(vtparse_grapheme_t *grapheme);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_GRAPHEME_H */
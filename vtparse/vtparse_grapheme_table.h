@@ -0,0 +1,54 @@
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_grapheme_tables.rb to re-generate this file.            *
+ ******************************************************************************/
+
+#ifndef VTPARSE_VTPARSE_GRAPHEME_TABLE_H
+#define VTPARSE_VTPARSE_GRAPHEME_TABLE_H
+
+#include <vtparse/vtparse_table_decl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+   VTPARSE_GRAPHEME_OTHER = 0,
+   VTPARSE_GRAPHEME_CR = 1,
+   VTPARSE_GRAPHEME_LF = 2,
+   VTPARSE_GRAPHEME_CONTROL = 3,
+   VTPARSE_GRAPHEME_EXTEND = 4,
+   VTPARSE_GRAPHEME_ZWJ = 5,
+   VTPARSE_GRAPHEME_REGIONAL_INDICATOR = 6,
+   VTPARSE_GRAPHEME_PREPEND = 7,
+   VTPARSE_GRAPHEME_SPACING_MARK = 8,
+   VTPARSE_GRAPHEME_L = 9,
+   VTPARSE_GRAPHEME_V = 10,
+   VTPARSE_GRAPHEME_T = 11,
+   VTPARSE_GRAPHEME_LV = 12,
+   VTPARSE_GRAPHEME_LVT = 13,
+   VTPARSE_GRAPHEME_EXTENDED_PICTOGRAPHIC = 14,
+   VTPARSE_GRAPHEME_SOT = 15,
+} vtparse_grapheme_class_t;
+
+/* Grapheme break classes of all code points, Unicode 15.0.0. The first
+   stage maps bits 8 to 20 of a code point to a block of the second stage;
+   each block holds the classes of 256 code points, packed with four bits
+   per code point, least significant bits first. */
+#define VTPARSE_GRAPHEME_UNICODE_VERSION "15.0.0"
+#define VTPARSE_GRAPHEME_BLOCK_BITS 8
+#define VTPARSE_GRAPHEME_NUM_BLOCKS 103
+
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char GRAPHEME_STAGE1[4352];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char GRAPHEME_STAGE2[103][128];
+
+/* Bit i of GRAPHEME_NO_BREAK[c] is set if there is no boundary between a
+   character of class c and a following character of class i. */
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned short GRAPHEME_NO_BREAK[16];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_GRAPHEME_TABLE_H */
+
@@ -0,0 +1,53 @@
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_hot_transitions.rb to re-generate this file.            *
+ ******************************************************************************/
+
+/* Included by vtparse.c only. Generated from the profile of
+   3042488 bytes in vtparse_profile.txt; the inlined transitions
+   cover 81.70% of the profiled bytes. */
+
+#ifndef VTPARSE_VTPARSE_HOT_TRANSITIONS_H
+#define VTPARSE_VTPARSE_HOT_TRANSITIONS_H
+
+/**
+ * Performs the transition for the character ch just read at pos[-1] if it
+ * is one of the inlined transitions. Returns zero if the transition must be
+ * performed by the generic code.
+ */
+static int vtparse_hot_transition(vtparse_t *parser, unsigned char ch,
+                                  const unsigned char *pos) {
+	switch (parser->priv_.state) {
+		case VTPARSE_STATE_CSI_PARAM: /* 55.47% */
+			if ((ch >= 0x30 && ch <= 0x39) ||
+			    ch == 0x3b) { /* 55.47% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_PARAM, ch, pos);
+				return 1;
+			}
+			break;
+		case VTPARSE_STATE_GROUND: /* 8.77% */
+			if (ch == 0x1b) { /* 8.77% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_CLEAR, ch, pos);
+				vtparse_hot_enter(parser, VTPARSE_STATE_ESCAPE, pos);
+				return 1;
+			}
+			break;
+		case VTPARSE_STATE_ESCAPE: /* 8.77% */
+			if (ch == 0x5b) { /* 8.77% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_CLEAR, ch, pos);
+				vtparse_hot_enter(parser, VTPARSE_STATE_CSI_ENTRY, pos);
+				return 1;
+			}
+			break;
+		case VTPARSE_STATE_CSI_ENTRY: /* 8.69% */
+			if (ch >= 0x30 && ch <= 0x39) { /* 8.69% */
+				vtparse_execute_action(parser, VTPARSE_ACTION_PARAM, ch, pos);
+				vtparse_hot_enter(parser, VTPARSE_STATE_CSI_PARAM, pos);
+				return 1;
+			}
+			break;
+	}
+	return 0;
+}
+
+#endif /* VTPARSE_VTPARSE_HOT_TRANSITIONS_H */
@@ -0,0 +1,541 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_ingest.c
+ *
+ * Implementation of the ingestion module. The io_uring backend talks to the
+ * kernel directly via the io_uring_setup(), io_uring_enter() and
+ * io_uring_register() system calls and does not require liburing. It is only
+ * compiled if VTPARSE_HAVE_IO_URING is defined.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#ifdef VTPARSE_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+#include <vtparse/vtparse_ingest.h>
+
+#define DEFAULT_BUF_SIZE 65536U
+#define DEFAULT_N_BUFS 8U
+
+/* States of an input buffer */
+#define SLOT_FREE 0
+#define SLOT_IN_FLIGHT 1
+#define SLOT_READY 2
+#define SLOT_USER 3
+
+typedef struct {
+	unsigned char *data;
+	int state;
+
+	/* Sequence number and file offset of the read filling this buffer */
+	unsigned long long seq;
+	unsigned long long offset;
+
+	/* Result of the read (number of bytes or negative error code) */
+	int res;
+} vtparse_ingest_slot_t;
+
+#ifdef VTPARSE_HAVE_IO_URING
+typedef struct {
+	int fd;
+	unsigned int *sq_head, *sq_tail, *sq_mask, *sq_array;
+	unsigned int *cq_head, *cq_tail, *cq_mask;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	void *sq_ptr, *cq_ptr;
+	size_t sq_len, cq_len, sqes_len;
+	unsigned int to_submit;
+} vtparse_uring_t;
+#endif
+
+struct vtparse_ingest {
+	int fd;
+	int seekable;
+	int eof;
+	int error;
+	unsigned int buf_size, n_bufs, depth;
+	unsigned char *mem;
+	vtparse_ingest_slot_t *slots;
+
+	/* Bookkeeping of the reads in flight. Buffers are delivered in the order
+	   in which the reads were submitted. */
+	unsigned long long next_submit_seq, next_deliver_seq, next_offset;
+	unsigned int in_flight;
+
+	int use_uring;
+#ifdef VTPARSE_HAVE_IO_URING
+	vtparse_uring_t uring;
+#endif
+};
+
+/******************************************************************************
+ * io_uring backend                                                           *
+ ******************************************************************************/
+
+#ifdef VTPARSE_HAVE_IO_URING
+
+static void vtparse_uring_destroy(vtparse_uring_t *uring) {
+	if (uring->sqes) {
+		munmap(uring->sqes, uring->sqes_len);
+	}
+	if (uring->cq_ptr && uring->cq_ptr != uring->sq_ptr) {
+		munmap(uring->cq_ptr, uring->cq_len);
+	}
+	if (uring->sq_ptr) {
+		munmap(uring->sq_ptr, uring->sq_len);
+	}
+	if (uring->fd >= 0) {
+		close(uring->fd);
+	}
+	memset(uring, 0, sizeof(*uring));
+	uring->fd = -1;
+}
+
+static int vtparse_uring_init(vtparse_ingest_t *ingest) {
+	struct io_uring_params p;
+	struct iovec *iov;
+	vtparse_uring_t *uring = &ingest->uring;
+	unsigned char *sq, *cq;
+	unsigned int i;
+	int res;
+
+	memset(uring, 0, sizeof(*uring));
+	memset(&p, 0, sizeof(p));
+	uring->fd = (int)syscall(__NR_io_uring_setup, ingest->depth, &p);
+	if (uring->fd < 0) {
+		uring->fd = -1;
+		return -1;
+	}
+
+	/* Map the submission and completion queues */
+	uring->sq_len = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	uring->cq_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (uring->cq_len > uring->sq_len) {
+			uring->sq_len = uring->cq_len;
+		}
+		uring->cq_len = uring->sq_len;
+	}
+	uring->sq_ptr = mmap(NULL, uring->sq_len, PROT_READ | PROT_WRITE,
+	                     MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQ_RING);
+	if (uring->sq_ptr == MAP_FAILED) {
+		uring->sq_ptr = NULL;
+		goto err;
+	}
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		uring->cq_ptr = uring->sq_ptr;
+	} else {
+		uring->cq_ptr =
+		    mmap(NULL, uring->cq_len, PROT_READ | PROT_WRITE,
+		         MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_CQ_RING);
+		if (uring->cq_ptr == MAP_FAILED) {
+			uring->cq_ptr = NULL;
+			goto err;
+		}
+	}
+	uring->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+	uring->sqes = mmap(NULL, uring->sqes_len, PROT_READ | PROT_WRITE,
+	                   MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQES);
+	if (uring->sqes == MAP_FAILED) {
+		uring->sqes = NULL;
+		goto err;
+	}
+
+	sq = uring->sq_ptr;
+	cq = uring->cq_ptr;
+	uring->sq_head = (unsigned int *)(sq + p.sq_off.head);
+	uring->sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+	uring->sq_mask = (unsigned int *)(sq + p.sq_off.ring_mask);
+	uring->sq_array = (unsigned int *)(sq + p.sq_off.array);
+	uring->cq_head = (unsigned int *)(cq + p.cq_off.head);
+	uring->cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+	uring->cq_mask = (unsigned int *)(cq + p.cq_off.ring_mask);
+	uring->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+	/* Register the input buffers with the kernel, such that the pages do not
+	   have to be pinned for each individual read */
+	iov = malloc(ingest->n_bufs * sizeof(struct iovec));
+	if (!iov) {
+		goto err;
+	}
+	for (i = 0; i < ingest->n_bufs; i++) {
+		iov[i].iov_base = ingest->slots[i].data;
+		iov[i].iov_len = ingest->buf_size;
+	}
+	res = (int)syscall(__NR_io_uring_register, uring->fd,
+	                   IORING_REGISTER_BUFFERS, iov, ingest->n_bufs);
+	free(iov);
+	if (res < 0) {
+		goto err;
+	}
+	return 0;
+
+err:
+	vtparse_uring_destroy(uring);
+	return -1;
+}
+
+static void vtparse_uring_queue_read(vtparse_ingest_t *ingest,
+                                     unsigned int idx) {
+	vtparse_uring_t *uring = &ingest->uring;
+	vtparse_ingest_slot_t *slot = &ingest->slots[idx];
+	struct io_uring_sqe *sqe;
+	unsigned int tail, i;
+
+	/* We are the only producer, so the tail can be read non-atomically */
+	tail = *uring->sq_tail;
+	i = tail & *uring->sq_mask;
+	sqe = &uring->sqes[i];
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = IORING_OP_READ_FIXED;
+	sqe->fd = ingest->fd;
+	sqe->off = slot->offset;
+	sqe->addr = (unsigned long)slot->data;
+	sqe->len = ingest->buf_size;
+	sqe->buf_index = (unsigned short)idx;
+	sqe->user_data = idx;
+	uring->sq_array[i] = i;
+	__atomic_store_n(uring->sq_tail, tail + 1U, __ATOMIC_RELEASE);
+	uring->to_submit++;
+}
+
+static void vtparse_uring_reap(vtparse_ingest_t *ingest) {
+	vtparse_uring_t *uring = &ingest->uring;
+	vtparse_ingest_slot_t *slot;
+	struct io_uring_cqe *cqe;
+	unsigned int head, tail;
+
+	head = *uring->cq_head;
+	tail = __atomic_load_n(uring->cq_tail, __ATOMIC_ACQUIRE);
+	for (; head != tail; head++) {
+		cqe = &uring->cqes[head & *uring->cq_mask];
+		slot = &ingest->slots[cqe->user_data];
+		ingest->in_flight--;
+		if (slot->seq < ingest->next_deliver_seq) {
+			slot->state = SLOT_FREE; /* Discarded read, see below */
+		} else {
+			slot->state = SLOT_READY;
+			slot->res = cqe->res;
+		}
+	}
+	__atomic_store_n(uring->cq_head, head, __ATOMIC_RELEASE);
+}
+
+static int vtparse_uring_enter(vtparse_ingest_t *ingest,
+                               unsigned int min_complete) {
+	vtparse_uring_t *uring = &ingest->uring;
+	int res;
+
+	do {
+		res = (int)syscall(__NR_io_uring_enter, uring->fd, uring->to_submit,
+		                   min_complete,
+		                   min_complete ? IORING_ENTER_GETEVENTS : 0U, NULL, 0);
+	} while (res < 0 && errno == EINTR);
+	if (res < 0) {
+		return -1;
+	}
+	uring->to_submit -= (unsigned int)res;
+	vtparse_uring_reap(ingest);
+	return 0;
+}
+
+#endif /* VTPARSE_HAVE_IO_URING */
+
+/******************************************************************************
+ * Public API                                                                 *
+ ******************************************************************************/
+
+vtparse_ingest_t *vtparse_ingest_open(int fd,
+                                      const vtparse_ingest_config_t *config) {
+	vtparse_ingest_t *ingest;
+	struct stat st;
+	unsigned int i;
+	off_t pos;
+	void *mem;
+
+	ingest = calloc(1, sizeof(vtparse_ingest_t));
+	if (!ingest) {
+		return NULL;
+	}
+	ingest->fd = fd;
+	ingest->buf_size = DEFAULT_BUF_SIZE;
+	ingest->n_bufs = DEFAULT_N_BUFS;
+	if (config && config->buf_size) {
+		ingest->buf_size = config->buf_size;
+	}
+	if (config && config->n_bufs) {
+		ingest->n_bufs = config->n_bufs;
+	}
+	ingest->depth = ingest->n_bufs;
+	if (config && config->queue_depth && config->queue_depth < ingest->n_bufs) {
+		ingest->depth = config->queue_depth;
+	}
+
+	/* Only regular files and block devices can be read at explicit offsets;
+	   all other file types are read sequentially with a single read in
+	   flight */
+	ingest->next_offset = (unsigned long long)-1;
+	if (fstat(fd, &st) == 0 && (S_ISREG(st.st_mode) || S_ISBLK(st.st_mode))) {
+		pos = lseek(fd, 0, SEEK_CUR);
+		if (pos >= 0) {
+			ingest->seekable = 1;
+			ingest->next_offset = (unsigned long long)pos;
+		}
+	}
+	if (!ingest->seekable) {
+		ingest->depth = 1;
+	}
+
+	/* Allocate the input buffers as one page-aligned block */
+	if (posix_memalign(&mem, 4096U, (size_t)ingest->n_bufs * ingest->buf_size)) {
+		free(ingest);
+		return NULL;
+	}
+	ingest->mem = mem;
+	ingest->slots = calloc(ingest->n_bufs, sizeof(vtparse_ingest_slot_t));
+	if (!ingest->slots) {
+		free(ingest->mem);
+		free(ingest);
+		return NULL;
+	}
+	for (i = 0; i < ingest->n_bufs; i++) {
+		ingest->slots[i].data = ingest->mem + (size_t)i * ingest->buf_size;
+	}
+
+#ifdef VTPARSE_HAVE_IO_URING
+	ingest->uring.fd = -1;
+	if (!(config && (config->flags & VTPARSE_INGEST_NO_URING))) {
+		ingest->use_uring = vtparse_uring_init(ingest) == 0;
+	}
+#endif
+
+	return ingest;
+}
+
+void vtparse_ingest_close(vtparse_ingest_t *ingest) {
+	if (!ingest) {
+		return;
+	}
+#ifdef VTPARSE_HAVE_IO_URING
+	if (ingest->use_uring) {
+		/* The kernel may still write into the buffers; wait for all reads */
+		ingest->next_deliver_seq = ingest->next_submit_seq;
+		while (ingest->in_flight > 0U) {
+			if (vtparse_uring_enter(ingest, 1U) != 0) {
+				break;
+			}
+		}
+		vtparse_uring_destroy(&ingest->uring);
+	}
+#endif
+	free(ingest->slots);
+	free(ingest->mem);
+	free(ingest);
+}
+
+int vtparse_ingest_uses_uring(const vtparse_ingest_t *ingest) {
+	return ingest->use_uring;
+}
+
+static int vtparse_ingest_next_read(vtparse_ingest_t *ingest,
+                                    vtparse_ingest_buf_t *buf) {
+	unsigned int i;
+	ssize_t n;
+
+	if (ingest->eof) {
+		return 0;
+	}
+	for (i = 0; i < ingest->n_bufs; i++) {
+		if (ingest->slots[i].state == SLOT_FREE) {
+			break;
+		}
+	}
+	if (i == ingest->n_bufs) {
+		errno = ENOBUFS;
+		return -1;
+	}
+	do {
+		n = read(ingest->fd, ingest->slots[i].data, ingest->buf_size);
+	} while (n < 0 && errno == EINTR);
+	if (n <= 0) {
+		ingest->eof = (n == 0);
+		return (int)n;
+	}
+	ingest->slots[i].state = SLOT_USER;
+	buf->data = ingest->slots[i].data;
+	buf->len = (unsigned int)n;
+	buf->idx = i;
+	return 1;
+}
+
+#ifdef VTPARSE_HAVE_IO_URING
+static int vtparse_ingest_next_uring(vtparse_ingest_t *ingest,
+                                     vtparse_ingest_buf_t *buf) {
+	vtparse_ingest_slot_t *slot;
+	unsigned int i, j;
+
+	while (1) {
+		if (ingest->error) {
+			errno = ingest->error;
+			return -1;
+		}
+
+		/* Deliver the next buffer if its read has completed */
+		for (i = 0; i < ingest->n_bufs; i++) {
+			slot = &ingest->slots[i];
+			if (slot->state == SLOT_READY &&
+			    slot->seq == ingest->next_deliver_seq) {
+				break;
+			}
+		}
+		if (i < ingest->n_bufs) {
+			if (slot->res == -EINTR || slot->res == -EAGAIN) {
+				/* Retry the same read */
+				slot->state = SLOT_IN_FLIGHT;
+				ingest->in_flight++;
+				vtparse_uring_queue_read(ingest, i);
+			} else if (slot->res < 0) {
+				slot->state = SLOT_FREE;
+				ingest->error = -slot->res;
+				continue;
+			} else if (slot->res == 0) {
+				/* End of file; discard all reads beyond this one */
+				slot->state = SLOT_FREE;
+				ingest->eof = 1;
+				ingest->next_deliver_seq = ingest->next_submit_seq;
+				return 0;
+			} else {
+				/* A short read that is not at the end of the file shifts
+				   the offsets of all subsequent reads. Discard them and
+				   continue reading after this buffer. */
+				slot->state = SLOT_USER;
+				ingest->next_deliver_seq++;
+				if (ingest->seekable &&
+				    (unsigned int)slot->res < ingest->buf_size) {
+					ingest->next_offset =
+					    slot->offset + (unsigned long long)slot->res;
+					ingest->next_deliver_seq = ingest->next_submit_seq;
+					for (j = 0; j < ingest->n_bufs; j++) {
+						if (ingest->slots[j].state == SLOT_READY) {
+							ingest->slots[j].state = SLOT_FREE;
+						}
+					}
+				}
+				buf->data = slot->data;
+				buf->len = (unsigned int)slot->res;
+				buf->idx = i;
+				return 1;
+			}
+		}
+		if (ingest->eof) {
+			return 0;
+		}
+
+		/* Keep as many reads in flight as possible */
+		for (i = 0; i < ingest->n_bufs && ingest->in_flight < ingest->depth;
+		     i++) {
+			slot = &ingest->slots[i];
+			if (slot->state != SLOT_FREE) {
+				continue;
+			}
+			slot->state = SLOT_IN_FLIGHT;
+			slot->seq = ingest->next_submit_seq++;
+			slot->offset = ingest->next_offset;
+			if (ingest->seekable) {
+				ingest->next_offset += ingest->buf_size;
+			}
+			ingest->in_flight++;
+			vtparse_uring_queue_read(ingest, i);
+		}
+		if (ingest->in_flight == 0U) {
+			errno = ENOBUFS; /* All buffers are held by the caller */
+			return -1;
+		}
+
+		/* Submit the new reads and wait for at least one completion */
+		if (vtparse_uring_enter(ingest, 1U) != 0) {
+			return -1;
+		}
+	}
+}
+#endif /* VTPARSE_HAVE_IO_URING */
+
+int vtparse_ingest_next(vtparse_ingest_t *ingest, vtparse_ingest_buf_t *buf) {
+#ifdef VTPARSE_HAVE_IO_URING
+	if (ingest->use_uring) {
+		return vtparse_ingest_next_uring(ingest, buf);
+	}
+#endif
+	return vtparse_ingest_next_read(ingest, buf);
+}
+
+void vtparse_ingest_release(vtparse_ingest_t *ingest,
+                            const vtparse_ingest_buf_t *buf) {
+	ingest->slots[buf->idx].state = SLOT_FREE;
+}
+
+int vtparse_ingest_run(vtparse_ingest_t *ingest, vtparse_t *parser,
+                       vtparse_ingest_callback_t callback, void *user_data) {
+	vtparse_ingest_buf_t buf;
+	unsigned int buf_pos;
+	int res;
+
+	while ((res = vtparse_ingest_next(ingest, &buf)) > 0) {
+		/* Feed the buffer into the parser until we processed all bytes; once
+		   vtparse_has_event() returns false, no event references the buffer
+		   anymore and it can be recycled */
+		buf_pos = 0;
+		while (1) {
+			buf_pos += vtparse_parse(parser, buf.data + buf_pos, buf.len - buf_pos);
+			if (vtparse_has_event(parser)) {
+				if ((res = callback(user_data, parser)) != 0) {
+					vtparse_ingest_release(ingest, &buf);
+					return res;
+				}
+				continue;
+			}
+			if (buf_pos == buf.len || !vtparse_budget_exhausted(parser)) {
+				break;
+			}
+
+			/* There is no other session to switch to; renew the budget and
+			   continue with the unconsumed part of the buffer */
+			vtparse_renew_budget(parser);
+		}
+		vtparse_ingest_release(ingest, &buf);
+	}
+	return res;
+}
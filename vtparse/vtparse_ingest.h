@@ -0,0 +1,168 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_ingest.h
+ *
+ * Optional ingestion module for bulk input from files and pipes. Reads the
+ * input into a fixed pool of buffers. On Linux, the module uses io_uring with
+ * registered buffers and keeps several reads in flight; elsewhere, or if
+ * io_uring is not available, it falls back to plain read() calls. In contrast
+ * to the parser itself, this module depends on the C library and the
+ * operating system.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_INGEST_H
+#define VTPARSE_VTPARSE_INGEST_H
+
+#include <vtparse/vtparse.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Flag for vtparse_ingest_config_t; forces the read() fallback even if
+ * io_uring is available.
+ */
+#define VTPARSE_INGEST_NO_URING 0x01U
+
+/**
+ * Configuration passed to vtparse_ingest_open(). A zero-initialized instance
+ * selects the defaults.
+ */
+typedef struct vtparse_ingest_config {
+	/**
+	 * Size of each input buffer in bytes. Defaults to 64 KiB.
+	 */
+	unsigned int buf_size;
+
+	/**
+	 * Number of input buffers. Defaults to 8.
+	 */
+	unsigned int n_bufs;
+
+	/**
+	 * Maximum number of reads in flight. Defaults to n_bufs. Only regular
+	 * files are read with more than one read in flight; pipes, sockets and
+	 * terminals are read sequentially.
+	 */
+	unsigned int queue_depth;
+
+	/**
+	 * Combination of VTPARSE_INGEST_* flags.
+	 */
+	unsigned int flags;
+} vtparse_ingest_config_t;
+
+/**
+ * A completed input buffer returned by vtparse_ingest_next(). The data remains
+ * valid until the buffer is passed to vtparse_ingest_release().
+ */
+typedef struct vtparse_ingest_buf {
+	/**
+	 * Pointer at the first byte that was read.
+	 */
+	unsigned char const *data;
+
+	/**
+	 * Number of bytes that were read.
+	 */
+	unsigned int len;
+
+	/**
+	 * Index of the buffer in the pool, for internal use.
+	 */
+	unsigned int idx;
+} vtparse_ingest_buf_t;
+
+/**
+ * Opaque ingestion state.
+ */
+typedef struct vtparse_ingest vtparse_ingest_t;
+
+/**
+ * Callback used by vtparse_ingest_run(). Called once for each event reported
+ * by the parser. Returning a non-zero value aborts vtparse_ingest_run().
+ */
+typedef int (*vtparse_ingest_callback_t)(void *user_data, vtparse_t *parser);
+
+/**
+ * Creates a new ingestion state reading from the given file descriptor. The
+ * file descriptor is not closed by vtparse_ingest_close().
+ *
+ * @param fd is the file descriptor to read from.
+ * @param config is the configuration; may be NULL to select the defaults.
+ * @return a new ingestion state or NULL if memory could not be allocated.
+ */
+vtparse_ingest_t *vtparse_ingest_open(int fd,
+                                      const vtparse_ingest_config_t *config);
+
+/**
+ * Waits for all outstanding reads and frees the ingestion state.
+ */
+void vtparse_ingest_close(vtparse_ingest_t *ingest);
+
+/**
+ * Returns a non-zero value if the ingestion state is backed by io_uring, zero
+ * if the read() fallback is used.
+ */
+int vtparse_ingest_uses_uring(const vtparse_ingest_t *ingest);
+
+/**
+ * Returns the next input buffer in file order. The buffer must be passed to
+ * vtparse_ingest_release() once it is no longer needed, i.e. once all data
+ * spans referencing the buffer have been consumed. Callers may hold on to
+ * several buffers at once; if all buffers are held, vtparse_ingest_next()
+ * fails with errno set to ENOBUFS.
+ *
+ * @return 1 if a buffer was returned, 0 at the end of the input, -1 on error
+ * (errno is set accordingly).
+ */
+int vtparse_ingest_next(vtparse_ingest_t *ingest, vtparse_ingest_buf_t *buf);
+
+/**
+ * Hands a buffer returned by vtparse_ingest_next() back to the ingestion
+ * state, which reuses it for one of the next reads.
+ */
+void vtparse_ingest_release(vtparse_ingest_t *ingest,
+                            const vtparse_ingest_buf_t *buf);
+
+/**
+ * Feeds the entire input through the given parser. Calls the callback for
+ * each event and recycles each buffer once all events referencing it have
+ * been processed. A budget set with vtparse_set_budget() is renewed with the
+ * same limits whenever it is exhausted, such that the entire input is still
+ * consumed; use vtparse_ingest_next() and vtparse_parse() directly to
+ * interleave the input with other work.
+ *
+ * @return 0 at the end of the input, -1 on error, or the non-zero value
+ * returned by the callback.
+ */
+int vtparse_ingest_run(vtparse_ingest_t *ingest, vtparse_t *parser,
+                       vtparse_ingest_callback_t callback, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_INGEST_H */
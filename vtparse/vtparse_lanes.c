@@ -0,0 +1,516 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_lanes.c
+ *
+ * Implementation of the lockstep multi-stream engine. The streams are
+ * processed in blocks of LANES_BLOCK bytes per lane. For each block, the input
+ * bytes of all lanes are first copied into a transposed staging area. A
+ * kernel then runs the pure state machine (which only depends on the current
+ * state and the input byte) for all lanes at once and records the state
+ * change for each byte. Since the lanes are independent, the table lookups do
+ * not form a single dependency chain and can be performed with vector
+ * gathers. Finally, the recorded state changes of each lane are decoded into
+ * events, mirroring the semantics of vtparse_parse().
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <vtparse/vtparse_dispatch.h>
+#include <vtparse/vtparse_lanes.h>
+#include <vtparse/vtparse_table.h>
+
+#ifdef VTPARSE_DISPATCH_X86
+#include <immintrin.h>
+#endif
+
+/* Number of bytes per lane processed in one block */
+#define LANES_BLOCK 64U
+
+/* Maximum number of lanes */
+#define LANES_MAX 16U
+
+/* Number of lanes used by the scalar kernel */
+#define LANES_SCALAR 8U
+
+#define ACTION(state_change) ((state_change)&0x0FU)
+#define STATE(state_change) (((state_change)&0xF0U) >> 4)
+
+#define IS_DATA_ACTION(state_change)                                   \
+	(((state_change) == VTPARSE_ACTION_PRINT) ||                       \
+	 ((state_change) == VTPARSE_ACTION_PUT) ||                         \
+	 ((state_change) == VTPARSE_ACTION_OSC_PUT))
+
+/**
+ * Signature of a kernel computing the state changes for all lanes. "input" and
+ * "changes" are transposed, i.e. element t * width + i belongs to the t-th
+ * byte of lane i. "states" holds the current state of each lane and is
+ * updated.
+ */
+typedef void (*vtparse_lanes_kernel_t)(const unsigned char *input, int *states,
+                                       int *changes, unsigned int n_steps);
+
+/**
+ * Per-lane bookkeeping.
+ */
+typedef struct {
+	vtparse_stream_t *stream;
+
+	/* Number of bytes staged for the current block */
+	unsigned int n;
+
+	/* Pending data span (offsets into stream->buf); action is zero if there
+	   is no pending data */
+	unsigned int span_begin, span_end;
+	unsigned char span_action;
+} vtparse_lane_t;
+
+/******************************************************************************
+ * Kernels                                                                    *
+ ******************************************************************************/
+
+static void vtparse_lanes_kernel_scalar(const unsigned char *input, int *states,
+                                        int *changes, unsigned int n_steps) {
+	unsigned int t, i;
+	int s[LANES_SCALAR], change;
+
+	for (i = 0; i < LANES_SCALAR; i++) {
+		s[i] = states[i];
+	}
+	for (t = 0; t < n_steps; t++) {
+		/* The lookups of the individual lanes are independent */
+		for (i = 0; i < LANES_SCALAR; i++) {
+			change = STATE_TABLE[s[i] - 1][input[t * LANES_SCALAR + i]];
+			changes[t * LANES_SCALAR + i] = change;
+			if (STATE(change)) {
+				s[i] = STATE(change);
+			}
+		}
+	}
+	for (i = 0; i < LANES_SCALAR; i++) {
+		states[i] = s[i];
+	}
+}
+
+#ifdef VTPARSE_DISPATCH_X86
+
+/* The vector kernels gather aligned 32-bit words from STATE_TABLE and extract
+   the requested byte. This never reads outside of the table as long as the
+   table is four-byte aligned, which VTPARSE_TABLE_ALIGN guarantees for
+   compilers supporting it (checked in vtparse_lanes_set_isa() nevertheless). */
+
+__attribute__((target("avx2"))) static void vtparse_lanes_kernel_avx2(
+    const unsigned char *input, int *states, int *changes,
+    unsigned int n_steps) {
+	const int *table = (const int *)(const void *)STATE_TABLE;
+	const __m256i one = _mm256_set1_epi32(1), three = _mm256_set1_epi32(3);
+	const __m256i mask = _mm256_set1_epi32(0xFF), zero = _mm256_setzero_si256();
+	__m256i row, ch, idx, word, change, state, next_row;
+	unsigned int t;
+
+	/* Keep the offset of the current table row in each lane */
+	row = _mm256_loadu_si256((const __m256i *)states);
+	row = _mm256_slli_epi32(_mm256_sub_epi32(row, one), 8);
+	for (t = 0; t < n_steps; t++) {
+		ch = _mm256_cvtepu8_epi32(
+		    _mm_loadl_epi64((const __m128i *)(input + t * 8U)));
+		idx = _mm256_add_epi32(row, ch);
+		word = _mm256_i32gather_epi32(table, _mm256_srli_epi32(idx, 2), 4);
+		change = _mm256_and_si256(
+		    _mm256_srlv_epi32(
+		        word, _mm256_slli_epi32(_mm256_and_si256(idx, three), 3)),
+		    mask);
+		_mm256_storeu_si256((__m256i *)(changes + t * 8U), change);
+
+		/* Switch to the new row if there is a state transition */
+		state = _mm256_srli_epi32(change, 4);
+		next_row = _mm256_slli_epi32(_mm256_sub_epi32(state, one), 8);
+		row = _mm256_blendv_epi8(row, next_row,
+		                         _mm256_cmpgt_epi32(state, zero));
+	}
+	row = _mm256_add_epi32(_mm256_srli_epi32(row, 8), one);
+	_mm256_storeu_si256((__m256i *)states, row);
+}
+
+__attribute__((target("avx512f"))) static void vtparse_lanes_kernel_avx512(
+    const unsigned char *input, int *states, int *changes,
+    unsigned int n_steps) {
+	const int *table = (const int *)(const void *)STATE_TABLE;
+	const __m512i one = _mm512_set1_epi32(1), three = _mm512_set1_epi32(3);
+	const __m512i mask = _mm512_set1_epi32(0xFF), zero = _mm512_setzero_si512();
+	__m512i row, ch, idx, word, change, state, next_row;
+	unsigned int t;
+
+	row = _mm512_loadu_si512((const void *)states);
+	row = _mm512_slli_epi32(_mm512_sub_epi32(row, one), 8);
+	for (t = 0; t < n_steps; t++) {
+		ch = _mm512_cvtepu8_epi32(
+		    _mm_loadu_si128((const __m128i *)(input + t * 16U)));
+		idx = _mm512_add_epi32(row, ch);
+		word = _mm512_i32gather_epi32(_mm512_srli_epi32(idx, 2), table, 4);
+		change = _mm512_and_si512(
+		    _mm512_srlv_epi32(
+		        word, _mm512_slli_epi32(_mm512_and_si512(idx, three), 3)),
+		    mask);
+		_mm512_storeu_si512((void *)(changes + t * 16U), change);
+
+		state = _mm512_srli_epi32(change, 4);
+		next_row = _mm512_slli_epi32(_mm512_sub_epi32(state, one), 8);
+		row = _mm512_mask_mov_epi32(row, _mm512_cmpgt_epi32_mask(state, zero),
+		                            next_row);
+	}
+	row = _mm512_add_epi32(_mm512_srli_epi32(row, 8), one);
+	_mm512_storeu_si512((void *)states, row);
+}
+
+#endif /* VTPARSE_DISPATCH_X86 */
+
+/**
+ * Kernel and number of lanes for one of the VTPARSE_LANES_ISA_* constants.
+ */
+typedef struct {
+	int isa;
+	vtparse_lanes_kernel_t kernel;
+	unsigned int width;
+} vtparse_lanes_impl_t;
+
+static const vtparse_lanes_impl_t VTPARSE_LANES_SCALAR = {
+    VTPARSE_LANES_ISA_SCALAR, vtparse_lanes_kernel_scalar, LANES_SCALAR};
+
+#ifdef VTPARSE_DISPATCH_X86
+static const vtparse_lanes_impl_t VTPARSE_LANES_AVX2 = {
+    VTPARSE_LANES_ISA_AVX2, vtparse_lanes_kernel_avx2, 8U};
+
+static const vtparse_lanes_impl_t VTPARSE_LANES_AVX512 = {
+    VTPARSE_LANES_ISA_AVX512, vtparse_lanes_kernel_avx512, 16U};
+#endif
+
+/* Implementation selected by vtparse_lanes_set_isa() or lazily by
+   vtparse_parse_streams(); only accessed through the VTPARSE_ATOMIC_* macros */
+static const vtparse_lanes_impl_t *vtparse_lanes_impl = 0;
+
+/******************************************************************************
+ * Event decoding                                                             *
+ ******************************************************************************/
+
+static void vtparse_lanes_emit(vtparse_stream_t *stream, unsigned int action,
+                               unsigned char ch) {
+	vtparse_stream_private_t *priv = &stream->priv_;
+	vtparse_event_t *event = &stream->events[stream->num_events++];
+	unsigned int i;
+	int param;
+
+	event->data = 0;
+	event->data_len = 0U;
+	event->action = (unsigned char)action;
+	event->ch = ch;
+	event->error = (unsigned char)priv->error;
+	event->flags_ = 0U;
+	event->num_params = (unsigned char)priv->num_params;
+	for (i = 0; i < (unsigned int)priv->num_params; i++) {
+		param = priv->params[i];
+		event->params[i] =
+		    (unsigned short)(param < 0 ? 0 : (param > 65535 ? 65535 : param));
+	}
+	event->num_intermediate_chars = (unsigned char)priv->num_intermediate_chars;
+	for (i = 0; i < (unsigned int)priv->num_intermediate_chars; i++) {
+		event->intermediate_chars[i] = priv->intermediate_chars[i];
+	}
+}
+
+static void vtparse_lanes_flush(vtparse_lane_t *lane) {
+	vtparse_stream_t *stream = lane->stream;
+	vtparse_event_t *event;
+
+	if (!lane->span_action) {
+		return;
+	}
+	event = &stream->events[stream->num_events++];
+	event->data = stream->buf + lane->span_begin;
+	event->data_len = lane->span_end - lane->span_begin;
+	event->action = lane->span_action;
+	event->ch = stream->buf[lane->span_end - 1U];
+	event->error = 0U;
+	event->flags_ = 0U;
+	event->num_params = 0U;
+	event->num_intermediate_chars = 0U;
+	lane->span_action = 0U;
+}
+
+/**
+ * Executes a single action, see vtparse_execute_action() in vtparse.c.
+ */
+static void vtparse_lanes_action(vtparse_stream_t *stream, unsigned int action,
+                                 unsigned char ch) {
+	vtparse_stream_private_t *priv = &stream->priv_;
+	int *param;
+
+	switch (action) {
+		case VTPARSE_ACTION_EXECUTE:
+		case VTPARSE_ACTION_HOOK:
+		case VTPARSE_ACTION_OSC_START:
+		case VTPARSE_ACTION_OSC_END:
+		case VTPARSE_ACTION_UNHOOK:
+		case VTPARSE_ACTION_CSI_DISPATCH:
+		case VTPARSE_ACTION_ESC_DISPATCH:
+			if (priv->error) {
+				priv->error = 0;
+			} else {
+				vtparse_lanes_emit(stream, action, ch);
+			}
+			break;
+
+		case VTPARSE_ACTION_COLLECT:
+			if (priv->num_intermediate_chars <
+			    (int)VTPARSE_MAX_INTERMEDIATE_CHARS) {
+				priv->intermediate_chars[priv->num_intermediate_chars++] = ch;
+			} else {
+				priv->error = 1;
+			}
+			break;
+
+		case VTPARSE_ACTION_PARAM:
+			if (ch == ';') {
+				if (priv->num_params < (int)VTPARSE_MAX_PARAMS) {
+					priv->params[priv->num_params++] = 0;
+				} else {
+					priv->error = 1;
+				}
+			} else if (!priv->error) {
+				if (priv->num_params == 0) {
+					priv->num_params = 1;
+					priv->params[0] = 0;
+				}
+				param = &priv->params[priv->num_params - 1];
+				*param = *param * 10 + (ch - '0');
+			}
+			break;
+
+		case VTPARSE_ACTION_CLEAR:
+			priv->num_intermediate_chars = 0;
+			priv->num_params = 0;
+			priv->error = 0;
+			break;
+
+		default:
+			/* No action, VTPARSE_ACTION_IGNORE, or a data action (which never
+			   accompanies a state transition) */
+			break;
+	}
+}
+
+/**
+ * Decodes the state changes of a single lane into events. Returns zero if the
+ * lane should be released, i.e. the stream is out of input or queue space.
+ */
+static int vtparse_lanes_decode(vtparse_lane_t *lane,
+                                const unsigned char *input, const int *changes,
+                                unsigned int width, unsigned int i) {
+	vtparse_stream_t *stream = lane->stream;
+	vtparse_stream_private_t *priv = &stream->priv_;
+	unsigned int t, change;
+	unsigned char ch;
+
+	for (t = 0; t < lane->n; t++) {
+		change = (unsigned int)changes[t * width + i];
+
+		/* Extend the pending data span if possible */
+		if (IS_DATA_ACTION(change) && lane->span_action &&
+		    lane->span_end == stream->buf_pos) {
+			lane->span_end++;
+			lane->span_action = (unsigned char)change;
+			stream->buf_pos++;
+			continue;
+		}
+
+		/* Everything else may produce events */
+		if (stream->max_events - stream->num_events <
+		    VTPARSE_LANES_MIN_EVENTS) {
+			break;
+		}
+		vtparse_lanes_flush(lane);
+		ch = input[t * width + i];
+		if (IS_DATA_ACTION(change)) {
+			lane->span_begin = stream->buf_pos;
+			lane->span_end = stream->buf_pos + 1U;
+			lane->span_action = (unsigned char)change;
+		} else if (STATE(change)) {
+			vtparse_lanes_action(stream, EXIT_ACTIONS[priv->state - 1], ch);
+			vtparse_lanes_action(stream, ACTION(change), ch);
+			vtparse_lanes_action(stream, ENTRY_ACTIONS[STATE(change) - 1], ch);
+			priv->state = (int)STATE(change);
+		} else {
+			vtparse_lanes_action(stream, ACTION(change), ch);
+		}
+		stream->buf_pos++;
+	}
+
+	if (stream->buf_pos == stream->buf_len ||
+	    stream->max_events - stream->num_events < VTPARSE_LANES_MIN_EVENTS) {
+		vtparse_lanes_flush(lane);
+		return 0;
+	}
+	return 1;
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API void vtparse_stream_init(vtparse_stream_t *stream,
+                                     vtparse_event_t *events,
+                                     unsigned int max_events) {
+	unsigned int i;
+
+	stream->buf = 0;
+	stream->buf_len = 0U;
+	stream->buf_pos = 0U;
+	stream->events = events;
+	stream->max_events = max_events;
+	stream->num_events = 0U;
+
+	stream->priv_.state = VTPARSE_STATE_GROUND;
+	stream->priv_.error = 0;
+	stream->priv_.num_params = 0;
+	stream->priv_.num_intermediate_chars = 0;
+	for (i = 0; i < VTPARSE_MAX_PARAMS; i++) {
+		stream->priv_.params[i] = 0;
+	}
+	for (i = 0; i < VTPARSE_MAX_INTERMEDIATE_CHARS; i++) {
+		stream->priv_.intermediate_chars[i] = 0;
+	}
+}
+
+/**
+ * Returns the implementation for the given VTPARSE_LANES_ISA_* constant.
+ */
+static const vtparse_lanes_impl_t *vtparse_lanes_select(int isa) {
+#ifdef VTPARSE_DISPATCH_X86
+	const int supported = vtparse_cpu_isa();
+
+	if (((unsigned long)(const void *)STATE_TABLE & 3U) != 0U) {
+		return &VTPARSE_LANES_SCALAR;
+	}
+	if (isa == VTPARSE_LANES_ISA_AUTO) {
+		isa = vtparse_get_isa();
+	}
+	if (isa > supported) {
+		isa = supported;
+	}
+	if (isa == VTPARSE_LANES_ISA_AVX512) {
+		return &VTPARSE_LANES_AVX512;
+	} else if (isa == VTPARSE_LANES_ISA_AVX2) {
+		return &VTPARSE_LANES_AVX2;
+	}
+#else
+	(void)isa;
+#endif
+	return &VTPARSE_LANES_SCALAR;
+}
+
+VTPARSE_API int vtparse_lanes_set_isa(int isa) {
+	const vtparse_lanes_impl_t *impl = vtparse_lanes_select(isa);
+	VTPARSE_ATOMIC_STORE(&vtparse_lanes_impl, impl);
+	return impl->isa;
+}
+
+VTPARSE_API void vtparse_parse_streams(vtparse_stream_t *const *streams,
+                                       unsigned int n_streams) {
+	vtparse_lane_t lanes[LANES_MAX];
+	unsigned char input[LANES_BLOCK * LANES_MAX];
+	int changes[LANES_BLOCK * LANES_MAX];
+	int states[LANES_MAX];
+	unsigned int width, next = 0, n_active = 0, n_steps, i, t;
+	const vtparse_lanes_impl_t *impl, *expected = 0;
+	vtparse_stream_t *stream;
+
+	impl = VTPARSE_ATOMIC_LOAD(&vtparse_lanes_impl);
+	if (!impl) {
+		/* A concurrent vtparse_lanes_set_isa() takes precedence */
+		impl = vtparse_lanes_select(VTPARSE_LANES_ISA_AUTO);
+		if (!VTPARSE_ATOMIC_INIT(&vtparse_lanes_impl, &expected, impl)) {
+			impl = expected;
+		}
+	}
+	width = impl->width;
+
+	for (i = 0; i < width; i++) {
+		lanes[i].stream = 0;
+	}
+	while (1) {
+		/* Assign streams with pending input to idle lanes */
+		for (i = 0; i < width; i++) {
+			while (!lanes[i].stream && next < n_streams) {
+				stream = streams[next++];
+				if (stream->buf_pos < stream->buf_len &&
+				    stream->max_events - stream->num_events >=
+				        VTPARSE_LANES_MIN_EVENTS) {
+					lanes[i].stream = stream;
+					lanes[i].span_action = 0U;
+					n_active++;
+				}
+			}
+		}
+		if (n_active == 0U) {
+			break;
+		}
+
+		/* Stage the next block of input bytes of each lane */
+		n_steps = 0;
+		for (i = 0; i < width; i++) {
+			stream = lanes[i].stream;
+			if (!stream) {
+				lanes[i].n = 0;
+				states[i] = VTPARSE_STATE_GROUND;
+				for (t = 0; t < LANES_BLOCK; t++) {
+					input[t * width + i] = 0;
+				}
+				continue;
+			}
+			lanes[i].n = stream->buf_len - stream->buf_pos;
+			if (lanes[i].n > LANES_BLOCK) {
+				lanes[i].n = LANES_BLOCK;
+			}
+			if (lanes[i].n > n_steps) {
+				n_steps = lanes[i].n;
+			}
+			states[i] = stream->priv_.state;
+			for (t = 0; t < lanes[i].n; t++) {
+				input[t * width + i] = stream->buf[stream->buf_pos + t];
+			}
+			for (; t < LANES_BLOCK; t++) {
+				input[t * width + i] = 0;
+			}
+		}
+
+		/* Compute the state changes of all lanes */
+		impl->kernel(input, states, changes, n_steps);
+
+		/* Decode the events and release lanes that are done */
+		for (i = 0; i < width; i++) {
+			if (lanes[i].stream &&
+			    !vtparse_lanes_decode(&lanes[i], input, changes, width, i)) {
+				lanes[i].stream = 0;
+				n_active--;
+			}
+		}
+	}
+}
@@ -0,0 +1,142 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_lanes.h
+ *
+ * Engine parsing many independent streams at once. Up to 16 streams are
+ * assigned to "lanes" and advanced in lockstep: the state transitions of all
+ * lanes are computed together (using AVX2 or AVX-512 gathers into the state
+ * transition table if available), then the events of each lane are decoded
+ * and appended to the output queue of the corresponding stream. Whenever a
+ * stream runs out of input, the next stream takes over its lane.
+ *
+ * This is useful when parsing a large number of short streams, where the
+ * overhead of calling vtparse_parse() for each stream and each event
+ * dominates. The events are identical to those produced by vtparse_parse()
+ * with the default event mask and options.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_LANES_H
+#define VTPARSE_VTPARSE_LANES_H
+
+#include <vtparse/vtparse.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Minimum number of free event slots a stream requires to make progress; a
+ * single input byte may produce up to four events, plus one slot is reserved
+ * for flushing a pending data span.
+ */
+#define VTPARSE_LANES_MIN_EVENTS 5U
+
+/**
+ * Values for vtparse_lanes_set_isa(); aliases of the VTPARSE_ISA_* constants.
+ */
+#define VTPARSE_LANES_ISA_AUTO VTPARSE_ISA_AUTO
+#define VTPARSE_LANES_ISA_SCALAR VTPARSE_ISA_SCALAR
+#define VTPARSE_LANES_ISA_AVX2 VTPARSE_ISA_AVX2
+#define VTPARSE_LANES_ISA_AVX512 VTPARSE_ISA_AVX512
+
+/**
+ * Parser state of a stream. The fields in this structure are private.
+ */
+typedef struct vtparse_stream_private {
+	int state;
+	int error;
+	int num_params;
+	int params[VTPARSE_MAX_PARAMS];
+	int num_intermediate_chars;
+	unsigned char intermediate_chars[VTPARSE_MAX_INTERMEDIATE_CHARS];
+} vtparse_stream_private_t;
+
+/**
+ * A single stream handled by vtparse_parse_streams().
+ */
+typedef struct vtparse_stream {
+	/**
+	 * Input buffer; bytes buf[buf_pos] to buf[buf_len - 1] are parsed.
+	 * vtparse_parse_streams() advances buf_pos.
+	 */
+	unsigned char const *buf;
+	unsigned int buf_len;
+	unsigned int buf_pos;
+
+	/**
+	 * Output queue; vtparse_parse_streams() appends events starting at
+	 * events[num_events]. Reset num_events to zero after consuming the
+	 * events. Data spans in the events point into buf.
+	 */
+	vtparse_event_t *events;
+	unsigned int max_events;
+	unsigned int num_events;
+
+	/**
+	 * Private parser state, carried over between calls.
+	 */
+	vtparse_stream_private_t priv_;
+} vtparse_stream_t;
+
+/**
+ * Initializes a stream. The input buffer is empty.
+ *
+ * @param stream is the stream that should be initialized.
+ * @param events is the memory used for the output queue.
+ * @param max_events is the number of elements in "events"; must be at least
+ * VTPARSE_LANES_MIN_EVENTS.
+ */
+VTPARSE_API void vtparse_stream_init(vtparse_stream_t *stream,
+                                     vtparse_event_t *events,
+                                     unsigned int max_events);
+
+/**
+ * Parses the given streams. Returns once each stream has either consumed its
+ * entire input or has fewer than VTPARSE_LANES_MIN_EVENTS free slots in its
+ * output queue. Pending data spans are flushed into the queue before
+ * returning, i.e. data spans never refer to more than one input buffer.
+ *
+ * @param streams is an array of pointers at the streams.
+ * @param n_streams is the number of streams.
+ */
+VTPARSE_API void vtparse_parse_streams(vtparse_stream_t *const *streams,
+                                       unsigned int n_streams);
+
+/**
+ * Selects the instruction set used to compute the state transitions. By
+ * default the instruction set selected by vtparse_set_isa() (and thus the
+ * VTPARSE_FORCE_ISA environment variable) is used. Streams that are being
+ * parsed concurrently with this call may still use the previous selection.
+ *
+ * @param isa is one of the VTPARSE_LANES_ISA_* constants.
+ * @return the instruction set that is actually used; falls back to a
+ * narrower implementation if the requested instruction set is not available.
+ */
+VTPARSE_API int vtparse_lanes_set_isa(int isa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_LANES_H */
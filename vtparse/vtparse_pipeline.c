@@ -0,0 +1,327 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_pipeline.c
+ *
+ * Implementation of the pipeline module. The rings use the GCC __atomic
+ * builtins for the acquire/release ordering between producer and consumer.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _GNU_SOURCE
+
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vtparse/vtparse_pipeline.h>
+
+#define CACHE_LINE 64U
+
+#define DEFAULT_MAX_BUFS 64U
+#define DEFAULT_EVENT_CAPACITY 4096U
+
+/* Number of busy-wait iterations before a waiting thread starts yielding */
+#define SPIN_COUNT 128U
+
+/* Values of vtparse_event_t.flags_ for records with action zero */
+#define FLAG_RELEASE 1U
+#define FLAG_EOF 2U
+
+/**
+ * Single-producer/single-consumer ring. The indices written by the producer
+ * and the consumer live on separate cache lines. Each side additionally
+ * caches the last index it has seen from the other side, such that the shared
+ * cache line is only touched when the ring appears to be full or empty.
+ */
+typedef struct {
+	/* Written by the producer */
+	unsigned int tail;
+	unsigned int head_cache;
+	unsigned char pad0_[CACHE_LINE - 2U * sizeof(unsigned int)];
+
+	/* Written by the consumer */
+	unsigned int head;
+	unsigned int tail_cache;
+	unsigned char pad1_[CACHE_LINE - 2U * sizeof(unsigned int)];
+
+	/* Constant after initialization */
+	unsigned char *elems;
+	unsigned int elem_size, mask;
+	unsigned char pad2_[CACHE_LINE - sizeof(unsigned char *) -
+	                    2U * sizeof(unsigned int)];
+} vtparse_spsc_t;
+
+typedef struct {
+	unsigned char const *data;
+	unsigned int len;
+	void *cookie;
+} vtparse_pipeline_input_t;
+
+struct vtparse_pipeline {
+	vtparse_spsc_t input_ring;
+	vtparse_spsc_t event_ring;
+	vtparse_spsc_t release_ring;
+
+	/* Only accessed by the consumer */
+	int consumer_eof;
+};
+
+/******************************************************************************
+ * Rings                                                                      *
+ ******************************************************************************/
+
+static unsigned int vtparse_spsc_round_capacity(unsigned int n) {
+	unsigned int capacity = 1U;
+	while (capacity < n) {
+		capacity <<= 1U;
+	}
+	return capacity;
+}
+
+static int vtparse_spsc_init(vtparse_spsc_t *ring, unsigned int elem_size,
+                             unsigned int capacity) {
+	void *elems;
+	capacity = vtparse_spsc_round_capacity(capacity);
+	memset(ring, 0, sizeof(*ring));
+	if (posix_memalign(&elems, CACHE_LINE, (size_t)capacity * elem_size)) {
+		return -1;
+	}
+	ring->elems = elems;
+	ring->elem_size = elem_size;
+	ring->mask = capacity - 1U;
+	return 0;
+}
+
+static int vtparse_spsc_try_push(vtparse_spsc_t *ring, const void *elem) {
+	unsigned int tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+	if (tail - ring->head_cache > ring->mask) {
+		ring->head_cache = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+		if (tail - ring->head_cache > ring->mask) {
+			return 0; /* Full */
+		}
+	}
+	memcpy(ring->elems + (tail & ring->mask) * ring->elem_size, elem,
+	       ring->elem_size);
+	__atomic_store_n(&ring->tail, tail + 1U, __ATOMIC_RELEASE);
+	return 1;
+}
+
+static int vtparse_spsc_try_pop(vtparse_spsc_t *ring, void *elem) {
+	unsigned int head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+	if (head == ring->tail_cache) {
+		ring->tail_cache = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+		if (head == ring->tail_cache) {
+			return 0; /* Empty */
+		}
+	}
+	memcpy(elem, ring->elems + (head & ring->mask) * ring->elem_size,
+	       ring->elem_size);
+	__atomic_store_n(&ring->head, head + 1U, __ATOMIC_RELEASE);
+	return 1;
+}
+
+static void vtparse_spsc_backoff(unsigned int *n_spins) {
+	if (*n_spins < SPIN_COUNT) {
+		(*n_spins)++;
+#if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#endif
+	} else {
+		sched_yield();
+	}
+}
+
+static void vtparse_spsc_push(vtparse_spsc_t *ring, const void *elem) {
+	unsigned int n_spins = 0;
+	while (!vtparse_spsc_try_push(ring, elem)) {
+		vtparse_spsc_backoff(&n_spins);
+	}
+}
+
+static void vtparse_spsc_pop(vtparse_spsc_t *ring, void *elem) {
+	unsigned int n_spins = 0;
+	while (!vtparse_spsc_try_pop(ring, elem)) {
+		vtparse_spsc_backoff(&n_spins);
+	}
+}
+
+/******************************************************************************
+ * Public API                                                                 *
+ ******************************************************************************/
+
+vtparse_pipeline_t *vtparse_pipeline_create(
+    const vtparse_pipeline_config_t *config) {
+	unsigned int max_bufs = DEFAULT_MAX_BUFS;
+	unsigned int event_capacity = DEFAULT_EVENT_CAPACITY;
+	vtparse_pipeline_t *pipeline;
+	void *mem;
+
+	if (config && config->max_bufs) {
+		max_bufs = config->max_bufs;
+	}
+	if (config && config->event_capacity) {
+		event_capacity = config->event_capacity;
+	}
+
+	if (posix_memalign(&mem, CACHE_LINE, sizeof(vtparse_pipeline_t))) {
+		return NULL;
+	}
+	pipeline = mem;
+	memset(pipeline, 0, sizeof(*pipeline));
+
+	/* The input ring must hold all buffers plus the end-of-input marker. The
+	   release ring is never full, since at most max_bufs buffers circulate;
+	   hence the consumer never blocks while returning a buffer. */
+	if (vtparse_spsc_init(&pipeline->input_ring,
+	                      sizeof(vtparse_pipeline_input_t), max_bufs + 1U) ||
+	    vtparse_spsc_init(&pipeline->event_ring, sizeof(vtparse_event_t),
+	                      event_capacity) ||
+	    vtparse_spsc_init(&pipeline->release_ring, sizeof(void *), max_bufs)) {
+		vtparse_pipeline_destroy(pipeline);
+		return NULL;
+	}
+	return pipeline;
+}
+
+void vtparse_pipeline_destroy(vtparse_pipeline_t *pipeline) {
+	if (!pipeline) {
+		return;
+	}
+	free(pipeline->input_ring.elems);
+	free(pipeline->event_ring.elems);
+	free(pipeline->release_ring.elems);
+	free(pipeline);
+}
+
+void vtparse_pipeline_push(vtparse_pipeline_t *pipeline,
+                           unsigned char const *data, unsigned int len,
+                           void *cookie) {
+	vtparse_pipeline_input_t input;
+	input.data = data;
+	input.len = len;
+	input.cookie = cookie;
+	vtparse_spsc_push(&pipeline->input_ring, &input);
+}
+
+void vtparse_pipeline_close(vtparse_pipeline_t *pipeline) {
+	vtparse_pipeline_push(pipeline, NULL, 0U, NULL);
+}
+
+int vtparse_pipeline_reclaim(vtparse_pipeline_t *pipeline, void **cookie) {
+	return vtparse_spsc_try_pop(&pipeline->release_ring, cookie);
+}
+
+static void vtparse_pipeline_record(vtparse_event_t *event,
+                                    vtparse_t *parser) {
+	unsigned int i, n;
+	int param;
+
+	event->action = (unsigned char)parser->action;
+	event->ch = (unsigned char)parser->ch;
+	event->error = (unsigned char)parser->error;
+	event->flags_ = 0U;
+
+	n = (unsigned int)parser->num_intermediate_chars;
+	if (n > VTPARSE_MAX_INTERMEDIATE_CHARS) {
+		n = VTPARSE_MAX_INTERMEDIATE_CHARS;
+	}
+	event->num_intermediate_chars = (unsigned char)n;
+	for (i = 0; i < n; i++) {
+		event->intermediate_chars[i] = parser->intermediate_chars[i];
+	}
+
+	if (parser->data_begin != parser->data_end) {
+		event->data = parser->data_begin;
+		event->data_len = (unsigned int)(parser->data_end - parser->data_begin);
+		event->num_params = 0U;
+		return;
+	}
+
+	event->data = NULL;
+	event->data_len = 0U;
+	vtparse_decode_params(parser);
+	n = (unsigned int)parser->num_params;
+	if (n > VTPARSE_MAX_PARAMS) {
+		n = VTPARSE_MAX_PARAMS;
+	}
+	event->num_params = (unsigned char)n;
+	for (i = 0; i < n; i++) {
+		param = parser->params[i];
+		event->params[i] =
+		    (unsigned short)(param < 0 ? 0 : (param > 65535 ? 65535 : param));
+	}
+}
+
+void vtparse_pipeline_run_parser(vtparse_pipeline_t *pipeline,
+                                 vtparse_t *parser) {
+	vtparse_pipeline_input_t input;
+	vtparse_event_t event;
+	unsigned int buf_pos;
+
+	while (1) {
+		vtparse_spsc_pop(&pipeline->input_ring, &input);
+		if (!input.data) {
+			break;
+		}
+
+		buf_pos = 0;
+		while (1) {
+			buf_pos +=
+			    vtparse_parse(parser, input.data + buf_pos, input.len - buf_pos);
+			if (!vtparse_has_event(parser)) {
+				break;
+			}
+			vtparse_pipeline_record(&event, parser);
+			vtparse_spsc_push(&pipeline->event_ring, &event);
+		}
+
+		/* All events referencing this buffer precede the release record */
+		memset(&event, 0, sizeof(event));
+		event.flags_ = FLAG_RELEASE;
+		event.data = (unsigned char const *)input.cookie;
+		vtparse_spsc_push(&pipeline->event_ring, &event);
+	}
+
+	memset(&event, 0, sizeof(event));
+	event.flags_ = FLAG_EOF;
+	vtparse_spsc_push(&pipeline->event_ring, &event);
+}
+
+int vtparse_pipeline_pop(vtparse_pipeline_t *pipeline, vtparse_event_t *event) {
+	void *cookie;
+
+	while (!pipeline->consumer_eof) {
+		vtparse_spsc_pop(&pipeline->event_ring, event);
+		if (event->action != 0U) {
+			return 1;
+		}
+		if (event->flags_ == FLAG_EOF) {
+			pipeline->consumer_eof = 1;
+		} else {
+			/* The consumer is done with all events referencing the buffer */
+			cookie = (void *)event->data;
+			vtparse_spsc_push(&pipeline->release_ring, &cookie);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_pipeline.h
+ *
+ * Optional module that spreads reading, parsing and consuming a byte stream
+ * across three threads. The threads are connected by lock-free
+ * single-producer/single-consumer rings:
+ *
+ *   reader   --(input buffers)-->   parser   --(event records)-->   consumer
+ *      ^                                                                |
+ *      +--------------------------(released buffers)--------------------+
+ *
+ * Data spans (e.g. PRINT) in the event records point directly into the input
+ * buffers. A buffer is handed back to the reader once the consumer has
+ * processed all events referencing it.
+ *
+ * Each of the pipeline functions must only be called from the thread playing
+ * the corresponding role. Like the ingestion module, this module depends on
+ * the C library.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_PIPELINE_H
+#define VTPARSE_VTPARSE_PIPELINE_H
+
+#include <vtparse/vtparse.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Configuration passed to vtparse_pipeline_create(). A zero-initialized
+ * instance selects the defaults.
+ */
+typedef struct vtparse_pipeline_config {
+	/**
+	 * Maximum number of input buffers the reader has in circulation at any
+	 * time. Defaults to 64.
+	 */
+	unsigned int max_bufs;
+
+	/**
+	 * Capacity of the event ring between parser and consumer. Rounded up to a
+	 * power of two. Defaults to 4096.
+	 */
+	unsigned int event_capacity;
+} vtparse_pipeline_config_t;
+
+/**
+ * Opaque pipeline state.
+ */
+typedef struct vtparse_pipeline vtparse_pipeline_t;
+
+/**
+ * Creates a new pipeline. Returns NULL if memory could not be allocated.
+ */
+vtparse_pipeline_t *vtparse_pipeline_create(
+    const vtparse_pipeline_config_t *config);
+
+/**
+ * Frees the pipeline. All threads must have finished using it.
+ */
+void vtparse_pipeline_destroy(vtparse_pipeline_t *pipeline);
+
+/**
+ * Reader thread: passes a buffer to the parser thread. Blocks while the input
+ * ring is full. The buffer must remain valid until it is returned by
+ * vtparse_pipeline_reclaim(). At most config.max_bufs buffers may be in
+ * circulation.
+ *
+ * @param data points at the bytes that should be parsed.
+ * @param len is the number of bytes; must be larger than zero.
+ * @param cookie is an arbitrary pointer returned by vtparse_pipeline_reclaim()
+ * together with the buffer.
+ */
+void vtparse_pipeline_push(vtparse_pipeline_t *pipeline,
+                           unsigned char const *data, unsigned int len,
+                           void *cookie);
+
+/**
+ * Reader thread: signals the end of the input.
+ */
+void vtparse_pipeline_close(vtparse_pipeline_t *pipeline);
+
+/**
+ * Reader thread: returns a buffer that is no longer referenced by any event.
+ * Does not block.
+ *
+ * @param cookie receives the cookie passed to vtparse_pipeline_push().
+ * @return 1 if a buffer was returned, 0 otherwise.
+ */
+int vtparse_pipeline_reclaim(vtparse_pipeline_t *pipeline, void **cookie);
+
+/**
+ * Parser thread: parses all incoming buffers with the given parser and
+ * forwards the events to the consumer until the reader closes the pipeline.
+ */
+void vtparse_pipeline_run_parser(vtparse_pipeline_t *pipeline,
+                                 vtparse_t *parser);
+
+/**
+ * Consumer thread: waits for the next event. The data span referenced by the
+ * event remains valid until the next call to vtparse_pipeline_pop().
+ *
+ * @return 1 if an event was returned, 0 at the end of the input.
+ */
+int vtparse_pipeline_pop(vtparse_pipeline_t *pipeline, vtparse_event_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_PIPELINE_H */
@@ -0,0 +1,298 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_ring.c
+ *
+ * Implementation of the ring buffer module. The double mapping is backed by a
+ * memfd on Linux and by an unlinked POSIX shared memory object elsewhere.
+ *
+ * Positions in the input stream are stored as unsigned integers that wrap
+ * around; since the ring size is a power of two, the offset of a position
+ * in the ring is obtained by masking.
+ *
+ * @author Andreas Stöckel
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <vtparse/vtparse_ring.h>
+
+#define DEFAULT_SIZE 65536U
+#define MAX_SIZE 0x40000000U
+
+struct vtparse_ring {
+	vtparse_t parser;
+
+	/* Copy of the parser taken before parsing new input while a span is held
+	   back */
+	vtparse_t saved;
+
+	unsigned char *mem;
+	unsigned int size;
+	int mapped;
+
+	/* Position of mem[0] in the compacting fallback */
+	unsigned int origin;
+
+	/* End of the input, end of the input handed to the parser, and start of
+	   the input that may still be referenced by the caller or the held
+	   span */
+	unsigned int head, pos, tail;
+
+	/* Span reaching the end of the input that is held back */
+	int holding;
+	unsigned int held_begin;
+	vtparse_action_t held_action;
+	int held_line_breaks;
+};
+
+/******************************************************************************
+ * Double mapping                                                             *
+ ******************************************************************************/
+
+static int vtparse_ring_shm_fd(void) {
+#ifdef MFD_CLOEXEC
+	return memfd_create("vtparse_ring", MFD_CLOEXEC);
+#else
+	static unsigned int counter = 0;
+	char name[64];
+	int fd;
+
+	sprintf(name, "/vtparse_ring_%ld_%u", (long)getpid(), counter++);
+	fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (fd >= 0) {
+		shm_unlink(name);
+	}
+	return fd;
+#endif
+}
+
+static int vtparse_ring_map(vtparse_ring_t *ring) {
+	unsigned char *mem;
+	void *p;
+	int fd;
+
+	fd = vtparse_ring_shm_fd();
+	if (fd < 0) {
+		return -1;
+	}
+	if (ftruncate(fd, (off_t)ring->size) != 0) {
+		close(fd);
+		return -1;
+	}
+
+	/* Reserve twice the size of the ring, then map the pages of the shared
+	   memory object into both halves */
+	p = mmap(NULL, 2U * (size_t)ring->size, PROT_NONE,
+	         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (p == MAP_FAILED) {
+		close(fd);
+		return -1;
+	}
+	mem = p;
+	if (mmap(mem, ring->size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+	         fd, 0) == MAP_FAILED ||
+	    mmap(mem + ring->size, ring->size, PROT_READ | PROT_WRITE,
+	         MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+		munmap(mem, 2U * (size_t)ring->size);
+		close(fd);
+		return -1;
+	}
+	close(fd);
+	ring->mem = mem;
+	return 0;
+}
+
+static unsigned char *vtparse_ring_ptr(const vtparse_ring_t *ring,
+                                       unsigned int pos) {
+	if (ring->mapped) {
+		return ring->mem + (pos & (ring->size - 1U));
+	}
+	return ring->mem + (pos - ring->origin);
+}
+
+/* Moves the referenced input to the beginning of the linear buffer used by
+   the fallback */
+static void vtparse_ring_compact(vtparse_ring_t *ring) {
+	if (ring->tail != ring->origin) {
+		memmove(ring->mem, vtparse_ring_ptr(ring, ring->tail),
+		        ring->head - ring->tail);
+		ring->origin = ring->tail;
+	}
+}
+
+/* Returns the span held back so far as event */
+static vtparse_t *vtparse_ring_release(vtparse_ring_t *ring) {
+	vtparse_t *parser = &ring->parser;
+	parser->action = ring->held_action;
+	parser->data_begin = vtparse_ring_ptr(ring, ring->held_begin);
+	parser->data_end = parser->data_begin + (ring->pos - ring->held_begin);
+	parser->ch = (char)parser->data_end[-1];
+	parser->num_line_breaks = ring->held_line_breaks;
+	ring->holding = 0;
+	return parser;
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+vtparse_ring_t *vtparse_ring_open(unsigned int size, unsigned int flags) {
+	vtparse_ring_t *ring;
+	unsigned int page_size = (unsigned int)sysconf(_SC_PAGESIZE);
+
+	ring = calloc(1, sizeof(vtparse_ring_t));
+	if (!ring) {
+		return NULL;
+	}
+	vtparse_init(&ring->parser);
+
+	/* Round the size up to a power of two that is a multiple of the page
+	   size */
+	size = size ? size : DEFAULT_SIZE;
+	size = size > MAX_SIZE ? MAX_SIZE : size;
+	ring->size = page_size;
+	while (ring->size < size) {
+		ring->size *= 2U;
+	}
+
+	if (!(flags & VTPARSE_RING_NO_MMAP)) {
+		ring->mapped = vtparse_ring_map(ring) == 0;
+	}
+	if (!ring->mapped) {
+		ring->mem = malloc(ring->size);
+		if (!ring->mem) {
+			free(ring);
+			return NULL;
+		}
+	}
+	return ring;
+}
+
+void vtparse_ring_close(vtparse_ring_t *ring) {
+	if (!ring) {
+		return;
+	}
+	if (ring->mapped) {
+		munmap(ring->mem, 2U * (size_t)ring->size);
+	} else {
+		free(ring->mem);
+	}
+	free(ring);
+}
+
+vtparse_t *vtparse_ring_parser(vtparse_ring_t *ring) {
+	return &ring->parser;
+}
+
+int vtparse_ring_is_mapped(const vtparse_ring_t *ring) {
+	return ring->mapped;
+}
+
+unsigned char *vtparse_ring_write_ptr(vtparse_ring_t *ring,
+                                      unsigned int *avail) {
+	unsigned int n_free = ring->size - (ring->head - ring->tail);
+	if (!ring->mapped && ring->size - (ring->head - ring->origin) < n_free) {
+		vtparse_ring_compact(ring);
+	}
+	*avail = n_free;
+	return vtparse_ring_ptr(ring, ring->head);
+}
+
+void vtparse_ring_commit(vtparse_ring_t *ring, unsigned int n) {
+	ring->head += n;
+}
+
+unsigned int vtparse_feed(vtparse_ring_t *ring, const unsigned char *buf,
+                          unsigned int len) {
+	unsigned int avail;
+	unsigned char *p = vtparse_ring_write_ptr(ring, &avail);
+	len = len > avail ? avail : len;
+	memcpy(p, buf, len);
+	ring->head += len;
+	return len;
+}
+
+vtparse_t *vtparse_next_event(vtparse_ring_t *ring, int flush) {
+	vtparse_t *parser = &ring->parser;
+	const unsigned char *buf;
+	unsigned int avail, n, begin, len;
+	int at_end;
+
+	/* The event returned by the last call has been processed */
+	ring->tail = ring->holding ? ring->held_begin : ring->pos;
+
+	buf = vtparse_ring_ptr(ring, ring->pos);
+	avail = ring->head - ring->pos;
+	if (ring->holding) {
+		if (avail == 0U) {
+			return flush ? vtparse_ring_release(ring) : NULL;
+		}
+		ring->saved = *parser;
+	}
+
+	n = vtparse_parse(parser, buf, avail);
+	at_end = parser->data_begin != parser->data_end &&
+	         parser->data_end == buf + avail;
+	if (ring->holding) {
+		/* If the new input does not continue the held span, restore the
+		   parser, return the held span and parse the new input again in the
+		   next call. Otherwise, prepend the held span to the new one. */
+		if (!vtparse_has_event(parser) || parser->data_begin != buf ||
+		    parser->data_end == buf || parser->action != ring->held_action) {
+			*parser = ring->saved;
+			return vtparse_ring_release(ring);
+		}
+		begin = ring->held_begin;
+		len = (ring->pos - begin) + (unsigned int)(parser->data_end - buf);
+		parser->data_begin = vtparse_ring_ptr(ring, begin);
+		parser->data_end = parser->data_begin + len;
+		parser->num_line_breaks += ring->held_line_breaks;
+		ring->holding = 0;
+	} else {
+		begin = ring->pos + (unsigned int)(parser->data_begin - buf);
+	}
+	ring->pos += n;
+	if (!vtparse_has_event(parser)) {
+		return NULL;
+	}
+
+	/* Hold back spans reaching the end of the input, unless they already fill
+	   the entire ring */
+	if (!flush && at_end && ring->head - begin < ring->size) {
+		ring->holding = 1;
+		ring->held_begin = begin;
+		ring->held_action = parser->action;
+		ring->held_line_breaks = parser->num_line_breaks;
+		ring->tail = begin;
+		return NULL;
+	}
+	return parser;
+}
@@ -0,0 +1,129 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_ring.h
+ *
+ * Optional feed-style interface on top of vtparse_parse(). Input is copied
+ * (or read directly) into a power-of-two ring buffer owned by the module. The
+ * pages of the ring are mapped twice in a row, such that any range of up to
+ * the ring size is contiguous in memory. Text and string payload spans
+ * reaching the end of the input fed so far are held back until the run ends,
+ * so returned spans are not split at read boundaries (this includes UTF-8
+ * sequences). Where the double mapping is not available, the module falls
+ * back to a linear buffer that is compacted when necessary. In contrast to the
+ * parser itself, this module depends on the C library and the operating
+ * system.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_RING_H
+#define VTPARSE_VTPARSE_RING_H
+
+#include <vtparse/vtparse.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Flag for vtparse_ring_open(); forces the compacting fallback even if the
+ * double mapping is available.
+ */
+#define VTPARSE_RING_NO_MMAP 0x01U
+
+/**
+ * Opaque ring state.
+ */
+typedef struct vtparse_ring vtparse_ring_t;
+
+/**
+ * Creates a new ring buffer with its own parser instance.
+ *
+ * @param size is the capacity of the ring in bytes. Rounded up to a power of
+ * two and to at least the page size. Zero selects the default of 64 KiB.
+ * @param flags is a combination of VTPARSE_RING_* flags.
+ * @return a new ring or NULL if memory could not be allocated.
+ */
+vtparse_ring_t *vtparse_ring_open(unsigned int size, unsigned int flags);
+
+/**
+ * Frees the ring buffer.
+ */
+void vtparse_ring_close(vtparse_ring_t *ring);
+
+/**
+ * Returns the parser instance owned by the ring, e.g. to pass it to
+ * vtparse_set_options() or vtparse_set_event_mask(). Do not call
+ * vtparse_parse() on this instance directly.
+ */
+vtparse_t *vtparse_ring_parser(vtparse_ring_t *ring);
+
+/**
+ * Returns a non-zero value if the ring uses the double mapping, zero if the
+ * compacting fallback is used.
+ */
+int vtparse_ring_is_mapped(const vtparse_ring_t *ring);
+
+/**
+ * Returns a pointer at the free space in the ring, e.g. to read() into it
+ * directly. Call vtparse_ring_commit() with the number of bytes written
+ * afterwards.
+ *
+ * @param avail receives the number of bytes that may be written.
+ */
+unsigned char *vtparse_ring_write_ptr(vtparse_ring_t *ring,
+                                      unsigned int *avail);
+
+/**
+ * Appends the given number of bytes written to the pointer returned by
+ * vtparse_ring_write_ptr() to the input.
+ */
+void vtparse_ring_commit(vtparse_ring_t *ring, unsigned int n);
+
+/**
+ * Copies the given input into the ring.
+ *
+ * @return the number of bytes that were copied; less than len if the ring is
+ * full. Call vtparse_next_event() until it returns NULL to make room.
+ */
+unsigned int vtparse_feed(vtparse_ring_t *ring, const unsigned char *buf,
+                          unsigned int len);
+
+/**
+ * Returns the next event. Data spans of the event point into the ring and
+ * remain valid until the next call to vtparse_next_event(). With the
+ * compacting fallback, vtparse_feed() and vtparse_ring_write_ptr() may move
+ * the data as well.
+ *
+ * @param flush if zero, a span reaching the end of the input fed so far is
+ * held back until more input arrives or the ring is full. Pass a non-zero
+ * value at the end of the input or before waiting for further input on an
+ * interactive stream, such that pending text is displayed right away.
+ * @return the parser holding the event, or NULL if more input is required.
+ */
+vtparse_t *vtparse_next_event(vtparse_ring_t *ring, int flush);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_RING_H */
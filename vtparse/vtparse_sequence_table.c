@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_sequence_tables.rb to re-generate this file.            *
+ ******************************************************************************/
+
+#include <vtparse/vtparse_sequence_table.h>
+
+VTPARSE_TABLE_DEF const char *const SEQUENCE_NAMES[] = {
+   "<no sequence>",
+   "SGR_RESET",
+   "ERASE_LINE",
+   "CURSOR_HOME",
+   "HIDE_CURSOR",
+   "SHOW_CURSOR",
+   "CURSOR_POSITION",
+   "SGR_FG_256",
+   "SGR_BG_256",
+   "G0_ASCII",
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_CLASSES[] = {
+/*00*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*10*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*20*/  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+/*30*/  2,  3,  4,  5,  6,  7,  3,  3,  8,  3,  0,  9,  0,  0,  0, 10,
+/*40*/  0,  0, 11,  0,  0,  0,  0,  0, 12,  0,  0, 13,  0,  0,  0,  0,
+/*50*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,  0,  0,  0,  0,
+/*60*/  0,  0,  0,  0,  0,  0,  0,  0, 15,  0,  0,  0, 16, 17,  0,  0,
+/*70*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*80*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*90*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*a0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*b0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*c0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*d0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*e0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+/*f0*/  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_DFA[][18] = {
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 0 */
+   { 0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0}, /* 1 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0}, /* 2 */
+   { 0,  0,  5,  6,  6,  7,  8,  6,  6,  9, 10,  0, 11, 12,  0,  0,  0, 13}, /* 3 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 4 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6,  9,  0,  0,  0,  0,  0,  0,  0, 14}, /* 5 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6,  9,  0,  0,  0,  0,  0,  0,  0,  0}, /* 6 */
+   { 0,  0,  6,  6,  6,  6,  6,  6, 15,  9,  0,  0,  0,  0,  0,  0,  0,  0}, /* 7 */
+   { 0,  0,  6,  6,  6,  6,  6,  6, 16,  9,  0,  0,  0,  0,  0,  0,  0,  0}, /* 8 */
+   { 0,  0,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0, 17,  0,  0,  0,  0,  0}, /* 9 */
+   { 0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 10 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 11 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 12 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 13 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 14 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6, 19,  0,  0,  0,  0,  0,  0,  0,  0}, /* 15 */
+   { 0,  0,  6,  6,  6,  6,  6,  6,  6, 20,  0,  0,  0,  0,  0,  0,  0,  0}, /* 16 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 17 */
+   { 0,  0,  0,  0,  0,  0,  0, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 18 */
+   { 0,  0,  9,  9,  9,  9,  9, 22,  9,  0,  0,  0, 17,  0,  0,  0,  0,  0}, /* 19 */
+   { 0,  0,  9,  9,  9,  9,  9, 23,  9,  0,  0,  0, 17,  0,  0,  0,  0,  0}, /* 20 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 24, 25,  0}, /* 21 */
+   { 0,  0,  9,  9,  9,  9,  9,  9,  9, 26,  0,  0, 17,  0,  0,  0,  0,  0}, /* 22 */
+   { 0,  0,  9,  9,  9,  9,  9,  9,  9, 27,  0,  0, 17,  0,  0,  0,  0,  0}, /* 23 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 24 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 25 */
+   { 0,  0, 26, 26, 26, 26, 26, 26, 26,  0,  0,  0,  0,  0,  0,  0,  0, 28}, /* 26 */
+   { 0,  0, 27, 27, 27, 27, 27, 27, 27,  0,  0,  0,  0,  0,  0,  0,  0, 29}, /* 27 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 28 */
+   { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}, /* 29 */
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_ACCEPT[] = {
+   VTPARSE_SEQUENCE_NONE, /* 0 */
+   VTPARSE_SEQUENCE_NONE, /* 1 */
+   VTPARSE_SEQUENCE_NONE, /* 2 */
+   VTPARSE_SEQUENCE_NONE, /* 3 */
+   VTPARSE_SEQUENCE_G0_ASCII, /* 4 */
+   VTPARSE_SEQUENCE_NONE, /* 5 */
+   VTPARSE_SEQUENCE_NONE, /* 6 */
+   VTPARSE_SEQUENCE_NONE, /* 7 */
+   VTPARSE_SEQUENCE_NONE, /* 8 */
+   VTPARSE_SEQUENCE_NONE, /* 9 */
+   VTPARSE_SEQUENCE_NONE, /* 10 */
+   VTPARSE_SEQUENCE_CURSOR_HOME, /* 11 */
+   VTPARSE_SEQUENCE_ERASE_LINE, /* 12 */
+   VTPARSE_SEQUENCE_SGR_RESET, /* 13 */
+   VTPARSE_SEQUENCE_SGR_RESET, /* 14 */
+   VTPARSE_SEQUENCE_NONE, /* 15 */
+   VTPARSE_SEQUENCE_NONE, /* 16 */
+   VTPARSE_SEQUENCE_CURSOR_POSITION, /* 17 */
+   VTPARSE_SEQUENCE_NONE, /* 18 */
+   VTPARSE_SEQUENCE_NONE, /* 19 */
+   VTPARSE_SEQUENCE_NONE, /* 20 */
+   VTPARSE_SEQUENCE_NONE, /* 21 */
+   VTPARSE_SEQUENCE_NONE, /* 22 */
+   VTPARSE_SEQUENCE_NONE, /* 23 */
+   VTPARSE_SEQUENCE_SHOW_CURSOR, /* 24 */
+   VTPARSE_SEQUENCE_HIDE_CURSOR, /* 25 */
+   VTPARSE_SEQUENCE_NONE, /* 26 */
+   VTPARSE_SEQUENCE_NONE, /* 27 */
+   VTPARSE_SEQUENCE_SGR_FG_256, /* 28 */
+   VTPARSE_SEQUENCE_SGR_BG_256, /* 29 */
+};
@@ -0,0 +1,45 @@
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_sequence_tables.rb to re-generate this file.            *
+ ******************************************************************************/
+
+#ifndef VTPARSE_VTPARSE_SEQUENCE_TABLE_H
+#define VTPARSE_VTPARSE_SEQUENCE_TABLE_H
+
+#include <vtparse/vtparse_table_decl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+   VTPARSE_SEQUENCE_NONE = 0,
+   VTPARSE_SEQUENCE_SGR_RESET = 1,
+   VTPARSE_SEQUENCE_ERASE_LINE = 2,
+   VTPARSE_SEQUENCE_CURSOR_HOME = 3,
+   VTPARSE_SEQUENCE_HIDE_CURSOR = 4,
+   VTPARSE_SEQUENCE_SHOW_CURSOR = 5,
+   VTPARSE_SEQUENCE_CURSOR_POSITION = 6,
+   VTPARSE_SEQUENCE_SGR_FG_256 = 7,
+   VTPARSE_SEQUENCE_SGR_BG_256 = 8,
+   VTPARSE_SEQUENCE_G0_ASCII = 9,
+} vtparse_sequence_t;
+
+/* DFA recognizing the sequences following an ESC. SEQUENCE_CLASSES maps
+   bytes to the columns of SEQUENCE_DFA; state 0 rejects the input and
+   state 1 is the initial state. SEQUENCE_ACCEPT holds the sequence
+   recognized upon entering a state, or VTPARSE_SEQUENCE_NONE. */
+#define VTPARSE_SEQUENCE_NUM_STATES 30
+#define VTPARSE_SEQUENCE_NUM_CLASSES 18
+
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_CLASSES[256];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_DFA[30][18];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char SEQUENCE_ACCEPT[30];
+VTPARSE_TABLE_DECL const char *const SEQUENCE_NAMES[10];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_SEQUENCE_TABLE_H */
+
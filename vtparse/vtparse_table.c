@@ -5,7 +5,7 @@
 
 #include <vtparse/vtparse_table.h>
 
-char *ACTION_NAMES[] = {
+VTPARSE_TABLE_DEF const char *const ACTION_NAMES[] = {
    "<no action>",
    "CLEAR",
    "COLLECT",
@@ -24,7 +24,7 @@ char *ACTION_NAMES[] = {
    "ERROR",
 };
 
-char *STATE_NAMES[] = {
+VTPARSE_TABLE_DEF const char *const STATE_NAMES[] = {
    "<no state>",
    "CSI_ENTRY",
    "CSI_IGNORE",
@@ -42,7 +42,7 @@ char *STATE_NAMES[] = {
    "SOS_PM_APC_STRING",
 };
 
-vtparse_state_change_t STATE_TABLE[14][256] = {
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const vtparse_state_change_t STATE_TABLE[14][256] = {
   {  /* VTPARSE_STATE_CSI_ENTRY = 0 */
 /*0  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
 /*1  */  VTPARSE_ACTION_EXECUTE            | (0                                 << 4),
@@ -1985,7 +1985,7 @@ vtparse_state_change_t STATE_TABLE[14][256] = {
   },
 };
 
-vtparse_action_t ENTRY_ACTIONS[] = {
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char ENTRY_ACTIONS[] = {
    VTPARSE_ACTION_CLEAR, /* CSI_ENTRY */
    0  /* none for CSI_IGNORE */,
    0  /* none for CSI_INTERMEDIATE */,
@@ -2002,7 +2002,7 @@ vtparse_action_t ENTRY_ACTIONS[] = {
    0  /* none for SOS_PM_APC_STRING */,
 };
 
-vtparse_action_t EXIT_ACTIONS[] = {
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char EXIT_ACTIONS[] = {
    0  /* none for CSI_ENTRY */,
    0  /* none for CSI_IGNORE */,
    0  /* none for CSI_INTERMEDIATE */,
@@ -2019,6 +2019,520 @@ vtparse_action_t EXIT_ACTIONS[] = {
    0  /* none for SOS_PM_APC_STRING */,
 };
 
-#ifdef __cplusplus
-}
-#endif
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const vtparse_run_class_t RUN_CLASSES[] = {
+   {0, 0, {0}, {0}}, /* CSI_ENTRY */
+   {0, 0, {0}, {0}}, /* CSI_IGNORE */
+   {0, 0, {0}, {0}}, /* CSI_INTERMEDIATE */
+   {0, 0, {0}, {0}}, /* CSI_PARAM */
+   {0, 0, {0}, {0}}, /* DCS_ENTRY */
+   {0, 0, {0}, {0}}, /* DCS_IGNORE */
+   {0, 0, {0}, {0}}, /* DCS_INTERMEDIATE */
+   {0, 0, {0}, {0}}, /* DCS_PARAM */
+   {VTPARSE_ACTION_PUT, 3, {0x00, 0x19, 0x1c}, {0x17, 0x19, 0x7e}}, /* DCS_PASSTHROUGH */
+   {0, 0, {0}, {0}}, /* ESCAPE */
+   {0, 0, {0}, {0}}, /* ESCAPE_INTERMEDIATE */
+   {VTPARSE_ACTION_PRINT, 1, {0x20}, {0xf7}}, /* GROUND */
+   {VTPARSE_ACTION_OSC_PUT, 1, {0x20}, {0x7f}}, /* OSC_STRING */
+   {0, 0, {0}, {0}}, /* SOS_PM_APC_STRING */
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char BYTE_CLASSES[] = {
+/*00*/  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+/*10*/  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  3,  4,  0,  0,  0,  0,
+/*20*/  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+/*30*/  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  7,  8,  9,  9,  9,  9,
+/*40*/ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+/*50*/ 11, 12, 12, 12, 12, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+/*60*/ 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+/*70*/ 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 22,
+/*80*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*90*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*a0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*b0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*c0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*d0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*e0*/ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+/*f0*/ 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24,
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_TABLE[14][VTPARSE_NUM_CLASSES][VTPARSE_NUM_CLASSES] = {
+  {  /* VTPARSE_STATE_CSI_ENTRY = 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 7, 8, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,10,10,10}, /* 5 */
+    { 0, 0, 0, 0,11,12,13,14,13,14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,15,15,15}, /* 6 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 7 */
+    { 0, 0, 0, 0,11,12,13,14,13,14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,15,15,15}, /* 8 */
+    { 0, 0, 0, 0, 7,19,20, 9,20, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,21,21,21}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,23,24,25,24,26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,27,27,27}, /* 22 */
+    { 0, 0, 0, 0,22,23,24,25,24,26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,27,27,27}, /* 23 */
+    { 0, 0, 0, 0,22,23,24,25,24,26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,27,27,27}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_CSI_IGNORE = 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 5 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 6 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 7 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 8 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 9 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 10 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 11 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 12 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 13 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 14 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 15 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 16 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 17 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 18 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 19 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 20 */
+    { 0, 0, 0, 0,16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,30}, /* 21 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 22 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 23 */
+    { 0, 0, 0, 0,22,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,28,28,28}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_CSI_INTERMEDIATE = 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0,31,32,33,33,33,33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,34,34,34}, /* 5 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 6 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 7 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 8 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,35,25,25,25,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,36,36,36}, /* 22 */
+    { 0, 0, 0, 0,22,35,25,25,25,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,36,36,36}, /* 23 */
+    { 0, 0, 0, 0,22,35,25,25,25,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,36,36,36}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_CSI_PARAM = 3 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 7, 8, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,10,10,10}, /* 5 */
+    { 0, 0, 0, 0,37,38,39,40,39,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,41,41,41}, /* 6 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 7 */
+    { 0, 0, 0, 0,37,38,39,40,39,40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,41,41,41}, /* 8 */
+    { 0, 0, 0, 0,16,17,17,17,17,17,18,18,18,18,18,18,18,18,18,18,18,18,17,17,17}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,23,42,25,42,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,43,43,43}, /* 22 */
+    { 0, 0, 0, 0,22,23,42,25,42,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,43,43,43}, /* 23 */
+    { 0, 0, 0, 0,22,23,42,25,42,25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,43,43,43}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_ENTRY = 4 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 0 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {49,49, 0, 0, 7,50,51,51,51,51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,49,49,49}, /* 5 */
+    {52,52, 0, 0,11,53,54,55,54,55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,52,52,52}, /* 6 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 7 */
+    {52,52, 0, 0,11,53,54,55,54,55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,52,52,52}, /* 8 */
+    {57,57, 0, 0, 7,58,59,51,59,51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,57,57,57}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 22 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 23 */
+    {44,44, 0, 0,22,45,46,47,46,48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,44,44,44}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_IGNORE = 5 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 0 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 5 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 6 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 7 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 8 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 9 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 10 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 11 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 12 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 13 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 14 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 15 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 16 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 17 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 18 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 19 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 20 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 21 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 22 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 23 */
+    {60,60, 0, 0,22,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_INTERMEDIATE = 6 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 0 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {63,63, 0, 0,31,64,65,65,65,65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,63,63,63}, /* 5 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 6 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 7 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 8 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 22 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 23 */
+    {61,61, 0, 0,22,62,47,47,47,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,61,61,61}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_PARAM = 7 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 0 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {49,49, 0, 0, 7,50,51,51,51,51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,49,49,49}, /* 5 */
+    {68,68, 0, 0,37,69,70,71,70,71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,68,68,68}, /* 6 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 7 */
+    {68,68, 0, 0,37,69,70,71,70,71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,68,68,68}, /* 8 */
+    {56,56, 0, 0,16,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 22 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 23 */
+    {66,66, 0, 0,22,45,67,47,67,47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,66,66,66}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_DCS_PASSTHROUGH = 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 4 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,72,72,72}, /* 22 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,72,72,72}, /* 23 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,72,72,72}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_ESCAPE = 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 7,73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,74,74,74}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    {75,75, 0, 0, 1,76,77,78,77,79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,75,75,75}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    {80,80, 0, 0,16,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 1,81,82,83,82,84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,85,85,85}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    {80,80, 0, 0,16,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80}, /* 19 */
+    {80,80, 0, 0,16,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80,80}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,86, 0, 0, 0, 0, 0,87, 0,88, 0, 0,89, 0, 0,88,88, 0,90,90,90}, /* 22 */
+    { 0, 0, 0, 0,22,86, 0, 0, 0, 0, 0,87, 0,88, 0, 0,89, 0, 0,88,88, 0,90,90,90}, /* 23 */
+    { 0, 0, 0, 0,22,86, 0, 0, 0, 0, 0,87, 0,88, 0, 0,89, 0, 0,88,88, 0,90,90,90}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_ESCAPE_INTERMEDIATE = 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0,31,91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,92,92,92}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0,22,93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,94,94,94}, /* 22 */
+    { 0, 0, 0, 0,22,93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,94,94,94}, /* 23 */
+    { 0, 0, 0, 0,22,93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,94,94,94}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_GROUND = 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 22 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 23 */
+    { 0, 0, 0, 0,22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,95}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_OSC_STRING = 12 */
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,96,96}, /* 0 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 4 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 5 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 6 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 7 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 8 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 9 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 10 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 11 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 12 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 13 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 14 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 15 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 16 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 17 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 18 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 19 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 20 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 21 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 22 */
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,96,96}, /* 23 */
+    {96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,96,96}, /* 24 */
+  },
+  {  /* VTPARSE_STATE_SOS_PM_APC_STRING = 13 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 0 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 1 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 2 */
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, /* 3 */
+    { 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 5, 0, 0, 4, 4, 0, 6, 6, 6}, /* 4 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 5 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 6 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 7 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 8 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 9 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 10 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 11 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 12 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 13 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 14 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 15 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 16 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 17 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 18 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 19 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 20 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 21 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 22 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 23 */
+    {97,97, 0, 0,22,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97,97}, /* 24 */
+  },
+};
+
+VTPARSE_TABLE_DEF VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_OPS[98][VTPARSE_MAX_STRIDE2_OPS + 2] = {
+   {0x00, 0x00},
+   {0x0a, 0x02, 0x21, 0x31},
+   {0x0b, 0x02, 0x21, 0x32},
+   {0x05, 0x02, 0x21, 0x31},
+   {0x0e, 0x02, 0x21, 0x30},
+   {0x01, 0x02, 0x21, 0x31},
+   {0x0a, 0x01, 0x21},
+   {0x0a, 0x02, 0x22, 0x31},
+   {0x03, 0x02, 0x22, 0x12},
+   {0x02, 0x02, 0x22, 0x30},
+   {0x03, 0x01, 0x22},
+   {0x0a, 0x02, 0x2b, 0x31},
+   {0x03, 0x02, 0x2b, 0x32},
+   {0x04, 0x02, 0x2b, 0x1b},
+   {0x02, 0x02, 0x2b, 0x30},
+   {0x04, 0x01, 0x2b},
+   {0x0a, 0x02, 0x20, 0x31},
+   {0x02, 0x01, 0x20},
+   {0x0c, 0x02, 0x20, 0x30},
+   {0x03, 0x02, 0x22, 0x32},
+   {0x04, 0x02, 0x22, 0x1b},
+   {0x04, 0x01, 0x22},
+   {0x0a, 0x01, 0x31},
+   {0x03, 0x01, 0x32},
+   {0x04, 0x01, 0x3b},
+   {0x02, 0x01, 0x30},
+   {0x04, 0x01, 0x32},
+   {0x01, 0x00},
+   {0x02, 0x00},
+   {0x0c, 0x01, 0x30},
+   {0x0c, 0x01, 0x20},
+   {0x0a, 0x02, 0x02, 0x31},
+   {0x03, 0x02, 0x02, 0x12},
+   {0x02, 0x02, 0x02, 0x30},
+   {0x03, 0x01, 0x02},
+   {0x03, 0x01, 0x12},
+   {0x03, 0x00},
+   {0x0a, 0x02, 0x0b, 0x31},
+   {0x03, 0x02, 0x0b, 0x32},
+   {0x04, 0x02, 0x0b, 0x1b},
+   {0x02, 0x02, 0x0b, 0x30},
+   {0x04, 0x01, 0x0b},
+   {0x04, 0x01, 0x1b},
+   {0x04, 0x00},
+   {0x05, 0x00},
+   {0x07, 0x01, 0x32},
+   {0x08, 0x01, 0x3b},
+   {0x06, 0x01, 0x30},
+   {0x08, 0x01, 0x32},
+   {0x07, 0x01, 0x22},
+   {0x07, 0x02, 0x22, 0x12},
+   {0x06, 0x02, 0x22, 0x30},
+   {0x08, 0x01, 0x2b},
+   {0x07, 0x02, 0x2b, 0x32},
+   {0x08, 0x02, 0x2b, 0x1b},
+   {0x06, 0x02, 0x2b, 0x30},
+   {0x06, 0x01, 0x20},
+   {0x08, 0x01, 0x22},
+   {0x07, 0x02, 0x22, 0x32},
+   {0x08, 0x02, 0x22, 0x1b},
+   {0x06, 0x00},
+   {0x07, 0x00},
+   {0x07, 0x01, 0x12},
+   {0x07, 0x01, 0x02},
+   {0x07, 0x02, 0x02, 0x12},
+   {0x06, 0x02, 0x02, 0x30},
+   {0x08, 0x00},
+   {0x08, 0x01, 0x1b},
+   {0x08, 0x01, 0x0b},
+   {0x07, 0x02, 0x0b, 0x32},
+   {0x08, 0x02, 0x0b, 0x1b},
+   {0x06, 0x02, 0x0b, 0x30},
+   {0x09, 0x00},
+   {0x0b, 0x02, 0x22, 0x12},
+   {0x0b, 0x01, 0x22},
+   {0x05, 0x01, 0x21},
+   {0x07, 0x02, 0x21, 0x32},
+   {0x08, 0x02, 0x21, 0x3b},
+   {0x06, 0x02, 0x21, 0x30},
+   {0x08, 0x02, 0x21, 0x32},
+   {0x0e, 0x01, 0x20},
+   {0x03, 0x02, 0x21, 0x32},
+   {0x04, 0x02, 0x21, 0x3b},
+   {0x02, 0x02, 0x21, 0x30},
+   {0x04, 0x02, 0x21, 0x32},
+   {0x01, 0x01, 0x21},
+   {0x0b, 0x01, 0x32},
+   {0x05, 0x01, 0x31},
+   {0x0e, 0x01, 0x30},
+   {0x01, 0x01, 0x31},
+   {0x0a, 0x00},
+   {0x0b, 0x02, 0x02, 0x12},
+   {0x0b, 0x01, 0x02},
+   {0x0b, 0x01, 0x12},
+   {0x0b, 0x00},
+   {0x0c, 0x00},
+   {0x0d, 0x00},
+   {0x0e, 0x00},
+};
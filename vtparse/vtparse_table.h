@@ -6,6 +6,8 @@
 #ifndef VTPARSE_VTPARSE_TABLE_H
 #define VTPARSE_VTPARSE_TABLE_H
 
+#include <vtparse/vtparse_table_decl.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -52,11 +54,36 @@ typedef enum {
 
 typedef unsigned char vtparse_state_change_t;
 
-extern vtparse_state_change_t STATE_TABLE[14][256];
-extern vtparse_action_t ENTRY_ACTIONS[14];
-extern vtparse_action_t EXIT_ACTIONS[14];
-extern char *ACTION_NAMES[16];
-extern char *STATE_NAMES[15];
+/* Number of states; the states are numbered starting at one */
+#define VTPARSE_NUM_STATES 14
+
+/* Bytes continuing a run of the data action in a given state, as inclusive
+   ranges. num_ranges is zero if the state has no data action or the set
+   of bytes consists of too many ranges. */
+#define VTPARSE_MAX_RUN_RANGES 4
+typedef struct vtparse_run_class {
+   unsigned char action;
+   unsigned char num_ranges;
+   unsigned char lo[VTPARSE_MAX_RUN_RANGES];
+   unsigned char hi[VTPARSE_MAX_RUN_RANGES];
+} vtparse_run_class_t;
+
+/* Byte equivalence classes and the stride-2 transition table consuming two
+   bytes per lookup, see vtparse_gen_c_tables.rb. STRIDE2_OPS holds the state
+   after both bytes, the number of operations and the operations. */
+#define VTPARSE_NUM_CLASSES 25
+#define VTPARSE_MAX_STRIDE2_OPS 2
+
+/* ENTRY_ACTIONS and EXIT_ACTIONS hold one vtparse_action_t per byte */
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const vtparse_state_change_t STATE_TABLE[14][256];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char ENTRY_ACTIONS[14];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char EXIT_ACTIONS[14];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const vtparse_run_class_t RUN_CLASSES[14];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char BYTE_CLASSES[256];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_TABLE[14][VTPARSE_NUM_CLASSES][VTPARSE_NUM_CLASSES];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char STRIDE2_OPS[98][VTPARSE_MAX_STRIDE2_OPS + 2];
+VTPARSE_TABLE_DECL const char *const ACTION_NAMES[16];
+VTPARSE_TABLE_DECL const char *const STATE_NAMES[15];
 
 #ifdef __cplusplus
 }
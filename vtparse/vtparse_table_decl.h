@@ -0,0 +1,64 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_table_decl.h
+ *
+ * Storage class, visibility and alignment of the generated tables. Included
+ * by every generated table header, such that all tables are declared the same
+ * way regardless of which header is included first. The tables are not part
+ * of the API of the shared library.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_TABLE_DECL_H
+#define VTPARSE_VTPARSE_TABLE_DECL_H
+
+/**
+ * Storage class of the table declarations and definitions. The tables are
+ * hidden in the shared library; vtparse_amalgamated.h sets both to static.
+ */
+#ifndef VTPARSE_TABLE_DECL
+#if defined(__GNUC__) && !defined(_WIN32) && !defined(__CYGWIN__)
+#define VTPARSE_TABLE_DECL extern __attribute__((visibility("hidden")))
+#else
+#define VTPARSE_TABLE_DECL extern
+#endif
+#endif
+#ifndef VTPARSE_TABLE_DEF
+#define VTPARSE_TABLE_DEF
+#endif
+
+/**
+ * Tables consulted while parsing start at a cache line boundary, such that
+ * each row of STATE_TABLE occupies exactly four cache lines.
+ */
+#define VTPARSE_TABLE_ALIGNMENT 64
+#ifndef VTPARSE_TABLE_ALIGN
+#if defined(__GNUC__)
+#define VTPARSE_TABLE_ALIGN __attribute__((aligned(VTPARSE_TABLE_ALIGNMENT)))
+#elif defined(_MSC_VER)
+#define VTPARSE_TABLE_ALIGN __declspec(align(VTPARSE_TABLE_ALIGNMENT))
+#else
+#define VTPARSE_TABLE_ALIGN
+#endif
+#endif
+
+#endif /* VTPARSE_VTPARSE_TABLE_DECL_H */
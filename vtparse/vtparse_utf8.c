@@ -0,0 +1,263 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_utf8.c
+ *
+ * Implementation of the UTF-8 validator and decoder. The scalar decoder
+ * handles partial characters at the beginning and end of a range as well as
+ * invalid input; the bulk of valid input is checked by the vectorized kernels
+ * in vtparse_dispatch.c. The column widths are looked up in the tables
+ * generated by tables/vtparse_gen_width_tables.rb.
+ *
+ * @author Andreas Stöckel
+ */
+
+#include <vtparse/vtparse_dispatch.h>
+#include <vtparse/vtparse_utf8.h>
+#include <vtparse/vtparse_width_table.h>
+
+/* Return values of vtparse_utf8_step() apart from code points */
+#define UTF8_MORE (-1L)    /* Byte consumed, character incomplete */
+#define UTF8_INVALID (-2L) /* Byte consumed, cannot start a character */
+#define UTF8_ABORTED (-3L) /* Byte not consumed, interrupts a character */
+
+/* Printable ASCII characters, each of which occupies one column */
+static const vtparse_run_class_t vtparse_printable_ascii = {
+    VTPARSE_ACTION_PRINT, 1, {0x20}, {0x7E}};
+
+/******************************************************************************
+ * Internal functions                                                         *
+ ******************************************************************************/
+
+/**
+ * Feeds a single byte into the decoder. Returns the completed code point or
+ * one of the UTF8_* constants above.
+ */
+static long vtparse_utf8_step(vtparse_utf8_t *utf8, unsigned char c) {
+	if (utf8->need) {
+		if (c < utf8->lo || c > utf8->hi) {
+			utf8->need = 0;
+			return UTF8_ABORTED;
+		}
+		utf8->codepoint = (utf8->codepoint << 6U) | (c & 0x3FU);
+		utf8->lo = 0x80U;
+		utf8->hi = 0xBFU;
+		if (--utf8->need) {
+			return UTF8_MORE;
+		}
+		return (long)utf8->codepoint;
+	}
+
+	/* The ranges of the second byte exclude overlong encodings, surrogates
+	   and code points beyond U+10FFFF */
+	if (c < 0x80U) {
+		return (long)c;
+	} else if (c < 0xC2U) {
+		return UTF8_INVALID;
+	} else if (c < 0xE0U) {
+		utf8->need = 1U;
+		utf8->codepoint = c & 0x1FU;
+		utf8->lo = 0x80U;
+		utf8->hi = 0xBFU;
+	} else if (c < 0xF0U) {
+		utf8->need = 2U;
+		utf8->codepoint = c & 0x0FU;
+		utf8->lo = (c == 0xE0U) ? 0xA0U : 0x80U;
+		utf8->hi = (c == 0xEDU) ? 0x9FU : 0xBFU;
+	} else if (c < 0xF5U) {
+		utf8->need = 3U;
+		utf8->codepoint = c & 0x07U;
+		utf8->lo = (c == 0xF0U) ? 0x90U : 0x80U;
+		utf8->hi = (c == 0xF4U) ? 0x8FU : 0xBFU;
+	} else {
+		return UTF8_INVALID;
+	}
+	return UTF8_MORE;
+}
+
+/******************************************************************************
+ * Public C API                                                               *
+ ******************************************************************************/
+
+VTPARSE_API void vtparse_utf8_init(vtparse_utf8_t *utf8) {
+	utf8->codepoint = 0;
+	utf8->need = 0;
+	utf8->lo = 0x80U;
+	utf8->hi = 0xBFU;
+	utf8->kernels = vtparse_get_kernels();
+}
+
+VTPARSE_API int vtparse_utf8_validate(vtparse_utf8_t *utf8,
+                                      const unsigned char *buf,
+                                      unsigned int len,
+                                      vtparse_utf8_result_t *result) {
+	const vtparse_utf8_kernel_t kernel = utf8->kernels->validate_utf8;
+	const int carried = utf8->need != 0U;
+	unsigned int pos = 0, seq_start = 0, next_kernel = 0, n = 0;
+	int error = 0;
+	long res;
+
+	result->error_offset = 0;
+	while (pos < len) {
+		if (!utf8->need) {
+			/* Let the vectorized kernel consume the bulk of valid input; if it
+			   stops early, decode a few characters before trying again */
+			if (kernel && pos >= next_kernel &&
+			    len - pos >= VTPARSE_SCAN_MIN_LEN) {
+				pos = kernel(buf, pos, len, &n);
+				next_kernel = pos + VTPARSE_SCAN_MIN_LEN;
+				if (pos == len) {
+					break;
+				}
+			}
+			seq_start = pos;
+		}
+		res = vtparse_utf8_step(utf8, buf[pos]);
+		if (res == UTF8_MORE) {
+			pos++;
+			continue;
+		}
+		if (res < 0 && !error) {
+			error = 1;
+			result->error_offset = seq_start;
+		}
+		if (res != UTF8_ABORTED) {
+			pos++;
+		}
+		n++;
+	}
+
+	result->num_codepoints = n;
+	if (error) {
+		result->status = VTPARSE_UTF8_INVALID;
+	} else if (!carried && !utf8->need && n == len) {
+		result->status = VTPARSE_UTF8_ASCII;
+	} else {
+		result->status = VTPARSE_UTF8_VALID;
+	}
+	return result->status;
+}
+
+VTPARSE_API unsigned int vtparse_utf8_decode(vtparse_utf8_t *utf8,
+                                             const unsigned char *buf,
+                                             unsigned int len,
+                                             unsigned long *codepoints,
+                                             unsigned int max_codepoints,
+                                             unsigned int *n_read) {
+	unsigned int pos = 0, n = 0;
+	long res;
+
+	while (pos < len && n + 2U <= max_codepoints) {
+		/* Fast path for ASCII */
+		if (!utf8->need && buf[pos] < 0x80U) {
+			do {
+				codepoints[n++] = buf[pos++];
+			} while (pos < len && n < max_codepoints && buf[pos] < 0x80U);
+			continue;
+		}
+		res = vtparse_utf8_step(utf8, buf[pos]);
+		if (res == UTF8_MORE) {
+			pos++;
+		} else if (res < 0) {
+			codepoints[n++] = VTPARSE_UTF8_REPLACEMENT;
+			pos += (res == UTF8_INVALID) ? 1U : 0U;
+		} else {
+			codepoints[n++] = (unsigned long)res;
+			pos++;
+		}
+	}
+	*n_read = pos;
+	return n;
+}
+
+VTPARSE_API int vtparse_utf8_next(vtparse_utf8_t *utf8, const unsigned char *buf,
+                                  unsigned int len, unsigned int *n_read,
+                                  unsigned long *codepoint) {
+	unsigned int pos = 0;
+	long res;
+
+	while (pos < len) {
+		res = vtparse_utf8_step(utf8, buf[pos]);
+		if (res == UTF8_MORE) {
+			pos++;
+			continue;
+		}
+		*n_read = pos + ((res == UTF8_ABORTED) ? 0U : 1U);
+		*codepoint = (res < 0) ? VTPARSE_UTF8_REPLACEMENT : (unsigned long)res;
+		return 1;
+	}
+	*n_read = pos;
+	return 0;
+}
+
+VTPARSE_API int vtparse_codepoint_width(unsigned long codepoint) {
+	unsigned int block;
+	if (codepoint > 0x10FFFFUL) {
+		return 1;
+	}
+	block = WIDTH_STAGE1[codepoint >> VTPARSE_WIDTH_BLOCK_BITS];
+	return (WIDTH_STAGE2[block][(codepoint & 0xFFU) >> 2U] >>
+	        ((codepoint & 3U) << 1U)) &
+	       3;
+}
+
+VTPARSE_API unsigned int vtparse_utf8_width(vtparse_utf8_t *utf8,
+                                            const unsigned char *buf,
+                                            unsigned int len) {
+	const vtparse_scan_kernel_t scan = utf8->kernels->scan_ground;
+	unsigned int pos = 0, end, width = 0;
+	long res;
+
+	while (pos < len) {
+		/* Runs of printable ASCII are one column per byte; let the scan
+		   kernel handle long runs */
+		if (!utf8->need && buf[pos] - 0x20U < 0x5FU) {
+			if (scan && len - pos >= VTPARSE_SCAN_MIN_LEN) {
+				end = scan(&vtparse_printable_ascii, buf, pos, len);
+			} else {
+				end = pos + 1U;
+				while (end < len && buf[end] - 0x20U < 0x5FU) {
+					end++;
+				}
+			}
+			width += end - pos;
+			pos = end;
+			continue;
+		}
+		res = vtparse_utf8_step(utf8, buf[pos]);
+		if (res == UTF8_MORE) {
+			pos++;
+		} else if (res < 0) {
+			width++; /* U+FFFD */
+			pos += (res == UTF8_INVALID) ? 1U : 0U;
+		} else {
+			width += (unsigned int)vtparse_codepoint_width((unsigned long)res);
+			pos++;
+		}
+	}
+	return width;
+}
+
+VTPARSE_API int vtparse_utf8_flush(vtparse_utf8_t *utf8) {
+	const int pending = utf8->need != 0U;
+	utf8->need = 0;
+	return pending;
+}
@@ -0,0 +1,203 @@
+/*
+ * VTParse -- An implementation of Paul Williams' DEC compatible state machine
+ *
+ * Copyright (C) 2007  Joshua Haberman <joshua@reverberate.org>
+ * Copyright (C) 2018  Andreas Stöckel
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file vtparse_utf8.h
+ *
+ * Streaming UTF-8 validator and decoder for the data ranges returned with
+ * VTPARSE_ACTION_PRINT. The parser passes all bytes between 0x20 and 0xF7
+ * through as text without looking at their encoding; this module checks and
+ * decodes them. A character split between two ranges is carried over in the
+ * vtparse_utf8_t state, so no data needs to be copied.
+ *
+ * Invalid input is handled according to the "maximal subpart" practice of
+ * the Unicode standard: each maximal prefix of a valid sequence, as well as
+ * each byte that cannot start a sequence, counts as one invalid character
+ * and is decoded as U+FFFD.
+ *
+ * @author Andreas Stöckel
+ */
+
+#ifndef VTPARSE_VTPARSE_UTF8_H
+#define VTPARSE_VTPARSE_UTF8_H
+
+#include <vtparse/vtparse.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Status values reported in vtparse_utf8_result_t.
+ */
+#define VTPARSE_UTF8_ASCII 0
+#define VTPARSE_UTF8_VALID 1
+#define VTPARSE_UTF8_INVALID 2
+
+/**
+ * Code point the decoder emits for invalid input.
+ */
+#define VTPARSE_UTF8_REPLACEMENT 0xFFFDUL
+
+/**
+ * Decoder state carried across data ranges.
+ */
+typedef struct vtparse_utf8 {
+	/**
+	 * Bits of the partially decoded character.
+	 */
+	unsigned long codepoint;
+
+	/**
+	 * Number of continuation bytes still missing.
+	 */
+	unsigned char need;
+
+	/**
+	 * Range of valid values of the next continuation byte.
+	 */
+	unsigned char lo, hi;
+
+	/**
+	 * Kernels in effect when vtparse_utf8_init() was called.
+	 */
+	const struct vtparse_kernels *kernels;
+} vtparse_utf8_t;
+
+/**
+ * Result of vtparse_utf8_validate().
+ */
+typedef struct vtparse_utf8_result {
+	/**
+	 * VTPARSE_UTF8_ASCII if the range only consists of ASCII characters (and
+	 * no character is carried over from or into a neighbouring range),
+	 * VTPARSE_UTF8_VALID if it is valid UTF-8, VTPARSE_UTF8_INVALID
+	 * otherwise.
+	 */
+	int status;
+
+	/**
+	 * Number of characters completed in this range, including invalid ones.
+	 * Equals the number of code points vtparse_utf8_decode() produces.
+	 */
+	unsigned int num_codepoints;
+
+	/**
+	 * Offset of the first invalid sequence in the range; zero if the
+	 * sequence started in a preceding range. Only valid if status is
+	 * VTPARSE_UTF8_INVALID.
+	 */
+	unsigned int error_offset;
+} vtparse_utf8_result_t;
+
+/**
+ * Resets the decoder state. Selects the vectorized validator for the
+ * instruction set chosen by vtparse_set_isa().
+ */
+VTPARSE_API void vtparse_utf8_init(vtparse_utf8_t *utf8);
+
+/**
+ * Validates the given range and counts its characters, continuing a
+ * character left incomplete by the previous call.
+ *
+ * @param utf8 is the decoder state.
+ * @param buf points at the data, e.g. parser.data_begin.
+ * @param len is the number of bytes.
+ * @param result receives the status of the range.
+ * @return the status, i.e. result->status.
+ */
+VTPARSE_API int vtparse_utf8_validate(vtparse_utf8_t *utf8,
+                                      const unsigned char *buf,
+                                      unsigned int len,
+                                      vtparse_utf8_result_t *result);
+
+/**
+ * Decodes the given range into code points, continuing a character left
+ * incomplete by the previous call.
+ *
+ * @param utf8 is the decoder state.
+ * @param buf points at the data, e.g. parser.data_begin.
+ * @param len is the number of bytes.
+ * @param codepoints receives the decoded code points.
+ * @param max_codepoints is the size of the codepoints array; must be at
+ * least two.
+ * @param n_read receives the number of consumed bytes, which is less than
+ * len if the codepoints array is full.
+ * @return the number of code points written.
+ */
+VTPARSE_API unsigned int vtparse_utf8_decode(vtparse_utf8_t *utf8,
+                                             const unsigned char *buf,
+                                             unsigned int len,
+                                             unsigned long *codepoints,
+                                             unsigned int max_codepoints,
+                                             unsigned int *n_read);
+
+/**
+ * Decodes a single character, continuing a character left incomplete by the
+ * previous call.
+ *
+ * @param utf8 is the decoder state.
+ * @param buf points at the data.
+ * @param len is the number of bytes.
+ * @param n_read receives the number of consumed bytes.
+ * @param codepoint receives the decoded code point, or U+FFFD for an invalid
+ * sequence.
+ * @return zero if the range ended before a character was completed, in which
+ * case all bytes are consumed; non-zero otherwise.
+ */
+VTPARSE_API int vtparse_utf8_next(vtparse_utf8_t *utf8, const unsigned char *buf,
+                                  unsigned int len, unsigned int *n_read,
+                                  unsigned long *codepoint);
+
+/**
+ * Returns the number of terminal columns occupied by the given code point: 0
+ * for combining marks, format and control characters, 2 for East Asian wide
+ * and fullwidth characters (including most emoji), and 1 otherwise.
+ */
+VTPARSE_API int vtparse_codepoint_width(unsigned long codepoint);
+
+/**
+ * Returns the total number of columns occupied by the characters completed
+ * in the given range, continuing a character left incomplete by the previous
+ * call. Invalid sequences occupy one column each, like U+FFFD. Equivalent to
+ * summing vtparse_codepoint_width() over the output of vtparse_utf8_decode(),
+ * but skips over printable ASCII without decoding it.
+ *
+ * @param utf8 is the decoder state.
+ * @param buf points at the data, e.g. parser.data_begin.
+ * @param len is the number of bytes.
+ * @return the number of columns.
+ */
+VTPARSE_API unsigned int vtparse_utf8_width(vtparse_utf8_t *utf8,
+                                            const unsigned char *buf,
+                                            unsigned int len);
+
+/**
+ * Discards a partially decoded character, e.g. when a control character
+ * interrupts the text. Returns a non-zero value if there was such a character;
+ * it should be treated as one invalid character (U+FFFD) in this case.
+ */
+VTPARSE_API int vtparse_utf8_flush(vtparse_utf8_t *utf8);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_UTF8_H */
@@ -0,0 +1,31 @@
+/******************************************************************************
+ * Note: This file was automatically generated. Please execute                *
+ * tables/vtparse_gen_width_tables.rb to re-generate this file.               *
+ ******************************************************************************/
+
+#ifndef VTPARSE_VTPARSE_WIDTH_TABLE_H
+#define VTPARSE_VTPARSE_WIDTH_TABLE_H
+
+#include <vtparse/vtparse_table_decl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Column widths (0, 1 or 2) of all code points, Unicode 15.0.0. The
+   first stage maps bits 8 to 20 of a code point to a block of the second
+   stage; each block holds the widths of 256 code points, packed with two
+   bits per code point, least significant bits first. */
+#define VTPARSE_WIDTH_UNICODE_VERSION "15.0.0"
+#define VTPARSE_WIDTH_BLOCK_BITS 8
+#define VTPARSE_WIDTH_NUM_BLOCKS 105
+
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char WIDTH_STAGE1[4352];
+VTPARSE_TABLE_DECL VTPARSE_TABLE_ALIGN const unsigned char WIDTH_STAGE2[105][64];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VTPARSE_VTPARSE_WIDTH_TABLE_H */
+